@@ -8,6 +8,27 @@
 
 //------------------------------------------------------------------------------
 
+// Two methods are provided.  Both compute the same decomposition.
+
+// LAGraph_KCore_Peel: vertices are peeled with GraphBLAS operations, one core
+// level at a time.  Levels at which no vertex would be removed are skipped:
+// once a level is done, the next level is the smallest degree of the vertices
+// that remain.  The work at each level is thus proportional to the vertices
+// removed and their edges, plus one reduction over the remaining vertices.
+
+// LAGraph_KCore_Bucket: a parallel bucket-based peeling (as in ParK and
+// Julienne), for SuiteSparse:GraphBLAS only.  The pattern of G->A is accessed
+// directly, and the degrees are held in a plain array.  The vertices are kept
+// in degree buckets (doubly-linked lists, built once from the counting sort of
+// LAGr_SortByDegreeBuckets).  The first frontier of each level is its bucket,
+// and the next level is found by advancing a cursor to the next non-empty
+// bucket, so no level scans all n vertices.  Removing a frontier decrements
+// the degrees of its neighbors in parallel with atomic updates; a neighbor
+// enters the next frontier when its degree drops to the level, and otherwise
+// moves to the bucket of its new degree.  The total work is O(n+e) plus the
+// largest degree.  This method temporarily unpacks G->A and packs it back, so
+// G->A must not be used by another thread at the same time.
+
 #define LG_FREE_WORK                \
 {                                   \
     GrB_free (&deg) ;               \
@@ -20,104 +41,71 @@
 {                                   \
     LG_FREE_WORK                    \
     GrB_free (decomp) ;             \
-}                                   
+}
 
 #include "LG_internal.h"
+#include "LAGraphX.h"
 
+//------------------------------------------------------------------------------
+// kcore_peel: level-by-level peeling with GraphBLAS
+//------------------------------------------------------------------------------
 
-int LAGraph_KCore_All       
+static int kcore_peel
 (
     // outputs:
     GrB_Vector *decomp,     // kcore decomposition
     uint64_t *kmax,
     // inputs:
-    LAGraph_Graph G,            // input graph
+    LAGraph_Graph G,        // input graph
+    GrB_Type int_type,      // GrB_INT32 or GrB_INT64
     char *msg
 )
 {
-    LG_CLEAR_MSG ;
-
-    // declare items
-    GrB_Matrix A = NULL;
-    GrB_Vector deg = NULL, q = NULL, done = NULL, delta = NULL;
-
-    LG_ASSERT (decomp != NULL, GrB_NULL_POINTER) ;
-    (*decomp) = NULL ;
-    
-    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
-
-    if (G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
-       (G->kind == LAGraph_ADJACENCY_DIRECTED &&
-        G->is_symmetric_structure == LAGraph_TRUE))
-    {
-         // the structure of A is known to be symmetric
-        A = G->A ;
-    }
-    else
-    {
-        // A is not known to be symmetric
-        LG_ASSERT_MSG (false, -1005, "G->A must be symmetric") ;
-    }
-
-    // no self edges can be present
-    LG_ASSERT_MSG (G->nself_edges == 0, -1004, "G->nself_edges must be zero") ;
+    GrB_Matrix A = G->A ;
+    GrB_Vector deg = NULL, q = NULL, done = NULL, delta = NULL ;
 
     //create work scalars
     uint64_t level = 0; //don't set at 1 in case of empty graph getting returned as kmax = 1
-    GrB_Index n, todo, nvals, maxDeg ;
+    GrB_Index n, todo, nvals ;
+    int64_t mindeg ;
     GRB_TRY (GrB_Matrix_nrows(&n, A)) ;
 
-    //create deg vector using out_degree property
-    LG_TRY (LAGraph_Cached_OutDegree(G, msg)) ; 
-
-    GRB_TRY (GrB_Vector_dup(&deg, G->out_degree)) ; //original deg vector is technically 1-core since 0 is omitted
+    //create deg vector from the out_degree property; the original deg vector
+    //is technically the 1-core since 0 is omitted
+    GRB_TRY (GrB_Vector_new(&deg, int_type, n)) ;
+    GRB_TRY (GrB_assign (deg, G->out_degree, NULL, G->out_degree, GrB_ALL, n, NULL)) ;
     GRB_TRY (GrB_Vector_nvals(&todo, deg)) ; //use todo instead of n since some values are omitted (1-core)
-    
-    //retrieve the max degree level of the graph
-    GRB_TRY (GrB_reduce(&maxDeg, GrB_NULL, GrB_MAX_MONOID_INT64, G->out_degree, GrB_NULL)) ;
-
-    //select int type for work vectors and semirings
-    GrB_Type int_type  = (maxDeg > INT32_MAX) ? GrB_INT64 : GrB_INT32 ; 
 
     GRB_TRY (GrB_Vector_new(&q, int_type, n));
     GRB_TRY (GrB_Vector_new(&done, GrB_BOOL, n)) ;
     GRB_TRY (GrB_Vector_new(&delta, int_type, n)) ;
-    //set output to int64
     GRB_TRY (GrB_Vector_new(decomp, int_type, n)) ;
 
-    //change deg vector to int32 if needed
-    if(int_type == GrB_INT32){
-        GRB_TRY (GrB_Vector_new(&deg, int_type, n)) ;
-        GRB_TRY (GrB_assign (deg, G->out_degree, NULL, G->out_degree, GrB_ALL, n, NULL)) ;
-    }
-    
     // determine semiring types
-    GrB_IndexUnaryOp valueEQ = (maxDeg > INT32_MAX) ? GrB_VALUEEQ_INT64 : GrB_VALUEEQ_INT32 ;
-    GrB_IndexUnaryOp valueLE = (maxDeg > INT32_MAX) ? GrB_VALUELE_INT64 : GrB_VALUELE_INT32 ;  
-    GrB_BinaryOp minus_op = (maxDeg > INT32_MAX) ? GrB_MINUS_INT64 : GrB_MINUS_INT32 ; 
-    GrB_Semiring semiring = (maxDeg > INT32_MAX) ? LAGraph_plus_one_int64 : LAGraph_plus_one_int32 ; 
-    
-#if LG_SUITESPARSE
-    GRB_TRY (GxB_set (done, GxB_SPARSITY_CONTROL, GxB_BITMAP + GxB_FULL)) ;    // try this
-    //GRB_TRY (GxB_set (*decomp, GxB_SPARSITY_CONTROL, GxB_BITMAP + GxB_FULL)) ; // try this ... likely not needed...
+    GrB_IndexUnaryOp valueLE = (int_type == GrB_INT64) ? GrB_VALUELE_INT64 : GrB_VALUELE_INT32 ;
+    GrB_BinaryOp minus_op = (int_type == GrB_INT64) ? GrB_MINUS_INT64 : GrB_MINUS_INT32 ;
+    GrB_Semiring semiring = (int_type == GrB_INT64) ? LAGraph_plus_one_int64 : LAGraph_plus_one_int32 ;
+
+#if LAGRAPH_SUITESPARSE
+    GRB_TRY (GxB_set (done, GxB_SPARSITY_CONTROL, GxB_BITMAP + GxB_FULL)) ;
 #endif
 
-    //printf ("\n================================== COMPUTING GrB_KCORE: ==================================\n") ;
-    while(todo > 0){ 
-        //printf("Level: %ld, todo: %ld\n", level, todo) ;
-        level++; 
-        // Creating q 
-        GRB_TRY (GrB_select (q, GrB_NULL, GrB_NULL, valueEQ, deg, level, GrB_NULL)) ; // get all nodes with degree = level
-        GRB_TRY (GrB_Vector_nvals(&nvals, q));
+    while(todo > 0){
+        // skip to the next level at which a vertex is removed: no vertex
+        // remains with a degree less than mindeg
+        GRB_TRY (GrB_reduce (&mindeg, NULL, GrB_MIN_MONOID_INT64, deg, NULL)) ;
+        level = LAGRAPH_MAX (level + 1, (uint64_t) mindeg) ;
 
-        //Assign values of deg into decomp (output)
-        GRB_TRY (GrB_assign (*decomp, deg, NULL, level, GrB_ALL, n, GrB_NULL)) ; 
+        // Creating q: all nodes with degree <= level
+        GRB_TRY (GrB_select (q, GrB_NULL, GrB_NULL, valueLE, deg, level, GrB_NULL)) ;
+        GRB_TRY (GrB_Vector_nvals(&nvals, q));
 
-        int round = 0;
         // while q not empty
         while(nvals > 0){
             // Decrease todo by number of nvals
             todo = todo - nvals ;
+            //nodes in q have a core number of level
+            GRB_TRY (GrB_assign (*decomp, q, NULL, level, GrB_ALL, n, GrB_DESC_S)) ;
             //add anything in q as true into the done list
             GRB_TRY (GrB_assign (done, q, NULL, (bool) true, GrB_ALL, n, GrB_DESC_S)) ; //structure to take care of 0-node cases
 
@@ -125,13 +113,12 @@ int LAGraph_KCore_All
             GRB_TRY (GrB_vxm (delta, GrB_NULL, GrB_NULL, semiring, q, A, GrB_NULL));
 
             // Create new deg vector (keep anything not in done vector w/ replace command)
-            GRB_TRY (GrB_eWiseAdd(deg, done, GrB_NULL, minus_op, deg, delta, GrB_DESC_RSC /* try GrB_DESC_RSC */)) ;
+            GRB_TRY (GrB_eWiseAdd(deg, done, GrB_NULL, minus_op, deg, delta, GrB_DESC_RSC)) ;
 
-            // Update q, set new nvals 
+            // Update q, set new nvals
             GRB_TRY (GrB_select (q, GrB_NULL, GrB_NULL, valueLE, deg, level, GrB_NULL)) ;
 
             GRB_TRY (GrB_Vector_nvals(&nvals, q)) ;
-            round++;
         }
     }
     //set kmax
@@ -141,3 +128,367 @@ int LAGraph_KCore_All
     return (GrB_SUCCESS) ;
 }
 
+//------------------------------------------------------------------------------
+// kcore_bucket: parallel bucket-based peeling
+//------------------------------------------------------------------------------
+
+#if LAGRAPH_SUITESPARSE
+
+#undef  LG_FREE_WORK
+#define LG_FREE_WORK                                \
+{                                                   \
+    LAGraph_Free ((void **) &D, NULL) ;             \
+    LAGraph_Free ((void **) &core, NULL) ;          \
+    LAGraph_Free ((void **) &F, NULL) ;             \
+    LAGraph_Free ((void **) &Fnext, NULL) ;         \
+    LAGraph_Free ((void **) &P, NULL) ;             \
+    LAGraph_Free ((void **) &Bucket, NULL) ;        \
+    LAGraph_Free ((void **) &head, NULL) ;          \
+    LAGraph_Free ((void **) &next, NULL) ;          \
+    LAGraph_Free ((void **) &prev, NULL) ;          \
+    LAGraph_Free ((void **) &B, NULL) ;             \
+}
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL                                 \
+{                                                   \
+    LG_FREE_WORK ;                                  \
+    GrB_free (decomp) ;                             \
+}
+
+// unlink v from its bucket B [v]
+#define LG_BUCKET_REMOVE(v)                                                 \
+{                                                                           \
+    int64_t vp = prev [v], vn = next [v] ;                                  \
+    if (vp >= 0) next [vp] = vn ; else head [B [v]] = vn ;                  \
+    if (vn >= 0) prev [vn] = vp ;                                           \
+    B [v] = -1 ;                                                            \
+}
+
+// link v into the bucket for degree d
+#define LG_BUCKET_INSERT(v,d)                                               \
+{                                                                           \
+    int64_t hd = head [d] ;                                                 \
+    next [v] = hd ;                                                         \
+    prev [v] = -1 ;                                                         \
+    if (hd >= 0) prev [hd] = v ;                                            \
+    head [d] = v ;                                                          \
+    B [v] = d ;                                                             \
+}
+
+static int kcore_bucket
+(
+    // outputs:
+    GrB_Vector *decomp,     // kcore decomposition
+    uint64_t *kmax,
+    // inputs:
+    LAGraph_Graph G,        // input graph
+    GrB_Type int_type,      // GrB_INT32 or GrB_INT64
+    char *msg
+)
+{
+    GrB_Matrix A = G->A ;
+    int64_t *D = NULL, *core = NULL, *F = NULL, *Fnext = NULL ;
+    int64_t *P = NULL, *Bucket = NULL, *head = NULL, *next = NULL,
+        *prev = NULL, *B = NULL ;
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+
+    int nthreads_outer, nthreads_inner ;
+    LG_TRY (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+    int nthreads = nthreads_outer * nthreads_inner ;
+
+    //--------------------------------------------------------------------------
+    // sort the vertices into degree buckets
+    //--------------------------------------------------------------------------
+
+    // Each bucket d is a doubly-linked list of the vertices that remain with
+    // degree d, in head [d], next, and prev.  B [v] is the bucket that holds
+    // v, or -1 if v is not in a bucket.  The buckets are built from the
+    // counting sort of LAGr_SortByDegreeBuckets.
+
+    int64_t nbuckets ;
+    LG_TRY (LAGr_SortByDegreeBuckets (&P, &Bucket, &nbuckets, G, true, true,
+        msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &head, nbuckets, sizeof (int64_t),
+        msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &next, n, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &prev, n, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &B, n, sizeof (int64_t), msg)) ;
+
+    int64_t d ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1024)
+    for (d = 0 ; d < nbuckets ; d++)
+    {
+        int64_t pstart = Bucket [d], pend = Bucket [d+1] ;
+        head [d] = (pstart < pend) ? P [pstart] : -1 ;
+        for (int64_t k = pstart ; k < pend ; k++)
+        {
+            int64_t v = P [k] ;
+            prev [v] = (k > pstart) ? P [k-1] : -1 ;
+            next [v] = (k < pend-1) ? P [k+1] : -1 ;
+            B [v] = d ;
+        }
+    }
+    LAGraph_Free ((void **) &Bucket, NULL) ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace
+    //--------------------------------------------------------------------------
+
+    // D [v] is the degree of v in the graph that remains.  core [v] is the
+    // core number of v, or -1 if v has not yet been removed.  P is reused to
+    // hold the vertices whose degree changes when a frontier is removed.
+
+    LG_TRY (LAGraph_Malloc ((void **) &D, n, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &core, n, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &F, n, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Fnext, n, sizeof (int64_t), msg)) ;
+    int64_t *Touched = P ;
+
+    //--------------------------------------------------------------------------
+    // unpack A in CSR format, to access its pattern
+    //--------------------------------------------------------------------------
+
+    // A is held by row (see LAGraph_CheckGraph).  No error can occur between
+    // the unpack and the pack, below.
+
+    void *Ax ;
+    GrB_Index *Ap, *Aj, Ap_size, Aj_size, Ax_size ;
+    bool A_jumbled, A_iso ;
+    GRB_TRY (GxB_Matrix_unpack_CSR (A, &Ap, &Aj, &Ax,
+        &Ap_size, &Aj_size, &Ax_size, &A_iso, &A_jumbled, NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // peel the vertices
+    //--------------------------------------------------------------------------
+
+    int64_t v, todo = 0 ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(+:todo)
+    for (v = 0 ; v < n ; v++)
+    {
+        D [v] = Ap [v+1] - Ap [v] ;
+        core [v] = (D [v] == 0) ? 0 : -1 ;
+        todo += (D [v] > 0) ;
+    }
+
+    // Invariant: at the start of each level, every vertex that remains has a
+    // degree greater than the prior level, and is in the bucket of its
+    // degree.  Vertices of degree zero stay in bucket 0 and are never peeled.
+
+    int64_t level = 0 ;
+    while (todo > 0)
+    {
+
+        //----------------------------------------------------------------------
+        // skip to the next level at which a vertex is removed
+        //----------------------------------------------------------------------
+
+        level++ ;
+        while (head [level] < 0) level++ ;
+
+        //----------------------------------------------------------------------
+        // the first frontier of this level is its bucket
+        //----------------------------------------------------------------------
+
+        int64_t nf = 0 ;
+        for (v = head [level] ; v >= 0 ; v = next [v])
+        {
+            F [nf++] = v ;
+            B [v] = -1 ;
+        }
+        head [level] = -1 ;
+
+        //----------------------------------------------------------------------
+        // remove the frontier, until the level is done
+        //----------------------------------------------------------------------
+
+        while (nf > 0)
+        {
+            todo -= nf ;
+            int64_t k, nnext = 0, ntouched = 0 ;
+            #pragma omp parallel for num_threads(nthreads) schedule(dynamic,64)
+            for (k = 0 ; k < nf ; k++)
+            {
+                int64_t i = F [k] ;
+                core [i] = level ;
+                for (GrB_Index p = Ap [i] ; p < Ap [i+1] ; p++)
+                {
+                    // the degree of a vertex that has been removed, or is in
+                    // the frontier, is at most level, and is left unchanged
+                    int64_t u = Aj [p] ;
+                    if ((int64_t) LG_ATOMIC_READ_UINT64 (&D [u]) <= level)
+                    {
+                        continue ;
+                    }
+                    int64_t du = LG_ATOMIC_FETCH_ADD_INT64 (&D [u], -1) ;
+                    if (du == B [u])
+                    {
+                        // the first decrement of u in this round; u must
+                        // move to another bucket.  B is not modified here.
+                        Touched [LG_ATOMIC_FETCH_ADD_INT64 (&ntouched, 1)] =
+                            u ;
+                    }
+                    if (du == level + 1)
+                    {
+                        // u just dropped to this level; it joins the frontier
+                        Fnext [LG_ATOMIC_FETCH_ADD_INT64 (&nnext, 1)] = u ;
+                    }
+                }
+            }
+
+            // move each vertex whose degree changed to its new bucket, or
+            // out of the buckets if it has joined the next frontier
+            for (k = 0 ; k < ntouched ; k++)
+            {
+                int64_t u = Touched [k] ;
+                LG_BUCKET_REMOVE (u) ;
+                if (D [u] > level) LG_BUCKET_INSERT (u, D [u]) ;
+            }
+
+            int64_t *W = F ; F = Fnext ; Fnext = W ;
+            nf = nnext ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // pack A back, unchanged
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GxB_Matrix_pack_CSR (A, &Ap, &Aj, &Ax, Ap_size, Aj_size,
+        Ax_size, A_iso, A_jumbled, NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // construct the result
+    //--------------------------------------------------------------------------
+
+    // vertices with no edges do not appear in the result.  F is used for the
+    // list of vertices, and D for their core numbers.
+    int64_t nv = 0 ;
+    for (v = 0 ; v < n ; v++)
+    {
+        if (core [v] > 0)
+        {
+            F [nv] = v ;
+            D [nv] = core [v] ;
+            nv++ ;
+        }
+    }
+    GRB_TRY (GrB_Vector_new (decomp, int_type, n)) ;
+    if (int_type == GrB_INT64)
+    {
+        GRB_TRY (GrB_Vector_build_INT64 (*decomp, (GrB_Index *) F, D, nv,
+            NULL)) ;
+    }
+    else
+    {
+        // D is no longer needed as int64_t; copy it in place to int32_t
+        int32_t *D32 = (int32_t *) D ;
+        for (int64_t k = 0 ; k < nv ; k++)
+        {
+            D32 [k] = (int32_t) D [k] ;
+        }
+        GRB_TRY (GrB_Vector_build_INT32 (*decomp, (GrB_Index *) F, D32, nv,
+            NULL)) ;
+    }
+
+    (*kmax) = level ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+// LAGraph_KCore_All_ByMethod
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL ;
+
+int LAGraph_KCore_All_ByMethod
+(
+    // outputs:
+    GrB_Vector *decomp,     // kcore decomposition
+    uint64_t *kmax,
+    // inputs:
+    LAGraph_Graph G,            // input graph
+    LAGraph_KCore_Method *method,   // input/output: method to use
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+
+    LG_ASSERT (decomp != NULL && kmax != NULL, GrB_NULL_POINTER) ;
+    (*decomp) = NULL ;
+
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+
+    if (G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+       (G->kind == LAGraph_ADJACENCY_DIRECTED &&
+        G->is_symmetric_structure == LAGraph_TRUE))
+    {
+         // the structure of A is known to be symmetric
+    }
+    else
+    {
+        // A is not known to be symmetric
+        LG_ASSERT_MSG (false, -1005, "G->A must be symmetric") ;
+    }
+
+    // no self edges can be present
+    LG_ASSERT_MSG (G->nself_edges == 0, -1004, "G->nself_edges must be zero") ;
+
+    LAGraph_KCore_Method m = (method == NULL) ? LAGraph_KCore_AutoMethod
+        : (*method) ;
+    LG_ASSERT_MSG (m == LAGraph_KCore_AutoMethod || m == LAGraph_KCore_Peel
+        || m == LAGraph_KCore_Bucket, GrB_INVALID_VALUE,
+        "method is invalid") ;
+    if (m == LAGraph_KCore_AutoMethod)
+    {
+        m = LAGRAPH_SUITESPARSE ? LAGraph_KCore_Bucket : LAGraph_KCore_Peel ;
+    }
+    LG_ASSERT_MSG (LAGRAPH_SUITESPARSE || m == LAGraph_KCore_Peel,
+        GrB_NOT_IMPLEMENTED, "bucket method requires SuiteSparse:GraphBLAS") ;
+
+    //create deg vector using out_degree property
+    LG_TRY (LAGraph_Cached_OutDegree(G, msg)) ;
+
+    //retrieve the max degree level of the graph, and select the int type
+    //for work vectors and semirings
+    GrB_Index maxDeg ;
+    GRB_TRY (GrB_reduce(&maxDeg, GrB_NULL, GrB_MAX_MONOID_INT64, G->out_degree, GrB_NULL)) ;
+    GrB_Type int_type  = (maxDeg > INT32_MAX) ? GrB_INT64 : GrB_INT32 ;
+
+    #if LAGRAPH_SUITESPARSE
+    if (m == LAGraph_KCore_Bucket)
+    {
+        LG_TRY (kcore_bucket (decomp, kmax, G, int_type, msg)) ;
+    }
+    else
+    #endif
+    {
+        LG_TRY (kcore_peel (decomp, kmax, G, int_type, msg)) ;
+    }
+
+    if (method != NULL) (*method) = m ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_KCore_All
+//------------------------------------------------------------------------------
+
+int LAGraph_KCore_All
+(
+    // outputs:
+    GrB_Vector *decomp,     // kcore decomposition
+    uint64_t *kmax,
+    // inputs:
+    LAGraph_Graph G,            // input graph
+    char *msg
+)
+{
+    return (LAGraph_KCore_All_ByMethod (decomp, kmax, G, NULL, msg)) ;
+}
@@ -43,14 +43,24 @@
 //      int result = LAGraph_AllKTruss (&Cset, &kmax, ntris, nedges,
 //          nstepss, G, msg) ;
 
+// The support of each edge is computed just once, for the 3-truss.  After
+// that, the (k+1)-truss is computed from the k-truss by peeling edges, and
+// the support of the edges that remain is reduced by the number of triangles
+// lost with the removed edges, as in LAGraph_TrussDecomposition.  To find the
+// truss number of each edge without keeping all k-trusses, use
+// LAGraph_TrussDecomposition instead.
+
 // todo: add experimental/benchmark/ktruss_demo.c to benchmark k-truss
 // and all-k-truss
 
-// todo: consider LAGraph_KTrussNext to compute the (k+1)-truss from the
-// k-truss
+#define LG_FREE_WORK                        \
+{                                           \
+    GrB_free (&R) ;                         \
+}
 
 #define LG_FREE_ALL                         \
 {                                           \
+    LG_FREE_WORK ;                          \
     for (int64_t kk = 3 ; kk <= k ; kk++)   \
     {                                       \
         GrB_free (&(Cset [kk])) ;           \
@@ -84,6 +94,7 @@ int LAGraph_AllKTruss   // compute all k-trusses of a graph
 
     LG_CLEAR_MSG ;
     int64_t k = 0 ;
+    GrB_Matrix R = NULL ;
     LG_ASSERT (Cset != NULL && nstepss != NULL, GrB_NULL_POINTER) ;
     LG_ASSERT (kmax != NULL && ntris != NULL, GrB_NULL_POINTER) ;
     LG_ASSERT (nedges != NULL, GrB_NULL_POINTER) ;
@@ -127,26 +138,28 @@ int LAGraph_AllKTruss   // compute all k-trusses of a graph
     GrB_Matrix S = G->A ;
     GRB_TRY (GrB_Matrix_nrows (&n, S)) ;
     GRB_TRY (GrB_Matrix_new (&(Cset [k]), GrB_UINT32, n, n)) ;
+    GRB_TRY (GrB_Matrix_new (&R, GrB_UINT32, n, n)) ;
     GrB_Matrix C = Cset [k] ;
-    GrB_Index nvals, nvals_last ;
-    GRB_TRY (GrB_Matrix_nvals (&nvals_last, S)) ;
+    GrB_Index nvals, nremoved ;
     int64_t nsteps = 0 ;
 
+    // C{S} = S*S', the support of each edge
+    GRB_TRY (GrB_mxm (C, S, NULL, LAGraph_plus_one_uint32, S, S,
+        GrB_DESC_ST1)) ;
+    GRB_TRY (GrB_Matrix_nvals (&nvals, C)) ;
+
     //--------------------------------------------------------------------------
     // find all k-trusses
     //--------------------------------------------------------------------------
 
     while (true)
     {
-        // C{S} = S*S'
-        GRB_TRY (GrB_mxm (C, S, NULL, LAGraph_plus_one_uint32, S, S,
-            GrB_DESC_RST1)) ;
-        // keep entries in C that are >= k-2
-        GRB_TRY (GrB_select (C, NULL, NULL, GrB_VALUEGE_UINT32, C, k-2, NULL)) ;
+        // R = edges with support less than k-2
+        GRB_TRY (GrB_select (R, NULL, NULL, GrB_VALUELT_UINT32, C, k-2,
+            NULL)) ;
+        GRB_TRY (GrB_Matrix_nvals (&nremoved, R)) ;
         nsteps++ ;
-        // check if k-truss has been found
-        GRB_TRY (GrB_Matrix_nvals (&nvals, C)) ;
-        if (nvals == nvals_last)
+        if (nremoved == 0)
         {
             // k-truss has been found
             int64_t nt = 0 ;
@@ -159,19 +172,28 @@ int LAGraph_AllKTruss   // compute all k-trusses of a graph
             {
                 // this is the last k-truss
                 (*kmax) = k ;
+                LG_FREE_WORK ;
                 return (GrB_SUCCESS) ;
             }
-            S = C ;             // S = current k-truss for k+1 iteration
-            k++ ;               // advance to the next k-tryss
-            GRB_TRY (GrB_Matrix_new (&(Cset [k]), GrB_UINT32, n, n)) ;
-            C = Cset [k] ;      // C = new matrix for next k-truss
+            // C = current k-truss, to be peeled for the k+1 iteration
+            k++ ;
+            GRB_TRY (GrB_Matrix_dup (&(Cset [k]), C)) ;
+            C = Cset [k] ;
         }
         else
         {
-            // advance to the next step, still computing the current k-truss
-            nvals_last = nvals ;
-            S = C ;
+            // remove the edges in R, and update the support of the edges
+            // that remain: C{C} -= R*C + C*R + R*R
+            GRB_TRY (GrB_select (C, NULL, NULL, GrB_VALUEGE_UINT32, C, k-2,
+                NULL)) ;
+            nvals -= nremoved ;
+            if (nvals == 0) continue ;
+            GRB_TRY (GrB_mxm (C, C, GrB_MINUS_UINT32, LAGraph_plus_one_uint32,
+                R, C, GrB_DESC_S)) ;
+            GRB_TRY (GrB_mxm (C, C, GrB_MINUS_UINT32, LAGraph_plus_one_uint32,
+                C, R, GrB_DESC_S)) ;
+            GRB_TRY (GrB_mxm (C, C, GrB_MINUS_UINT32, LAGraph_plus_one_uint32,
+                R, R, GrB_DESC_S)) ;
         }
     }
 }
-
@@ -0,0 +1,361 @@
+//------------------------------------------------------------------------------
+// LAGraph_Coloring: parallel greedy vertex coloring
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2021 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+// See additional acknowledgments in the LICENSE file,
+// or contact permission@sei.cmu.edu for the full terms.
+
+//------------------------------------------------------------------------------
+
+#define LG_FREE_WORK                                \
+{                                                   \
+    GrB_free (&neighbor_max) ;                      \
+    GrB_free (&new_members) ;                       \
+    GrB_free (&new_colors) ;                        \
+    GrB_free (&candidates) ;                        \
+    GrB_free (&empty) ;                             \
+    GrB_free (&Seed) ;                              \
+    GrB_free (&score) ;                             \
+    GrB_free (&base) ;                              \
+    GrB_free (&N) ;                                 \
+    GrB_free (&D) ;                                 \
+    LAGraph_Free ((void **) &Mi, NULL) ;            \
+    LAGraph_Free ((void **) &Ni, NULL) ;            \
+    LAGraph_Free ((void **) &Nx, NULL) ;            \
+    LAGraph_Free ((void **) &Np, NULL) ;            \
+    LAGraph_Free ((void **) &Mx, NULL) ;            \
+}
+
+#define LG_FREE_ALL                                 \
+{                                                   \
+    LG_FREE_WORK ;                                  \
+    GrB_free (&color) ;                             \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+// A variant of the Jones-Plassmann algorithm [Jones and Plassmann 1993], with
+// the same random scoring and neighbor-max scheme as
+// LAGraph_MaximalIndependentSet.
+
+// Each node is given a fixed priority.  In each round, every uncolored node
+// whose priority is greater than that of all of its uncolored neighbors is
+// colored.  These nodes form an independent set, so they can all be colored
+// at the same time.  The priority is chosen by the method:
+
+//  LAGraph_Coloring_JonesPlassmann:  a random priority.
+//  LAGraph_Coloring_LargestDegreeFirst:  the degree of the node, with ties
+//      broken at random.  This often uses fewer colors, but can take more
+//      rounds.
+
+// If minimize is false, all nodes colored in round r are given the color r,
+// so each round is just a handful of GraphBLAS operations.  If minimize is
+// true, each node is given the smallest color not used by any of its
+// neighbors (first-fit), which uses fewer colors: the colors of the neighbors
+// of the new nodes are found with a single masked extract and product, sorted
+// with LG_msort2, and scanned in parallel.
+
+// On output, color(i) is the color of node i, in the range 1 to ncolors, and
+// color is a full GrB_INT64 vector.  Singletons have the color 1.
+
+// The graph must be symmetric, with no self edges, and G->out_degree must be
+// present (as for LAGraph_MaximalIndependentSet).
+
+int LAGraph_Coloring
+(
+    // outputs:
+    GrB_Vector *color_handle,   // color(i) is the color of node i
+    int64_t *ncolors,           // # of colors used
+    // inputs:
+    LAGraph_Graph G,            // input graph
+    LAGraph_Coloring_Method method,     // how to prioritize the nodes
+    bool minimize,              // if true, use first-fit to reduce the colors
+    uint64_t seed,              // random number seed
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Vector color = NULL ;           // color of each node (output vector)
+    GrB_Vector score = NULL ;           // priority of each candidate node
+    GrB_Vector base = NULL ;            // integer part of the priority
+    GrB_Vector neighbor_max = NULL ;    // value of max neighbor score
+    GrB_Vector new_members = NULL ;     // nodes colored in this round
+    GrB_Vector new_colors = NULL ;      // their colors, if minimize is true
+    GrB_Vector candidates = NULL ;      // nodes not yet colored
+    GrB_Vector empty = NULL ;           // an empty vector
+    GrB_Vector Seed = NULL ;            // random number seed vector
+    GrB_Matrix N = NULL ;               // colors of neighbors of new members
+    GrB_Matrix D = NULL ;               // D = diag (color)
+    GrB_Index *Mi = NULL, *Ni = NULL, *Np = NULL ;
+    int64_t *Nx = NULL, *Mx = NULL ;
+    GrB_Matrix A ;                      // G->A, the adjacency matrix
+    GrB_Index n ;                       // # of nodes
+
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    LG_ASSERT (color_handle != NULL && ncolors != NULL, GrB_NULL_POINTER) ;
+    (*color_handle) = NULL ;
+    LG_ASSERT_MSG (method == LAGraph_Coloring_JonesPlassmann ||
+        method == LAGraph_Coloring_LargestDegreeFirst, GrB_INVALID_VALUE,
+        "method is invalid") ;
+
+    if (G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+       (G->kind == LAGraph_ADJACENCY_DIRECTED &&
+        G->is_symmetric_structure == LAGraph_TRUE))
+    {
+        // the structure of A is known to be symmetric
+        A = G->A ;
+    }
+    else
+    {
+        // A is not known to be symmetric
+        LG_ASSERT_MSG (false, -105, "G->A must be symmetric") ;
+    }
+
+    LG_ASSERT_MSG (G->out_degree != NULL, -106,
+        "G->out_degree must be defined") ;
+    LG_ASSERT_MSG (G->nself_edges == 0, -107, "G->nself_edges must be zero") ;
+
+    int nthreads_outer, nthreads_inner ;
+    LG_TRY (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+    int nthreads = nthreads_outer * nthreads_inner ;
+
+    //--------------------------------------------------------------------------
+    // initializations
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+    GRB_TRY (GrB_Vector_new (&neighbor_max, GrB_FP64, n)) ;
+    GRB_TRY (GrB_Vector_new (&base, GrB_FP64, n)) ;
+    GRB_TRY (GrB_Vector_new (&new_members, GrB_BOOL, n)) ;
+    GRB_TRY (GrB_Vector_new (&new_colors, GrB_INT64, n)) ;
+    GRB_TRY (GrB_Vector_new (&candidates, GrB_BOOL, n)) ;
+    GRB_TRY (GrB_Vector_new (&empty, GrB_BOOL, n)) ;
+    GRB_TRY (GrB_Vector_new (&Seed, GrB_UINT64, n)) ;
+    GRB_TRY (GrB_Vector_new (&score, GrB_FP64, n)) ;
+    GRB_TRY (GrB_Vector_new (&color, GrB_INT64, n)) ;
+
+    // all nodes of degree zero are singletons, with color 1, and all other
+    // nodes are candidates
+    // candidates{out_degree} = true
+    GRB_TRY (GrB_assign (candidates, G->out_degree, NULL, (bool) true,
+        GrB_ALL, n, GrB_DESC_S)) ;
+    // color{!out_degree} = 1
+    GRB_TRY (GrB_assign (color, G->out_degree, NULL, (int64_t) 1, GrB_ALL, n,
+        GrB_DESC_SC)) ;
+
+    // the priority of each candidate is score = base + Seed * 2^(-64), where
+    // base is 1 (Jones-Plassmann) or the degree of the node.  The random part
+    // is less than one, so it only breaks ties between nodes of equal degree.
+    if (method == LAGraph_Coloring_JonesPlassmann)
+    {
+        GRB_TRY (GrB_assign (base, candidates, NULL, (double) 1, GrB_ALL, n,
+            GrB_DESC_S)) ;
+    }
+    else
+    {
+        GRB_TRY (GrB_assign (base, NULL, NULL, G->out_degree, GrB_ALL, n,
+            NULL)) ;
+    }
+
+    // Seed{candidates} = 0, then create the random number seeds
+    GRB_TRY (GrB_assign (Seed, candidates, NULL, 0, GrB_ALL, n, GrB_DESC_S)) ;
+    LG_TRY (LAGraph_Random_Seed (Seed, seed, msg)) ;
+    const double scale = ldexp (1.0, -64) ;
+
+    //--------------------------------------------------------------------------
+    // color the nodes, one independent set at a time
+    //--------------------------------------------------------------------------
+
+    int nstall = 0 ;
+    bool rescore = true ;
+    int64_t round = 1 ;
+    GrB_Index ncandidates ;
+    GRB_TRY (GrB_Vector_nvals (&ncandidates, candidates)) ;
+    GrB_Index n1 = (GrB_Index) (0.04 * (double) n) ;
+
+    while (ncandidates > 0)
+    {
+
+        //----------------------------------------------------------------------
+        // compute the priority of each candidate
+        //----------------------------------------------------------------------
+
+        if (rescore)
+        {
+            // score = base + (double) Seed * 2^(-64), for all candidates
+            GRB_TRY (GrB_assign (score, NULL, NULL, Seed, GrB_ALL, n, NULL)) ;
+            GRB_TRY (GrB_apply (score, NULL, NULL, GrB_TIMES_FP64, score,
+                scale, NULL)) ;
+            GRB_TRY (GrB_eWiseMult (score, NULL, NULL, GrB_PLUS_FP64, score,
+                base, NULL)) ;
+            rescore = false ;
+        }
+
+        //----------------------------------------------------------------------
+        // find the candidates with a higher priority than their neighbors
+        //----------------------------------------------------------------------
+
+        // compute the max score of all candidate neighbors (only candidates
+        // have a score, so colored neighbors are excluded)
+        if (ncandidates < n1)
+        {
+            // push
+            // neighbor_max'{candidates,replace} = score' * A
+            GRB_TRY (GrB_vxm (neighbor_max, candidates, NULL,
+                GrB_MAX_FIRST_SEMIRING_FP64, score, A, GrB_DESC_RS)) ;
+        }
+        else
+        {
+            // pull
+            // neighbor_max{candidates,replace} = A * score
+            GRB_TRY (GrB_mxv (neighbor_max, candidates, NULL,
+                GrB_MAX_SECOND_SEMIRING_FP64, A, score, GrB_DESC_RS)) ;
+        }
+
+        // new_members = (score > neighbor_max), using set union so that nodes
+        // with no candidate neighbors fall through as true (since every
+        // score is at least 1)
+        GRB_TRY (GrB_eWiseAdd (new_members, NULL, NULL, GrB_GT_FP64,
+            score, neighbor_max, NULL)) ;
+
+        // drop explicit zeros from new_members
+        GRB_TRY (GrB_select (new_members, NULL, NULL, GrB_VALUEEQ_BOOL,
+            new_members, (bool) true, NULL)) ;
+
+        GrB_Index nm ;
+        GRB_TRY (GrB_Vector_nvals (&nm, new_members)) ;
+        if (nm == 0)
+        {
+            // Stall: this can only occur in the exceedingly rare case that 2
+            // adjacent nodes have the exact same score.  Try again with
+            // another random score.
+            nstall++ ;
+            LG_ASSERT_MSG (nstall <= 32, -111, "stall") ;
+            LG_TRY (LAGraph_Random_Next (Seed, msg)) ;
+            rescore = true ;
+            continue ;
+        }
+
+        //----------------------------------------------------------------------
+        // color the new members
+        //----------------------------------------------------------------------
+
+        if (!minimize)
+        {
+
+            // color{new_members} = round
+            GRB_TRY (GrB_assign (color, new_members, NULL, round, GrB_ALL, n,
+                GrB_DESC_S)) ;
+
+        }
+        else
+        {
+
+            // Mi = list of the new members
+            LG_TRY (LAGraph_Malloc ((void **) &Mi, nm, sizeof (GrB_Index),
+                msg)) ;
+            LG_TRY (LAGraph_Malloc ((void **) &Mx, nm, sizeof (int64_t),
+                msg)) ;
+            GRB_TRY (GrB_Vector_extractTuples_BOOL (Mi, NULL, &nm,
+                new_members)) ;
+
+            // N = A (Mi,:) * diag (color): N(k,j) is the color of node j,
+            // for each colored neighbor j of the kth new member
+            GrB_Index nnz ;
+            GRB_TRY (GrB_Matrix_diag (&D, color, 0)) ;
+            GRB_TRY (GrB_Matrix_new (&N, GrB_INT64, nm, n)) ;
+            GRB_TRY (GrB_extract (N, NULL, NULL, A, Mi, nm, GrB_ALL, n,
+                NULL)) ;
+            GRB_TRY (GrB_mxm (N, NULL, NULL, GrB_MIN_SECOND_SEMIRING_INT64,
+                N, D, NULL)) ;
+            GRB_TRY (GrB_free (&D)) ;
+            GRB_TRY (GrB_Matrix_nvals (&nnz, N)) ;
+
+            // sort the colors of the neighbors of each new member
+            LG_TRY (LAGraph_Malloc ((void **) &Ni, nnz, sizeof (GrB_Index),
+                msg)) ;
+            LG_TRY (LAGraph_Malloc ((void **) &Nx, nnz, sizeof (int64_t),
+                msg)) ;
+            LG_TRY (LAGraph_Calloc ((void **) &Np, nm+1, sizeof (GrB_Index),
+                msg)) ;
+            GRB_TRY (GrB_Matrix_extractTuples_INT64 (Ni, NULL, Nx, &nnz, N)) ;
+            GRB_TRY (GrB_free (&N)) ;
+            LG_TRY (LG_msort2 ((int64_t *) Ni, Nx, nnz, msg)) ;
+            for (int64_t p = 0 ; p < nnz ; p++)
+            {
+                Np [Ni [p] + 1]++ ;
+            }
+            for (int64_t k = 0 ; k < nm ; k++)
+            {
+                Np [k+1] += Np [k] ;
+            }
+
+            // each new member takes the smallest color not used by any of
+            // its neighbors
+            int64_t k ;
+            #pragma omp parallel for num_threads(nthreads) schedule(dynamic,256)
+            for (k = 0 ; k < nm ; k++)
+            {
+                int64_t c = 1 ;
+                for (int64_t p = Np [k] ; p < Np [k+1] ; p++)
+                {
+                    if (Nx [p] == c) c++ ;
+                    else if (Nx [p] > c) break ;
+                }
+                Mx [k] = c ;
+            }
+
+            // color{new_colors} = new_colors
+            GRB_TRY (GrB_Vector_clear (new_colors)) ;
+            GRB_TRY (GrB_Vector_build_INT64 (new_colors, Mi, Mx, nm, NULL)) ;
+            GRB_TRY (GrB_assign (color, new_colors, NULL, new_colors, GrB_ALL,
+                n, GrB_DESC_S)) ;
+
+            LAGraph_Free ((void **) &Mi, NULL) ;
+            LAGraph_Free ((void **) &Mx, NULL) ;
+            LAGraph_Free ((void **) &Ni, NULL) ;
+            LAGraph_Free ((void **) &Nx, NULL) ;
+            LAGraph_Free ((void **) &Np, NULL) ;
+        }
+        round++ ;
+
+        //----------------------------------------------------------------------
+        // remove the new members from the candidates
+        //----------------------------------------------------------------------
+
+        // candidates{new_members} = empty
+        GRB_TRY (GrB_assign (candidates, new_members, NULL, empty,
+            GrB_ALL, n, GrB_DESC_S)) ;
+
+        // sparsify the scores and seeds (just keep them for each candidate)
+        // score{candidates,replace} = score
+        GRB_TRY (GrB_assign (score, candidates, NULL, score, GrB_ALL, n,
+            GrB_DESC_RS)) ;
+        GRB_TRY (GrB_assign (Seed, candidates, NULL, Seed, GrB_ALL, n,
+            GrB_DESC_RS)) ;
+        GRB_TRY (GrB_Vector_nvals (&ncandidates, candidates)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    int64_t nc = 0 ;
+    if (n > 0)
+    {
+        GRB_TRY (GrB_reduce (&nc, NULL, GrB_MAX_MONOID_INT64, color, NULL)) ;
+    }
+    GRB_TRY (GrB_wait (color, GrB_MATERIALIZE)) ;
+    (*ncolors) = nc ;
+    (*color_handle) = color ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,363 @@
+//------------------------------------------------------------------------------
+// LAGraph_FW: Floyd-Warshall all-pairs shortest paths, blocked
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2021 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+// See additional acknowledgments in the LICENSE file,
+// or contact permission@sei.cmu.edu for the full terms.
+
+//------------------------------------------------------------------------------
+
+// LAGraph_FW: computes the length of the shortest path between all pairs of
+// nodes in a directed graph with n nodes, where G(i,j) is the weight of the
+// edge (i,j).  Entries not present in G are edges that do not exist.  The
+// result D is an n-by-n matrix where D(i,j) is the length of the shortest
+// path from node i to node j, and D(i,j) is not present if there is no such
+// path.  D(i,i) is zero, unless node i is on a negative-weight cycle, in
+// which case D(i,i) < 0 and the other entries of D are not meaningful.
+
+// D is computed in a dense n-by-n workspace, so this method is meant for
+// graphs (or subgraphs) that are dense enough that the all-pairs result
+// would be nearly dense anyway.  The workspace is split into square b-by-b
+// tiles, where b is chosen so that three tiles fit in the L2 cache.  For each
+// diagonal tile (kb,kb), in order:
+
+//  (1) the diagonal tile is updated with a plain Floyd-Warshall;
+//  (2) the tiles in row kb and column kb are updated from the diagonal tile,
+//      in parallel;
+//  (3) all other tiles (i,j) are updated with D(i,j) = min (D(i,j),
+//      D(i,kb) + D(kb,j)), in parallel.
+
+// The inner loop of each tile update is a min-plus rank-1 update of one row
+// of the tile, which the compiler vectorizes.
+
+// The type of D (returned in D_type) depends on the type of G:
+
+//  GrB_FP32: if G is GrB_FP32.
+//  GrB_INT64: if G is GrB_BOOL, GrB_INT8, GrB_INT16, GrB_INT32, GrB_UINT8,
+//      or GrB_UINT16.  Path lengths are computed in int64_t, so they cannot
+//      overflow, and an edge of weight INT32_MAX is not confused with the
+//      INT64_MAX that denotes "no path".  On a negative cycle the path
+//      lengths can decrease without bound; they saturate at LG_FW_INT64_MIN.
+//  GrB_FP64: otherwise.  Integers of 64 bits are typecast to double.
+
+//------------------------------------------------------------------------------
+
+#define LG_FREE_WORK                        \
+{                                           \
+    LAGraph_Free ((void **) &I, NULL) ;     \
+    LAGraph_Free ((void **) &J, NULL) ;     \
+    LAGraph_Free ((void **) &X, NULL) ;     \
+    LAGraph_Free ((void **) &Dx, NULL) ;    \
+}
+
+#define LG_FREE_ALL                         \
+{                                           \
+    LG_FREE_WORK ;                          \
+    GrB_free (D) ;                          \
+}
+
+#include "LG_internal.h"
+#include <LAGraphX.h>
+
+// size of the L2 cache, in bytes
+#define LG_FW_L2 (256 * 1024)
+
+// lower bound of int64_t path lengths: the sum of two of them cannot overflow
+#define LG_FW_INT64_MIN (-(((int64_t) 1) << 62))
+
+//------------------------------------------------------------------------------
+// LG_FW_KERNELS: Floyd-Warshall kernels for a given type T
+//------------------------------------------------------------------------------
+
+// fw_tile_T: C = min (C, A min.+ B), where C is m-by-q, A is m-by-p, and B is
+// p-by-q, all held in row-major form in Dx with leading dimension n.  C may
+// be the same tile as A and/or B, since k is the outer loop and the entries
+// on the diagonal of D are never positive.  An INF entry is an edge that does
+// not exist; it is never added to.  Each sum is clamped below at LO (-INFINITY
+// for the floating-point types).
+
+// fw_init_T: Dx = G in dense form, with zeros on the diagonal and INF
+// elsewhere.  If G has a self edge with negative weight, that weight is kept.
+
+// fw_T: blocked Floyd-Warshall on the n-by-n matrix held in Dx, with b-by-b
+// tiles.
+
+#define LG_FW_KERNELS(T, suffix, INF, LO)                                     \
+                                                                              \
+static void fw_tile_ ## suffix                                                \
+(                                                                             \
+    T *C, const T *A, const T *B,                                             \
+    int64_t m, int64_t p, int64_t q, int64_t n                                \
+)                                                                             \
+{                                                                             \
+    for (int64_t k = 0 ; k < p ; k++)                                         \
+    {                                                                         \
+        const T *Bk = B + k * n ;                                             \
+        for (int64_t i = 0 ; i < m ; i++)                                     \
+        {                                                                     \
+            T aik = A [i * n + k] ;                                           \
+            if (aik == INF) continue ;                                        \
+            T *Ci = C + i * n ;                                               \
+            _Pragma ("omp simd")                                              \
+            for (int64_t j = 0 ; j < q ; j++)                                 \
+            {                                                                 \
+                T bkj = Bk [j] ;                                              \
+                T cij = Ci [j] ;                                              \
+                T sij = (bkj == INF) ? INF : (aik + bkj) ;                    \
+                sij = (sij < LO) ? LO : sij ;                                 \
+                Ci [j] = (sij < cij) ? sij : cij ;                            \
+            }                                                                 \
+        }                                                                     \
+    }                                                                         \
+}                                                                             \
+                                                                              \
+static void fw_init_ ## suffix                                                \
+(                                                                             \
+    void *Dx_void, const GrB_Index *I, const GrB_Index *J,                    \
+    const void *X_void, int64_t n, int64_t nvals, int nthreads                \
+)                                                                             \
+{                                                                             \
+    T *Dx = (T *) Dx_void ;                                                   \
+    const T *X = (const T *) X_void ;                                         \
+    int64_t i ;                                                               \
+    _Pragma ("omp parallel for num_threads(nthreads) schedule(static)")       \
+    for (i = 0 ; i < n ; i++)                                                 \
+    {                                                                         \
+        T *Di = Dx + i * n ;                                                  \
+        for (int64_t j = 0 ; j < n ; j++)                                     \
+        {                                                                     \
+            Di [j] = INF ;                                                    \
+        }                                                                     \
+        Di [i] = 0 ;                                                          \
+    }                                                                         \
+    for (int64_t k = 0 ; k < nvals ; k++)                                     \
+    {                                                                         \
+        T *d = Dx + I [k] * n + J [k] ;                                       \
+        (*d) = LAGRAPH_MIN (*d, X [k]) ;                                      \
+    }                                                                         \
+}                                                                             \
+                                                                              \
+static void fw_ ## suffix (void *Dx_void, int64_t n, int64_t b, int nthreads) \
+{                                                                             \
+    T *Dx = (T *) Dx_void ;                                                   \
+    int64_t nb = (n + b - 1) / b ;                                            \
+    for (int64_t kb = 0 ; kb < nb ; kb++)                                     \
+    {                                                                         \
+        int64_t k0 = kb * b, kn = LAGRAPH_MIN (b, n - k0) ;                   \
+        T *Dkk = Dx + k0 * n + k0 ;                                           \
+                                                                              \
+        /* (1) the diagonal tile */                                           \
+        fw_tile_ ## suffix (Dkk, Dkk, Dkk, kn, kn, kn, n) ;                   \
+                                                                              \
+        /* (2) the tiles in row kb and column kb */                           \
+        int64_t t ;                                                           \
+        _Pragma ("omp parallel for num_threads(nthreads) schedule(dynamic,1)")\
+        for (t = 0 ; t < 2 * nb ; t++)                                        \
+        {                                                                     \
+            int64_t jb = t % nb ;                                             \
+            if (jb == kb) continue ;                                          \
+            int64_t j0 = jb * b, jn = LAGRAPH_MIN (b, n - j0) ;               \
+            if (t < nb)                                                       \
+            {                                                                 \
+                /* D(kb,jb) = min (D(kb,jb), D(kb,kb) min.+ D(kb,jb)) */      \
+                T *Dkj = Dx + k0 * n + j0 ;                                   \
+                fw_tile_ ## suffix (Dkj, Dkk, Dkj, kn, kn, jn, n) ;           \
+            }                                                                 \
+            else                                                              \
+            {                                                                 \
+                /* D(jb,kb) = min (D(jb,kb), D(jb,kb) min.+ D(kb,kb)) */      \
+                T *Djk = Dx + j0 * n + k0 ;                                   \
+                fw_tile_ ## suffix (Djk, Djk, Dkk, jn, kn, kn, n) ;           \
+            }                                                                 \
+        }                                                                     \
+                                                                              \
+        /* (3) all other tiles */                                             \
+        _Pragma ("omp parallel for num_threads(nthreads) schedule(dynamic,1)")\
+        for (t = 0 ; t < nb * nb ; t++)                                       \
+        {                                                                     \
+            int64_t ib = t / nb, jb = t % nb ;                                \
+            if (ib == kb || jb == kb) continue ;                              \
+            int64_t i0 = ib * b, in = LAGRAPH_MIN (b, n - i0) ;               \
+            int64_t j0 = jb * b, jn = LAGRAPH_MIN (b, n - j0) ;               \
+            fw_tile_ ## suffix (Dx + i0 * n + j0, Dx + i0 * n + k0,           \
+                Dx + k0 * n + j0, in, kn, jn, n) ;                            \
+        }                                                                     \
+    }                                                                         \
+}
+
+LG_FW_KERNELS (double,  fp64,  INFINITY, -INFINITY)
+LG_FW_KERNELS (float,   fp32,  INFINITY, -INFINITY)
+LG_FW_KERNELS (int64_t, int64, INT64_MAX, LG_FW_INT64_MIN)
+
+//------------------------------------------------------------------------------
+// LAGraph_FW
+//------------------------------------------------------------------------------
+
+GrB_Info LAGraph_FW
+(
+    const GrB_Matrix G,     // input graph, with edge weights
+    GrB_Matrix *D,          // output: D(i,j) is the shortest path from i to j
+    GrB_Type   *D_type      // output: type of D
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    char *msg = NULL ;
+    GrB_Index *I = NULL, *J = NULL ;
+    void *X = NULL, *Dx = NULL ;
+    LG_ASSERT (G != NULL && D != NULL && D_type != NULL, GrB_NULL_POINTER) ;
+    (*D) = NULL ;
+
+    GrB_Index n, ncols, nvals ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G)) ;
+    GRB_TRY (GrB_Matrix_ncols (&ncols, G)) ;
+    GRB_TRY (GrB_Matrix_nvals (&nvals, G)) ;
+    LG_ASSERT (n == ncols, GrB_INVALID_VALUE) ;
+
+    //--------------------------------------------------------------------------
+    // determine the type of D
+    //--------------------------------------------------------------------------
+
+    GrB_Type gtype, type ;
+    char gtype_name [LAGRAPH_MAX_NAME_LEN] ;
+    LG_TRY (LAGraph_Matrix_TypeName (gtype_name, G, msg)) ;
+    LG_TRY (LAGraph_TypeFromName (&gtype, gtype_name, msg)) ;
+    if (gtype == GrB_FP32)
+    {
+        type = GrB_FP32 ;
+    }
+    else if (gtype == GrB_BOOL  || gtype == GrB_INT8  || gtype == GrB_INT16 ||
+             gtype == GrB_INT32 || gtype == GrB_UINT8 || gtype == GrB_UINT16)
+    {
+        type = GrB_INT64 ;
+    }
+    else
+    {
+        type = GrB_FP64 ;
+    }
+    size_t tsize = (type == GrB_FP32) ? sizeof (float) : sizeof (double) ;
+
+    // tile size: three b-by-b tiles fit in the L2 cache
+    int64_t b = (int64_t) sqrt ((double) LG_FW_L2 / (3 * tsize)) ;
+    b = LAGRAPH_MAX (16, (b / 16) * 16) ;
+
+    int nthreads_outer, nthreads_inner ;
+    LG_TRY (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+    int nthreads = nthreads_outer * nthreads_inner ;
+
+    //--------------------------------------------------------------------------
+    // get the edges of G
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_Malloc ((void **) &I, LAGRAPH_MAX (nvals, 1),
+        sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &J, LAGRAPH_MAX (nvals, 1),
+        sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc (&X, LAGRAPH_MAX (nvals, 1), tsize, msg)) ;
+    if (type == GrB_FP64)
+    {
+        GRB_TRY (GrB_Matrix_extractTuples_FP64 (I, J, X, &nvals, G)) ;
+    }
+    else if (type == GrB_FP32)
+    {
+        GRB_TRY (GrB_Matrix_extractTuples_FP32 (I, J, X, &nvals, G)) ;
+    }
+    else
+    {
+        GRB_TRY (GrB_Matrix_extractTuples_INT64 (I, J, X, &nvals, G)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // D = dense form of G, with zeros on the diagonal and INF elsewhere
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_Malloc (&Dx, LAGRAPH_MAX (n*n, 1), tsize, msg)) ;
+    if (type == GrB_FP64)
+    {
+        fw_init_fp64 (Dx, I, J, X, n, nvals, nthreads) ;
+    }
+    else if (type == GrB_FP32)
+    {
+        fw_init_fp32 (Dx, I, J, X, n, nvals, nthreads) ;
+    }
+    else
+    {
+        fw_init_int64 (Dx, I, J, X, n, nvals, nthreads) ;
+    }
+    LAGraph_Free ((void **) &I, NULL) ;
+    LAGraph_Free ((void **) &J, NULL) ;
+    LAGraph_Free (&X, NULL) ;
+
+    //--------------------------------------------------------------------------
+    // blocked Floyd-Warshall
+    //--------------------------------------------------------------------------
+
+    if (type == GrB_FP64)
+    {
+        fw_fp64 (Dx, n, b, nthreads) ;
+    }
+    else if (type == GrB_FP32)
+    {
+        fw_fp32 (Dx, n, b, nthreads) ;
+    }
+    else
+    {
+        fw_int64 (Dx, n, b, nthreads) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // D = Dx, with INF entries removed
+    //--------------------------------------------------------------------------
+
+    #if LAGRAPH_SUITESPARSE
+    {
+        // move Dx into D as a full matrix, with no copy
+        GRB_TRY (GrB_Matrix_new (D, type, n, n)) ;
+        GRB_TRY (GxB_Matrix_pack_FullR (*D, &Dx, LAGRAPH_MAX (n*n, 1) * tsize,
+            false, NULL)) ;
+    }
+    #else
+    {
+        if (type == GrB_FP64)
+        {
+            GRB_TRY (GrB_Matrix_import_FP64 (D, type, n, n, NULL, NULL, Dx,
+                0, 0, n*n, GrB_DENSE_ROW_FORMAT)) ;
+        }
+        else if (type == GrB_FP32)
+        {
+            GRB_TRY (GrB_Matrix_import_FP32 (D, type, n, n, NULL, NULL, Dx,
+                0, 0, n*n, GrB_DENSE_ROW_FORMAT)) ;
+        }
+        else
+        {
+            GRB_TRY (GrB_Matrix_import_INT64 (D, type, n, n, NULL, NULL, Dx,
+                0, 0, n*n, GrB_DENSE_ROW_FORMAT)) ;
+        }
+        LAGraph_Free (&Dx, NULL) ;
+    }
+    #endif
+
+    if (type == GrB_INT64)
+    {
+        GRB_TRY (GrB_select (*D, NULL, NULL, GrB_VALUENE_INT64, *D,
+            (int64_t) INT64_MAX, NULL)) ;
+    }
+    else
+    {
+        GRB_TRY (GrB_select (*D, NULL, NULL, GrB_VALUENE_FP64, *D,
+            (double) INFINITY, NULL)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_WORK ;
+    (*D_type) = type ;
+    return (GrB_SUCCESS) ;
+}
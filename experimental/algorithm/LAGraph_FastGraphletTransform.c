@@ -8,547 +8,794 @@
 
 //------------------------------------------------------------------------------
 
-// LAGraph_FastGraphletTransform: computes the Fast Graphlet Transform of
-// an undirected graph.  No self edges are allowed on the input graph.
+// LAGraph_FastGraphletTransform_Range: computes the Fast Graphlet Transform of
+// an undirected graph, for the vertices vfirst:vlast-1 and any subset of the
+// 16 orbits.  No self edges are allowed on the input graph.
+
+// The raw frequencies d_0 to d_15 are built from a few shared quantities:
+// the degree p_1 = Ae, the vector A*p_1, the triangle counts c_3, and the
+// per-edge triangle counts C_3 = hadamard(A, A^2).  Only the raw frequencies
+// that appear in the rows of U_inv for the requested orbits are computed.
+
+// The vertex range is processed in tiles of consecutive rows, each with at
+// most FGLT_CHUNK rows and about FGLT_WEDGES wedges, so the n-by-n products
+// C_3 and A^2 are never formed (except C_3 itself, if d_13 is required).  Each
+// tile is a short sequence of GraphBLAS calls, which use the threads set by
+// LAGraph_SetNumThreads.  The K4 counts d_15 are found by an OpenMP loop over
+// the 4-truss of A, which visits the whole graph regardless of the range.
+
+// F_net is returned as a sparse 16-by-(vlast-vfirst) matrix, with no entries
+// for zero counts or for orbits that were not requested.  Column v of F_net
+// holds the counts for vertex vfirst+v.  A graph with 100M vertices can thus
+// be processed in slices, each needing O(vlast-vfirst) workspace in addition
+// to the O(n) vectors p_1 and A*p_1.
+
+// LAGraph_FastGraphletTransform: computes all 16 orbits for all n vertices.
 
 // fixme: rename this
 
 // https://arxiv.org/pdf/2007.11111.pdf
 
 //------------------------------------------------------------------------------
-#define F_UNARY(f)  ((void (*)(void *, const void *)) f)
-
-#define LG_FREE_WORK                \
-{                                   \
-    GrB_free (&C_3) ;               \
-    GrB_free (&d_0) ;               \
-    GrB_free (&d_1) ;               \
-    GrB_free (&d_2) ;               \
-    GrB_free (&d_3) ;               \
-    GrB_free (&d_4) ;               \
-    GrB_free (&d_5) ;               \
-    GrB_free (&d_6) ;               \
-    GrB_free (&d_7) ;               \
-    GrB_free (&d_8) ;               \
-    GrB_free (&d_9) ;               \
-    GrB_free (&d_10) ;              \
-    GrB_free (&d_11) ;              \
-    GrB_free (&d_12) ;              \
-    GrB_free (&d_13) ;              \
-    GrB_free (&d_14) ;              \
-    GrB_free (&d_15) ;              \
-    GrB_free (&d_2) ;               \
-    GrB_free (&v) ;                 \
-    GrB_free (&p_1_minus_one) ;     \
-    GrB_free (&p_1_minus_two) ;     \
-    GrB_free (&two_c_3) ;           \
-    GrB_free (&p_1_p_1_had) ;       \
-    GrB_free (&C_42) ;              \
-    GrB_free (&P_2) ;               \
-    GrB_free (&D_1) ;               \
-    GrB_free (&D_4c) ;              \
-    GrB_free (&D_43) ;              \
-    GrB_free (&U_inv) ;             \
-    GrB_free (&F_raw) ;             \
-    GrB_free (&C_4) ;               \
-}
-
-#define LG_FREE_ALL                 \
-{                                   \
-    LG_FREE_WORK ;                  \
-}
 
 #define F_UNARY(f)  ((void (*)(void *, const void *)) f)
 
 #include "LG_internal.h"
 #include "LAGraphX.h"
-#include <omp.h>
 
-void sub_one_mult (int64_t *z, const int64_t *x) { (*z) = (*x) * ((*x)-1) ; }
+// each tile has at most FGLT_CHUNK rows, and at most FGLT_WEDGES wedges
+// unless it consists of a single row
+#define FGLT_CHUNK  (64 * 1024)
+#define FGLT_WEDGES (((int64_t) 1) << 24)
 
-int LAGraph_FastGraphletTransform
+// F_net = U_inv * F_raw
+static const GrB_Index U_inv_I [ ] = {0, 1, 2, 2, 3, 3, 4, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 9, 9, 9, 10, 10, 10, 10, 11, 11, 11, 12, 12, 12, 12, 13, 13, 14, 14, 15} ;
+static const GrB_Index U_inv_J [ ] = {0, 1, 2, 4, 3, 4, 4, 5, 9, 10, 12, 13, 14, 15, 6, 10, 11, 12, 13, 14, 15, 7, 9, 10, 13, 14, 15, 8, 11, 14, 15, 9, 13, 15, 10, 13, 14, 15, 11, 14, 15, 12, 13, 14, 15, 13, 15, 14, 15, 15} ;
+static const int64_t U_inv_X [ ] = {1, 1, 1, -2, 1, -1, 1, 1, -2, -1, -2, 4, 2, -6, 1, -1, -2, -2, 2, 4, -6, 1, -1, -1, 2, 1, -3, 1, -1, 1, -1, 1, -2, 3, 1, -2, -2, 6, 1, -2, 3, 1, -1, -1, 3, 1, -3, 1, -3, 1} ;
+#define U_INV_NVALS 50
+
+static void sub_one_mult (int64_t *z, const int64_t *x) { (*z) = (*x) * ((*x)-1) ; }
+
+//------------------------------------------------------------------------------
+// fglt_scatter: X [0:nb-1] = t, with zeros where t has no entry
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL ;
+
+static int fglt_scatter
 (
-    // outputs:
-    GrB_Matrix *F_net,  // 16-by-n matrix of graphlet counts
-    // inputs:
-    LAGraph_Graph G,
-    bool compute_d_15,  // probably this makes most sense
+    int64_t *X,         // dense array of size nb
+    GrB_Index nb,
+    GrB_Vector t,       // sparse vector of size nb
+    GrB_Index *I,       // workspace of size nb
+    int64_t *Y,         // workspace of size nb
     char *msg
 )
 {
-    LG_CLEAR_MSG ;
-    GrB_Index const U_inv_I[] = {0, 1, 2, 2, 3, 3, 4, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 9, 9, 9, 10, 10, 10, 10, 11, 11, 11, 12, 12, 12, 12, 13, 13, 14, 14, 15} ;
-    GrB_Index const U_inv_J[] = {0, 1, 2, 4, 3, 4, 4, 5, 9, 10, 12, 13, 14, 15, 6, 10, 11, 12, 13, 14, 15, 7, 9, 10, 13, 14, 15, 8, 11, 14, 15, 9, 13, 15, 10, 13, 14, 15, 11, 14, 15, 12, 13, 14, 15, 13, 15, 14, 15, 15} ;
-    int64_t const U_inv_X[] = {1, 1, 1, -2, 1, -1, 1, 1, -2, -1, -2, 4, 2, -6, 1, -1, -2, -2, 2, 4, -6, 1, -1, -1, 2, 1, -3, 1, -1, 1, -1, 1, -2, 3, 1, -2, -2, 6, 1, -2, 3, 1, -1, -1, 3, 1, -3, 1, -3, 1} ;
-    GrB_Index const U_inv_nvals = 50;
-
-    GrB_Matrix C_3 = NULL,
-	       A = NULL,
-	       C_42 = NULL,
-	       P_2 = NULL,
-	       D_1 = NULL,
-	       D_4c = NULL,
-	       D_43 = NULL,
-	       U_inv = NULL,
-	       F_raw = NULL,
-               C_4 = NULL ;
-
-    GrB_Vector d_0 = NULL,
-	       d_1 = NULL,
-	       d_2 = NULL,
-	       d_3 = NULL,
-	       d_4 = NULL,
-	       d_5 = NULL,
-	       d_6 = NULL,
-	       d_7 = NULL,
-	       d_8 = NULL,
-	       d_9 = NULL,
-	       d_10 = NULL,
-	       d_11 = NULL,
-	       d_12 = NULL,
-               d_13 = NULL,
-               d_14 = NULL,
-               d_15 = NULL;
-
-    GrB_Vector v = NULL,
-               two_c_3 = NULL,
-	       p_1_minus_one = NULL,
-	       p_1_minus_two = NULL,
-	       p_1_p_1_had = NULL ;
-
     GrB_Index nvals ;
-    int64_t ntri ;
-
-    A = G->A ;
-
-    GrB_Index n ;
-    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
-
-    //--------------------------------------------------------------------------
-    // compute d_0 = e
-    //--------------------------------------------------------------------------
-
-    // d_0 = e
-    GRB_TRY (GrB_Vector_new (&d_0, GrB_INT64, n)) ;
-    GRB_TRY (GrB_assign (d_0, NULL, NULL, 1, GrB_ALL, n, NULL)) ;
-
-    //--------------------------------------------------------------------------
-    // compute d_1 = Ae (in_degree)
-    //--------------------------------------------------------------------------
-
-    GRB_TRY (GrB_Vector_new (&d_1, GrB_INT64, n)) ;
-
-    // d_1 = Ae (in_degree)
-    GRB_TRY (LAGraph_Cached_OutDegree (G, msg)) ;
-
-    GRB_TRY (GrB_Vector_dup (&d_1, G->out_degree)) ;
-
-    //--------------------------------------------------------------------------
-    // compute d_2 = p_2
-    //--------------------------------------------------------------------------
+    memset (X, 0, nb * sizeof (int64_t)) ;
+    GRB_TRY (GrB_Vector_nvals (&nvals, t)) ;
+    GRB_TRY (GrB_Vector_extractTuples_INT64 (I, Y, &nvals, t)) ;
+    for (GrB_Index k = 0 ; k < nvals ; k++)
+    {
+        X [I [k]] = Y [k] ;
+    }
+    return (GrB_SUCCESS) ;
+}
 
-    GRB_TRY (GrB_Vector_new (&d_2, GrB_INT64, n)) ;
+//------------------------------------------------------------------------------
+// fglt_gather: X [0:nb-1] = v (Rows), with zeros where v has no entry
+//------------------------------------------------------------------------------
 
-    // d_2 = p_2 = A*p_1 - c_2 = A*d_1 - d_1
-    GRB_TRY (GrB_mxv (d_2, NULL, NULL, GxB_PLUS_SECOND_INT64, A, d_1, NULL)) ;
-    GRB_TRY (GrB_eWiseMult (d_2, NULL, NULL, GrB_MINUS_INT64, d_2, d_1, NULL)) ;
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL GrB_free (&t) ;
 
-    //--------------------------------------------------------------------------
-    // compute d_3 = hadamard(p_1, p_1 - 1) / 2
-    //--------------------------------------------------------------------------
-
-    GRB_TRY (GrB_Vector_new (&d_3, GrB_INT64, n)) ;
+static int fglt_gather
+(
+    int64_t *X,             // dense array of size nb
+    GrB_Vector v,
+    const GrB_Index *Rows,  // size nb
+    GrB_Index nb,
+    GrB_Index *I,           // workspace of size nb
+    int64_t *Y,             // workspace of size nb
+    char *msg
+)
+{
+    GrB_Vector t = NULL ;
+    GRB_TRY (GrB_Vector_new (&t, GrB_INT64, nb)) ;
+    GRB_TRY (GrB_extract (t, NULL, NULL, v, Rows, nb, NULL)) ;
+    LG_TRY (fglt_scatter (X, nb, t, I, Y, msg)) ;
+    GrB_free (&t) ;
+    return (GrB_SUCCESS) ;
+}
 
-    GrB_UnaryOp Sub_one_mult = NULL ;
-    GRB_TRY (GrB_UnaryOp_new (&Sub_one_mult, F_UNARY (sub_one_mult), GrB_INT64, GrB_INT64)) ;
+//------------------------------------------------------------------------------
+// fglt_tiles: partition first:last-1 into tiles of consecutive rows
+//------------------------------------------------------------------------------
 
-    GRB_TRY (GrB_apply (d_3, NULL, NULL, Sub_one_mult, d_1, NULL)) ;
-    GRB_TRY (GrB_apply (d_3, NULL, NULL, GrB_DIV_INT64, d_3, (int64_t) 2, NULL)) ;
+// The cost of row i is wedges (i) = sum of the degrees of the neighbors of i,
+// which bounds the work and the size of row i of A^2.  Tile t is the set of
+// rows Tiles [t]:Tiles [t+1]-1.
 
-    //--------------------------------------------------------------------------
-    // compute d_4 = C_3e/2
-    //--------------------------------------------------------------------------
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL LAGraph_Free ((void **) &Tiles, NULL) ;
 
-    GRB_TRY (GrB_Matrix_new (&C_3, GrB_INT64, n, n)) ;
-    GRB_TRY (GrB_Vector_new (&d_4, GrB_INT64, n)) ;
+static int fglt_tiles
+(
+    GrB_Index **Tiles_handle,
+    GrB_Index *ntiles_handle,
+    GrB_Vector wedges,
+    GrB_Index first,
+    GrB_Index last,
+    GrB_Index *Rows,        // workspace of size FGLT_CHUNK
+    GrB_Index *I,           // workspace of size FGLT_CHUNK
+    int64_t *Y,             // workspace of size FGLT_CHUNK
+    int64_t *Cost,          // workspace of size FGLT_CHUNK
+    char *msg
+)
+{
+    GrB_Index *Tiles = NULL, ntiles = 0, tiles_size = 64 ;
+    LG_TRY (LAGraph_Malloc ((void **) &Tiles, tiles_size, sizeof (GrB_Index),
+        msg)) ;
+    Tiles [0] = first ;
+
+    for (GrB_Index c0 = first ; c0 < last ; )
+    {
+        // Cost [0:c1-c0-1] = wedges (c0:c1-1)
+        GrB_Index c1 = LAGRAPH_MIN (c0 + FGLT_CHUNK, last) ;
+        for (GrB_Index k = 0 ; k < c1 - c0 ; k++)
+        {
+            Rows [k] = c0 + k ;
+        }
+        LG_TRY (fglt_gather (Cost, wedges, Rows, c1 - c0, I, Y, msg)) ;
 
-    // C_3 = hadamard(A, A^2)
-    GRB_TRY (GrB_mxm (C_3, A, NULL, GxB_PLUS_FIRST_INT64, A, A, GrB_DESC_ST1)) ;
+        // cut c0:c1-1 into tiles; each tile has at least one row
+        GrB_Index b = c0 ;
+        while (b < c1)
+        {
+            int64_t w = Cost [b - c0] ;
+            b++ ;
+            while (b < c1 && w + Cost [b - c0] <= FGLT_WEDGES)
+            {
+                w += Cost [b - c0] ;
+                b++ ;
+            }
+            if (ntiles + 2 > tiles_size)
+            {
+                LG_TRY (LAGraph_Realloc ((void **) &Tiles, 2 * tiles_size,
+                    tiles_size, sizeof (GrB_Index), msg)) ;
+                tiles_size *= 2 ;
+            }
+            Tiles [++ntiles] = b ;
+        }
+        c0 = c1 ;
+    }
 
-    // d_4 = c_3 = C_3e/2
-    GRB_TRY (GrB_reduce (d_4, NULL, NULL, GrB_PLUS_MONOID_INT64, C_3, NULL)) ;
-    GRB_TRY (GrB_apply (d_4, NULL, NULL, GrB_DIV_INT64, d_4, (int64_t) 2, NULL)) ;
+    (*Tiles_handle) = Tiles ;
+    (*ntiles_handle) = ntiles ;
+    return (GrB_SUCCESS) ;
+}
 
-    //--------------------------------------------------------------------------
-    // compute d_5 = p_3 = A*d_2 - hadamard(p_1, p_1 - 1) - 2c_3
-    //--------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+// fglt_k4: count the K4's incident on each vertex in vfirst:vlast-1
+//------------------------------------------------------------------------------
 
-    GRB_TRY (GrB_Vector_new (&v, GrB_INT64, n)) ;
-    GRB_TRY (GrB_Vector_new (&two_c_3, GrB_INT64, n)) ;
-    GRB_TRY (GrB_Vector_new (&d_5, GrB_INT64, n)) ;
+// T is the 4-truss of A, which holds all edges of all K4's.  It is unpacked
+// and left empty.  Each K4 (i,j,k,l) with i < j < k < l is found once, from
+// row i: j is in N+(i), the neighbors of i greater than i; the candidates k
+// are the merge of N+(i) and N+(j); and l is in the merge of N+(k) with the
+// candidates after k.
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL                                 \
+{                                                   \
+    LAGraph_Free ((void **) &Tp, NULL) ;            \
+    LAGraph_Free ((void **) &Tj, NULL) ;            \
+    LAGraph_Free ((void **) &Tx, NULL) ;            \
+}
 
-    // v = hadamard(p_1, p_1 - 1)
-    GRB_TRY (GrB_apply (v, NULL, NULL, Sub_one_mult, d_1, NULL)) ;
+#define FGLT_ADD(v,x)                                               \
+{                                                                   \
+    int64_t v_ = (int64_t) (v) - (int64_t) vfirst ;                 \
+    if ((x) != 0 && v_ >= 0 && v_ < nr)                            \
+    {                                                               \
+        LG_ATOMIC_FETCH_ADD_INT64 (&(F15 [v_]), (x)) ;              \
+    }                                                               \
+}
 
-    // two_c_3 = 2 * c_3 = 2 * d_4
-    GRB_TRY (GrB_apply (two_c_3, NULL, NULL, GrB_TIMES_INT64, 2, d_4, NULL)) ;
+static int fglt_k4
+(
+    int64_t *F15,           // size vlast-vfirst, already zero
+    GrB_Matrix T,
+    GrB_Index vfirst,
+    GrB_Index vlast,
+    int nthreads,
+    char *msg
+)
+{
+#if LAGRAPH_SUITESPARSE
+
+    GrB_Index *Tp = NULL, *Tj = NULL ;
+    void *Tx = NULL ;
+    GrB_Index Tp_size, Tj_size, Tx_size, n ;
+    bool iso ;
+    int64_t nr = (int64_t) (vlast - vfirst) ;
+
+    // the rows of T are returned sorted, since jumbled is NULL
+    GRB_TRY (GrB_Matrix_nrows (&n, T)) ;
+    GRB_TRY (GxB_Matrix_unpack_CSR (T, &Tp, &Tj, &Tx, &Tp_size, &Tj_size,
+        &Tx_size, &iso, NULL, NULL)) ;
+
+    int64_t maxdeg = 0 ;
+    for (int64_t i = 0 ; i < (int64_t) n ; i++)
+    {
+        maxdeg = LAGRAPH_MAX (maxdeg, (int64_t) (Tp [i+1] - Tp [i])) ;
+    }
 
-    // d_5 = A * d_2
-    GRB_TRY (GrB_mxv (d_5, NULL, NULL, GxB_PLUS_SECOND_INT64, A, d_2, NULL)) ;
+    int nfail = 0 ;
+    #pragma omp parallel num_threads(nthreads) reduction(+:nfail)
+    {
+        // Common: the candidates k for the current edge (i,j)
+        GrB_Index *Common = NULL ;
+        if (LAGraph_Malloc ((void **) &Common, maxdeg + 1, sizeof (GrB_Index),
+            NULL) != GrB_SUCCESS)
+        {
+            nfail++ ;
+        }
 
-    // d_5 -= hadamard(p_1, p_1 - 1)
-    GRB_TRY (GrB_eWiseAdd (d_5, NULL, NULL, GrB_MINUS_INT64, d_5, v, NULL)) ;
+        #pragma omp for schedule(dynamic,64)
+        for (int64_t i = 0 ; i < (int64_t) n ; i++)
+        {
+            if (Common == NULL) continue ;
 
-    // d_5 -= two_c_3
-    GRB_TRY (GrB_eWiseAdd (d_5, NULL, NULL, GrB_MINUS_INT64, d_5, two_c_3, NULL)) ;
+            // N+(i) = Tj [pi_start:pi_end-1]
+            int64_t pi_start = Tp [i], pi_end = Tp [i+1] ;
+            while (pi_start < pi_end && Tj [pi_start] <= (GrB_Index) i)
+            {
+                pi_start++ ;
+            }
 
-    //--------------------------------------------------------------------------
-    // compute d_6 = hadamard(d_2, p_1-1) - 2c_3
-    //--------------------------------------------------------------------------
+            int64_t count_i = 0 ;
+            for (int64_t pj = pi_start ; pj < pi_end ; pj++)
+            {
+                // Common = intersection of N+(i) and N+(j), all > j
+                GrB_Index j = Tj [pj] ;
+                int64_t ncommon = 0 ;
+                int64_t p = pj + 1, q = Tp [j], q_end = Tp [j+1] ;
+                while (p < pi_end && q < q_end)
+                {
+                    GrB_Index x = Tj [p], y = Tj [q] ;
+                    if (x < y) p++ ;
+                    else if (y < x) q++ ;
+                    else { Common [ncommon++] = x ; p++ ; q++ ; }
+                }
 
-    GRB_TRY (GrB_Vector_new (&p_1_minus_one, GrB_INT64, n)) ;
-    GRB_TRY (GrB_Vector_new (&d_6, GrB_INT64, n)) ;
+                int64_t count_j = 0 ;
+                for (int64_t c = 0 ; c < ncommon ; c++)
+                {
+                    // each l in N+(k) and in Common [c+1:ncommon-1] is a K4
+                    GrB_Index k = Common [c] ;
+                    int64_t count_k = 0 ;
+                    int64_t pc = c + 1, pk = Tp [k], pk_end = Tp [k+1] ;
+                    while (pc < ncommon && pk < pk_end)
+                    {
+                        GrB_Index x = Common [pc], y = Tj [pk] ;
+                        if (x < y) pc++ ;
+                        else if (y < x) pk++ ;
+                        else
+                        {
+                            FGLT_ADD (x, 1) ;
+                            count_k++ ;
+                            pc++ ;
+                            pk++ ;
+                        }
+                    }
+                    FGLT_ADD (k, count_k) ;
+                    count_j += count_k ;
+                }
+                FGLT_ADD (j, count_j) ;
+                count_i += count_j ;
+            }
+            FGLT_ADD (i, count_i) ;
+        }
 
-    // p_1_minus_one = p_1 - 1
-    GRB_TRY (GrB_apply (p_1_minus_one, NULL, NULL, GrB_MINUS_INT64, d_1, (int64_t) 1, NULL)) ;
+        LAGraph_Free ((void **) &Common, NULL) ;
+    }
 
-    // d_6 = hadamard(d_2, p_1-1) 
-    GRB_TRY (GrB_eWiseMult (d_6, NULL, NULL, GrB_TIMES_INT64, d_2, p_1_minus_one, NULL)) ;
+    LG_FREE_ALL ;
+    LG_ASSERT (nfail == 0, GrB_OUT_OF_MEMORY) ;
+    return (GrB_SUCCESS) ;
 
-    // d_6 -= 2c_3
-    GRB_TRY (GrB_eWiseAdd (d_6, NULL, NULL, GrB_MINUS_INT64, d_6, two_c_3, NULL)) ;
+#else
+    return (GrB_NOT_IMPLEMENTED) ;
+#endif
+}
 
-    //--------------------------------------------------------------------------
-    // compute d_7 = A*hadamard(p_1-1, p_1-2) / 2
-    //--------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+// LAGraph_FastGraphletTransform_Range
+//------------------------------------------------------------------------------
 
-    GRB_TRY (GrB_Vector_new (&p_1_minus_two, GrB_INT64, n)) ;
-    GRB_TRY (GrB_Vector_new (&p_1_p_1_had, GrB_INT64, n)) ;
-    GRB_TRY (GrB_Vector_new (&d_7, GrB_INT64, n)) ;
+#undef  LG_FREE_WORK
+#define LG_FREE_WORK                                \
+{                                                   \
+    GrB_free (&Sub_one_mult) ;                      \
+    GrB_free (&wedges) ;                            \
+    GrB_free (&d_2) ;                               \
+    GrB_free (&q) ;                                 \
+    GrB_free (&p_1_minus_two) ;                     \
+    GrB_free (&c_3) ;                               \
+    GrB_free (&C_3) ;                               \
+    GrB_free (&T) ;                                 \
+    GrB_free (&A_t) ;                               \
+    GrB_free (&C_t) ;                               \
+    GrB_free (&W_t) ;                               \
+    GrB_free (&t) ;                                 \
+    GrB_free (&f) ;                                 \
+    for (int k = 0 ; k < 16 ; k++)                  \
+    {                                               \
+        LAGraph_Free ((void **) &(Raw [k]), NULL) ; \
+    }                                               \
+    LAGraph_Free ((void **) &Tiles, NULL) ;         \
+    LAGraph_Free ((void **) &Rows, NULL) ;          \
+    LAGraph_Free ((void **) &I, NULL) ;             \
+    LAGraph_Free ((void **) &Y, NULL) ;             \
+    LAGraph_Free ((void **) &P1, NULL) ;            \
+    LAGraph_Free ((void **) &W, NULL) ;             \
+    LAGraph_Free ((void **) &C3, NULL) ;            \
+    LAGraph_Free ((void **) &Fi, NULL) ;            \
+    LAGraph_Free ((void **) &Fx, NULL) ;            \
+}
 
-    GRB_TRY (GrB_apply (p_1_minus_two, NULL, NULL, GrB_MINUS_INT64, d_1, (int64_t) 2, NULL)) ;
-    GRB_TRY (GrB_eWiseMult (p_1_p_1_had, NULL, NULL, GrB_TIMES_INT64, p_1_minus_one, p_1_minus_two, NULL)) ;
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL                                 \
+{                                                   \
+    LG_FREE_WORK ;                                  \
+    GrB_free (&F) ;                                 \
+}
 
-    GRB_TRY (GrB_mxv (d_7, NULL, NULL, GxB_PLUS_SECOND_INT64, A, p_1_p_1_had, NULL)) ;
-    GRB_TRY (GrB_apply (d_7, NULL, NULL, GrB_DIV_INT64, d_7, (int64_t) 2, NULL)) ;
+int LAGraph_FastGraphletTransform_Range
+(
+    // outputs:
+    GrB_Matrix *F_net,  // 16-by-(vlast-vfirst) matrix of graphlet counts
+    // inputs:
+    LAGraph_Graph G,
+    bool compute_d_15,  // if false, the K4 counts d_15 are taken as zero
+    const bool *orbits, // size 16; orbits [k] true to compute orbit k, or
+                        // NULL to compute all 16 orbits
+    GrB_Index vfirst,   // F_net is computed for vertices vfirst:vlast-1
+    GrB_Index vlast,
+    char *msg
+)
+{
 
     //--------------------------------------------------------------------------
-    // compute d_8 = hadamard(p_1, p_1_p_1_had) / 6
+    // check inputs
     //--------------------------------------------------------------------------
 
-    GRB_TRY (GrB_Vector_new (&d_8, GrB_INT64, n)) ;
-
-    GRB_TRY (GrB_eWiseMult (d_8, NULL, NULL, GrB_TIMES_INT64, d_1, p_1_p_1_had, NULL)) ;
-    GRB_TRY (GrB_apply (d_8, NULL, NULL, GrB_DIV_INT64, d_8, (int64_t) 6, NULL)) ;
+    LG_CLEAR_MSG ;
+    GrB_UnaryOp Sub_one_mult = NULL ;
+    GrB_Vector wedges = NULL, d_2 = NULL, q = NULL, p_1_minus_two = NULL,
+        c_3 = NULL, t = NULL, f = NULL ;
+    GrB_Matrix C_3 = NULL, T = NULL, A_t = NULL, C_t = NULL, W_t = NULL,
+        F = NULL ;
+    int64_t *Raw [16] ;
+    for (int k = 0 ; k < 16 ; k++)
+    {
+        Raw [k] = NULL ;
+    }
+    GrB_Index *Tiles = NULL, *Rows = NULL, *I = NULL, *Fi = NULL, ntiles ;
+    int64_t *Y = NULL, *P1 = NULL, *W = NULL, *C3 = NULL, *Fx = NULL ;
+
+    LG_ASSERT (F_net != NULL, GrB_NULL_POINTER) ;
+    (*F_net) = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+
+    if (G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+       (G->kind == LAGraph_ADJACENCY_DIRECTED &&
+        G->is_symmetric_structure == LAGraph_TRUE))
+    {
+        // the structure of A is known to be symmetric
+        ;
+    }
+    else
+    {
+        // A is not known to be symmetric
+        LG_ASSERT_MSG (false, -1005, "G->A must be symmetric") ;
+    }
 
-    //--------------------------------------------------------------------------
-    // compute d_9 = A*c_3 - 2*c_3
-    //--------------------------------------------------------------------------
+    // no self edges can be present
+    LG_ASSERT_MSG (G->nself_edges == 0, -1004, "G->nself_edges must be zero") ;
 
-    GRB_TRY (GrB_Vector_new (&d_9, GrB_INT64, n)) ;
+    GrB_Matrix A = G->A ;
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+    LG_ASSERT_MSG (vfirst <= vlast && vlast <= n, GrB_INVALID_INDEX,
+        "vertex range is invalid") ;
+    GrB_Index nr = vlast - vfirst ;
 
-    GRB_TRY (GrB_mxv (d_9, NULL, NULL, GxB_PLUS_SECOND_INT64, A, d_4, NULL)) ;
-    GRB_TRY (GrB_eWiseAdd (d_9, NULL, NULL, GrB_MINUS_INT64, d_9, two_c_3, NULL)) ;
+    int nthreads_outer, nthreads_inner ;
+    LG_TRY (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+    int nthreads = nthreads_outer * nthreads_inner ;
 
     //--------------------------------------------------------------------------
-    // compute d_10 = C_3 * (p_1 - 2)
+    // determine which raw frequencies are required
     //--------------------------------------------------------------------------
 
-    GRB_TRY (GrB_Vector_new (&d_10, GrB_INT64, n)) ;
-
-    GRB_TRY (GrB_mxv (d_10, NULL, NULL, GxB_PLUS_TIMES_INT64, C_3, p_1_minus_two, NULL)) ;
+    // net orbit i depends on the raw frequencies in U_inv (i,:)
+    bool want [16], need [16] ;
+    for (int k = 0 ; k < 16 ; k++)
+    {
+        want [k] = (orbits == NULL || orbits [k]) ;
+        need [k] = false ;
+    }
+    for (int e = 0 ; e < U_INV_NVALS ; e++)
+    {
+        if (want [U_inv_I [e]]) need [U_inv_J [e]] = true ;
+    }
+    need [15] = need [15] && compute_d_15 ;
+    bool need_c3 = need [4] || need [5] || need [6] || need [9] || need [11] ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace
+    //--------------------------------------------------------------------------
+
+    GrB_Index chunk = LAGRAPH_MAX (LAGRAPH_MIN (n, FGLT_CHUNK), 1) ;
+    GrB_Index nr1 = LAGRAPH_MAX (nr, 1) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Rows, chunk, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &I   , chunk, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Y   , chunk, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &P1  , chunk, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &W   , chunk, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Calloc ((void **) &C3  , chunk, sizeof (int64_t), msg)) ;
+    for (int k = 0 ; k < 16 ; k++)
+    {
+        if (!need [k]) continue ;
+        LG_TRY (LAGraph_Calloc ((void **) &(Raw [k]), nr1, sizeof (int64_t),
+            msg)) ;
+    }
 
     //--------------------------------------------------------------------------
-    // compute d_11 = hadamard(p_1 - 2, c_3)
+    // global vectors: p_1, A*p_1, and those needed by the tiles
     //--------------------------------------------------------------------------
 
-    GRB_TRY (GrB_Vector_new (&d_11, GrB_INT64, n)) ;
+    GRB_TRY (GrB_UnaryOp_new (&Sub_one_mult, F_UNARY (sub_one_mult),
+        GrB_INT64, GrB_INT64)) ;
 
-    GRB_TRY (GrB_eWiseMult (d_11, NULL, NULL, GrB_TIMES_INT64, p_1_minus_two, d_4, NULL)) ;
+    // p_1 = Ae
+    LG_TRY (LAGraph_Cached_OutDegree (G, msg)) ;
+    GrB_Vector p_1 = G->out_degree ;
 
-    //--------------------------------------------------------------------------
-    // compute d_12 = c_4 = C_{4,2}e/2
-    //--------------------------------------------------------------------------
+    // wedges = A*p_1, which is also d_2 + p_1
+    GRB_TRY (GrB_Vector_new (&wedges, GrB_INT64, n)) ;
+    GRB_TRY (GrB_mxv (wedges, NULL, NULL, LAGraph_plus_second_int64, A, p_1,
+        NULL)) ;
 
-    GRB_TRY (GrB_Matrix_new (&C_4, GrB_INT64, n, 1)) ;
-    GRB_TRY (GrB_Matrix_new (&D_1, GrB_INT64, n, n)) ;
-
-    GRB_TRY (GrB_Vector_new (&d_12, GrB_INT64, n)) ;
-
-    // D_1 = diag(d_1)
-    GRB_TRY (GxB_Matrix_diag (D_1, d_1, (int64_t) 0, NULL)) ;
-    
-    GRB_TRY (GrB_Matrix_nvals (&nvals, A)); 
-
-    const GrB_Index entries_per_tile = 1000;
-    GrB_Index ntiles = (nvals + entries_per_tile - 1) / entries_per_tile ;
-    GrB_Matrix A_Tiles [ntiles], D_Tiles [ntiles], C_Tiles [ntiles] ;
-    GrB_Index Tile_nrows [ntiles] ;
-    GrB_Index Tile_ncols [1] = {n} ;
-
-    int64_t tot_deg = 0 ;
-    int tile_cnt = 0 ;
-    GrB_Index last_row = -1 ;
-    for (GrB_Index i = 0; i < n; ++i) {
-        int64_t deg ;
-        GRB_TRY (GrB_Vector_extractElement (&deg, d_1, i)) ;
-         
-        if (i == n - 1 || (tot_deg / entries_per_tile != (tot_deg + deg) / entries_per_tile)) {
-            Tile_nrows [tile_cnt++] = i - last_row ;
-            last_row = i ;
-        }
-
-        tot_deg += deg ;
+    if (need [5])
+    {
+        // d_2 = p_2 = A*p_1 - p_1
+        GRB_TRY (GrB_Vector_new (&d_2, GrB_INT64, n)) ;
+        GRB_TRY (GrB_eWiseMult (d_2, NULL, NULL, GrB_MINUS_INT64, wedges, p_1,
+            NULL)) ;
     }
 
-    GRB_TRY (GxB_Matrix_split (A_Tiles, tile_cnt, 1, Tile_nrows, Tile_ncols, A, NULL)) ;
-    GRB_TRY (GxB_Matrix_split (D_Tiles, tile_cnt, 1, Tile_nrows, Tile_ncols, D_1, NULL)) ;
-
-    for (int i = 0; i < tile_cnt; ++i) C_Tiles [i] = NULL ;
-
-#define TRY(method)                     \
-    {                                   \
-        GrB_Info info = method ;        \
-        if (info != GrB_SUCCESS)        \
-        {                               \
-            GrB_free (&A_i) ;           \
-            GrB_free (&C_Tiles [i]) ;   \
-            GrB_free (&e) ;             \
-            continue ;                  \
-        }                               \
+    if (need [7])
+    {
+        // q = hadamard(p_1 - 1, p_1 - 2)
+        GRB_TRY (GrB_Vector_new (&q, GrB_INT64, n)) ;
+        GRB_TRY (GrB_apply (q, NULL, NULL, GrB_MINUS_INT64, p_1, (int64_t) 1,
+            NULL)) ;
+        GRB_TRY (GrB_apply (q, NULL, NULL, Sub_one_mult, q, NULL)) ;
     }
 
-    GxB_set (GxB_NTHREADS, 1) ;
-    #pragma omp parallel for num_threads(omp_get_max_threads()) schedule(dynamic,1)
-    for (int i = 0; i < tile_cnt; ++i) {
-        GrB_Matrix A_i = NULL, e = NULL ;
-
-        TRY (GrB_Matrix_new (&e, GrB_INT64, n, 1)) ;
-        TRY (GrB_assign (e, NULL, NULL, (int64_t) 1, GrB_ALL, n, GrB_ALL, 1, NULL)) ;
-
-        TRY (GrB_Matrix_new (&A_i, GrB_INT64, Tile_nrows [i], n)) ;
-        TRY (GrB_Matrix_new (&C_Tiles [i], GrB_INT64, Tile_nrows [i], 1)) ;
-
-        TRY (GrB_mxm (A_i, NULL, NULL, GxB_PLUS_PAIR_INT64, A_Tiles [i], A, NULL)) ;
-        TRY (GrB_eWiseAdd (A_i, NULL, NULL, GrB_MINUS_INT64, A_i, D_Tiles [i], NULL)) ;
-        TRY (GrB_apply (A_i, NULL, NULL, Sub_one_mult, A_i, NULL)) ;
-
-        // multiply A_i by it on the right
-        TRY (GrB_mxm (C_Tiles [i], NULL, NULL, GxB_PLUS_FIRST_INT64, A_i, e, NULL)) ;
-
-        GrB_free (&A_i) ;
-        GrB_free (&e) ;
-
+    if (need [10])
+    {
+        GRB_TRY (GrB_Vector_new (&p_1_minus_two, GrB_INT64, n)) ;
+        GRB_TRY (GrB_apply (p_1_minus_two, NULL, NULL, GrB_MINUS_INT64, p_1,
+            (int64_t) 2, NULL)) ;
     }
-    GxB_set (GxB_NTHREADS, omp_get_max_threads()) ;
-
-    GRB_TRY (GxB_Matrix_concat (C_4, C_Tiles, tile_cnt, 1, NULL)) ;
-
-    // d_12 = C_4
-    GRB_TRY (GrB_reduce (d_12, NULL, NULL, GrB_PLUS_MONOID_INT64, C_4, NULL)) ;
-    GRB_TRY (GrB_apply (d_12, NULL, NULL, GrB_DIV_INT64, d_12, 2, NULL)) ;
 
-    //--------------------------------------------------------------------------
-    // compute d_13 = D_{4,c}e/2
-    //--------------------------------------------------------------------------
-
-    GRB_TRY (GrB_Matrix_new (&D_4c, GrB_INT64, n, n)) ;
-    GRB_TRY (GrB_Vector_new (&d_13, GrB_INT64, n)) ;
-
-    GRB_TRY (GrB_eWiseMult (D_4c, NULL, NULL, GrB_MINUS_INT64, C_3, A, NULL)) ; // can be mult because we mask with A next
-    GRB_TRY (GrB_mxm (D_4c, A, NULL, GxB_PLUS_SECOND_INT64, A, D_4c, GrB_DESC_S)) ;
+    if (need [13])
+    {
+        // C_3 = hadamard(A, A^2), c_3 = C_3e/2, and then C_3 = C_3 - 1
+        GRB_TRY (GrB_Matrix_new (&C_3, GrB_INT64, n, n)) ;
+        GRB_TRY (GrB_mxm (C_3, A, NULL, LAGraph_plus_one_int64, A, A,
+            GrB_DESC_S)) ;
+        GRB_TRY (GrB_Vector_new (&c_3, GrB_INT64, n)) ;
+        GRB_TRY (GrB_reduce (c_3, NULL, NULL, GrB_PLUS_MONOID_INT64, C_3,
+            NULL)) ;
+        GRB_TRY (GrB_apply (c_3, NULL, NULL, GrB_DIV_INT64, c_3, (int64_t) 2,
+            NULL)) ;
+        GRB_TRY (GrB_apply (C_3, NULL, NULL, GrB_MINUS_INT64, C_3,
+            (int64_t) 1, NULL)) ;
+    }
+    else if (need [9])
+    {
+        // c_3 = hadamard(A, A^2)e/2, one tile at a time
+        GRB_TRY (GrB_Vector_new (&c_3, GrB_INT64, n)) ;
+        LG_TRY (fglt_tiles (&Tiles, &ntiles, wedges, 0, n, Rows, I, Y, W,
+            msg)) ;
+        for (GrB_Index tid = 0 ; tid < ntiles ; tid++)
+        {
+            GrB_Index b0 = Tiles [tid], nb = Tiles [tid+1] - b0 ;
+            for (GrB_Index k = 0 ; k < nb ; k++)
+            {
+                Rows [k] = b0 + k ;
+            }
+            GRB_TRY (GrB_Matrix_new (&A_t, GrB_BOOL, nb, n)) ;
+            GRB_TRY (GrB_extract (A_t, NULL, NULL, A, Rows, nb, GrB_ALL, n,
+                NULL)) ;
+            GRB_TRY (GrB_Matrix_new (&C_t, GrB_INT64, nb, n)) ;
+            GRB_TRY (GrB_mxm (C_t, A_t, NULL, LAGraph_plus_one_int64, A_t, A,
+                GrB_DESC_S)) ;
+            GRB_TRY (GrB_Vector_new (&t, GrB_INT64, nb)) ;
+            GRB_TRY (GrB_reduce (t, NULL, NULL, GrB_PLUS_MONOID_INT64, C_t,
+                NULL)) ;
+            GRB_TRY (GrB_apply (t, NULL, NULL, GrB_DIV_INT64, t, (int64_t) 2,
+                NULL)) ;
+            GRB_TRY (GrB_assign (c_3, NULL, NULL, t, Rows, nb, NULL)) ;
+            GrB_free (&A_t) ;
+            GrB_free (&C_t) ;
+            GrB_free (&t) ;
+        }
+        LAGraph_Free ((void **) &Tiles, NULL) ;
+    }
 
-    // d_13  = D_{4,c}*e/2
-    GRB_TRY (GrB_reduce (d_13, NULL, NULL, GrB_PLUS_INT64, D_4c, NULL)) ;
-    GRB_TRY (GrB_apply (d_13, NULL, NULL, GrB_DIV_INT64, d_13, (int64_t) 2, NULL)) ;
+    // the per-edge triangle counts of each tile give d_10, d_14, and also c_3
+    // if it has not been computed above
+    bool need_Ct = (need_c3 && c_3 == NULL) || need [10] || need [14] ;
 
     //--------------------------------------------------------------------------
-    // compute d_14 = D_{4,3}e/2 = hadamard(A, C_42)e/2
+    // compute the raw frequencies for vfirst:vlast-1, one tile at a time
     //--------------------------------------------------------------------------
 
-    GRB_TRY (GrB_Matrix_new (&D_43, GrB_INT64, n, n)) ;
-    GRB_TRY (GrB_Vector_new (&d_14, GrB_INT64, n)) ;
-    GRB_TRY (GrB_Matrix_new (&C_42, GrB_INT64, n, n)) ;
-    GRB_TRY (GrB_Matrix_new (&P_2, GrB_INT64, n, n)) ;
-
-    // P_2 = A*A - diag(d_1)
-    GRB_TRY (GrB_eWiseAdd (P_2, A, NULL, GrB_MINUS_INT64, C_3, D_1, NULL)) ;
+    LG_TRY (fglt_tiles (&Tiles, &ntiles, wedges, vfirst, vlast, Rows, I, Y, W,
+        msg)) ;
 
-    // C_42 = hadamard(P_2, P_2 - 1)
-    GRB_TRY (GrB_apply (C_42, A, NULL, Sub_one_mult, P_2, NULL)) ;
+    for (GrB_Index tid = 0 ; tid < ntiles ; tid++)
+    {
 
-    GRB_TRY (GrB_eWiseMult (D_43, NULL, NULL, GrB_TIMES_INT64, A, C_42, NULL)) ;
+        //----------------------------------------------------------------------
+        // A_t = A (b0:b0+nb-1,:)
+        //----------------------------------------------------------------------
 
-    // d_14  = D_{4,3}*e/2
-    GRB_TRY (GrB_reduce (d_14, NULL, NULL, GrB_PLUS_INT64, D_43, NULL)) ;
-    GRB_TRY (GrB_apply (d_14, NULL, NULL, GrB_DIV_INT64, d_14, (int64_t) 2, NULL)) ;
-
-    //--------------------------------------------------------------------------
-    // compute d_15 = Te/6
-    //--------------------------------------------------------------------------
+        GrB_Index b0 = Tiles [tid], nb = Tiles [tid+1] - b0 ;
+        GrB_Index off = b0 - vfirst ;
+        for (GrB_Index k = 0 ; k < nb ; k++)
+        {
+            Rows [k] = b0 + k ;
+        }
+        GRB_TRY (GrB_Matrix_new (&A_t, GrB_BOOL, nb, n)) ;
+        GRB_TRY (GrB_extract (A_t, NULL, NULL, A, Rows, nb, GrB_ALL, n, NULL)) ;
+        GRB_TRY (GrB_Vector_new (&t, GrB_INT64, nb)) ;
+
+        // P1 = p_1 (rows), W = (A*p_1) (rows)
+        LG_TRY (fglt_gather (P1, p_1, Rows, nb, I, Y, msg)) ;
+        LG_TRY (fglt_gather (W, wedges, Rows, nb, I, Y, msg)) ;
+        if (need_c3 && c_3 != NULL)
+        {
+            LG_TRY (fglt_gather (C3, c_3, Rows, nb, I, Y, msg)) ;
+        }
 
-    if (compute_d_15) {
-        LAGRAPH_TRY (LAGraph_KTruss (&A, G, 4, msg)) ;
-        GRB_TRY (GrB_Vector_new (&d_15, GrB_INT64, n)) ;
+        //----------------------------------------------------------------------
+        // products with global vectors: A*d_2, A*q, and A*c_3
+        //----------------------------------------------------------------------
 
-        //GrB_wait (A, GrB_MATERIALIZE) ;     // this is essential
-        int nthreads = 1 ;
-        // todo: parallelize this...
-//#pragma omp parallel for num_threads(nthreads)
-        //for (int tid = 0 ; tid < nthreads ; tid++)
+        if (need [5])
         {
-            GrB_Index *neighbors = (GrB_Index*) malloc(n * sizeof(GrB_Index));
-            GrB_Index *k4cmn = (GrB_Index*) malloc(n * sizeof(GrB_Index));
-            int64_t *f15 = (int64_t*) malloc(n * sizeof(int64_t));
-            GrB_Index *I = (GrB_Index *) malloc(n * sizeof(GrB_Index));
-            int *isNeighbor = (int*) malloc(n * sizeof(int));
-            for (int i = 0; i < n; ++i) {
-                neighbors [i] = k4cmn [i] = f15 [i] = isNeighbor [i] = 0 ;
-                I [i] = i ;
-            }
+            GRB_TRY (GrB_mxv (t, NULL, NULL, LAGraph_plus_second_int64, A_t,
+                d_2, NULL)) ;
+            LG_TRY (fglt_scatter (Raw [5] + off, nb, t, I, Y, msg)) ;
+        }
 
+        if (need [7])
+        {
+            GRB_TRY (GrB_mxv (t, NULL, NULL, LAGraph_plus_second_int64, A_t, q,
+                NULL)) ;
+            LG_TRY (fglt_scatter (Raw [7] + off, nb, t, I, Y, msg)) ;
+        }
 
-            // thread tid operates on A(row1:row2-1,:)
-            GrB_Index row1 = 0;//tid * (n / nthreads) ;
-            GrB_Index row2 = n;//(tid == nthreads - 1) ? n : ((tid+1) * (n / nthreads)) ;
+        if (need [9])
+        {
+            GRB_TRY (GrB_mxv (t, NULL, NULL, LAGraph_plus_second_int64, A_t,
+                c_3, NULL)) ;
+            LG_TRY (fglt_scatter (Raw [9] + off, nb, t, I, Y, msg)) ;
+        }
 
-            GxB_Iterator riterator ;
-            GxB_Iterator_new (&riterator) ;
-            GRB_TRY (GxB_rowIterator_attach (riterator, A, NULL)) ;
+        //----------------------------------------------------------------------
+        // C_t = hadamard(A_t, A_t*A): c_3, d_10, and d_14
+        //----------------------------------------------------------------------
 
-            GxB_Iterator iterator ;
-            GxB_Iterator_new (&iterator) ;
-            GRB_TRY (GxB_rowIterator_attach (iterator, A, NULL)) ;
+        if (need_Ct)
+        {
+            GRB_TRY (GrB_Matrix_new (&C_t, GrB_INT64, nb, n)) ;
+            GRB_TRY (GrB_mxm (C_t, A_t, NULL, LAGraph_plus_one_int64, A_t, A,
+                GrB_DESC_S)) ;
 
-            // seek to A(row1,:)
-            GrB_Info info = GxB_rowIterator_seekRow (iterator, row1) ;
-            while (info != GxB_EXHAUSTED)
+            if (need_c3 && c_3 == NULL)
             {
-                // iterate over entries in A(i,:)
-                GrB_Index i = GxB_rowIterator_getRowIndex (iterator) ;
-                if (i >= row2) break ;
-                int neighbor_cnt = 0 ;
-                while (info == GrB_SUCCESS)
+                // C3 = 2*c_3 (rows), halved below
+                GRB_TRY (GrB_reduce (t, NULL, NULL, GrB_PLUS_MONOID_INT64,
+                    C_t, NULL)) ;
+                LG_TRY (fglt_scatter (C3, nb, t, I, Y, msg)) ;
+                for (GrB_Index r = 0 ; r < nb ; r++)
                 {
-                    // working with edge (i, j)
-                    GrB_Index j = GxB_rowIterator_getColIndex (iterator) ;
-
-                    if (j > i) {
-                        neighbors [neighbor_cnt++] = j ;
-                        isNeighbor [j] = 1 ;
-                    }
-
-                    info = GxB_rowIterator_nextCol (iterator) ;
-                }
-
-                for (int neighbor_id = 0 ; neighbor_id < neighbor_cnt ; ++neighbor_id) {
-                    GrB_Index j = neighbors [neighbor_id] ;
-                    int cmn_cnt = 0 ;
-                    info = GxB_rowIterator_seekRow(riterator, j) ;
-
-                    while (info == GrB_SUCCESS) { // iterate over neighbors of j
-                        GrB_Index k = GxB_rowIterator_getColIndex (riterator) ;
-                        if (k > j && isNeighbor [k]) {
-                            k4cmn [cmn_cnt++] = k ;
-                            isNeighbor [k] = -1 ;
-                        }
-                        info = GxB_rowIterator_nextCol (riterator) ;
-                    }
-                    // check every combination
-                    for (int k_1 = 0 ; k_1 < cmn_cnt ; k_1++) {
-                        GrB_Index k = k4cmn [k_1] ;
-                        info = GxB_rowIterator_seekRow(riterator, k) ;
-
-                        while (info == GrB_SUCCESS) { // iterate over neighbors of k
-                            GrB_Index l = GxB_rowIterator_getColIndex (riterator) ;
-                            if (l > k && isNeighbor [l] == -1) {
-                                f15[i]++ ;
-                                f15[j]++ ;
-                                f15[k]++ ;
-                                f15[l]++ ;
-                            }
-                            info = GxB_rowIterator_nextCol (riterator) ;
-                        }
-                    }
-                    for (int k_1 = 0 ; k_1 < cmn_cnt ; k_1++) {
-                        isNeighbor[k4cmn[k_1]] = 1 ;
-                    }
+                    C3 [r] /= 2 ;
                 }
+            }
 
-                for (int neighbor_id = 0 ; neighbor_id < neighbor_cnt ; ++neighbor_id) {
-                    GrB_Index j = neighbors [neighbor_id] ;
-                    isNeighbor [j] = 0 ;
-                }
+            if (need [10])
+            {
+                // d_10 = C_3 * (p_1 - 2)
+                GRB_TRY (GrB_mxv (t, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_INT64,
+                    C_t, p_1_minus_two, NULL)) ;
+                LG_TRY (fglt_scatter (Raw [10] + off, nb, t, I, Y, msg)) ;
+            }
 
-                // move to the next row, A(i+1,:)
-                info = GxB_rowIterator_nextRow (iterator) ;
+            if (need [14])
+            {
+                // d_14 = hadamard(C_3, C_3 - 1)e/2, halved below
+                GRB_TRY (GrB_apply (C_t, NULL, NULL, Sub_one_mult, C_t, NULL)) ;
+                GRB_TRY (GrB_reduce (t, NULL, NULL, GrB_PLUS_MONOID_INT64,
+                    C_t, NULL)) ;
+                LG_TRY (fglt_scatter (Raw [14] + off, nb, t, I, Y, msg)) ;
             }
-            GrB_free (&iterator) ;
-            GrB_free (&riterator) ;
-            GRB_TRY (GrB_Vector_build (d_15, I, f15, n, NULL)) ;
-
-            free (neighbors) ;
-            free (k4cmn) ;
-            free (f15) ;
-            free (I) ;
-            free (isNeighbor) ;
+
+            GrB_free (&C_t) ;
         }
 
-    }
+        //----------------------------------------------------------------------
+        // d_12 = C_{4,2}e/2, with P_2 = A_t*A without its diagonal
+        //----------------------------------------------------------------------
 
-    //--------------------------------------------------------------------------
-    // construct raw frequencies matrix F_raw
-    //--------------------------------------------------------------------------
+        if (need [12])
+        {
+            GRB_TRY (GrB_Matrix_new (&W_t, GrB_INT64, nb, n)) ;
+            GRB_TRY (GrB_mxm (W_t, NULL, NULL, LAGraph_plus_one_int64, A_t, A,
+                NULL)) ;
+            // entry (r,b0+r) of W_t is on the diagonal of A*A
+            GRB_TRY (GrB_select (W_t, NULL, NULL, GrB_OFFDIAG, W_t,
+                (int64_t) b0, NULL)) ;
+            GRB_TRY (GrB_apply (W_t, NULL, NULL, Sub_one_mult, W_t, NULL)) ;
+            GRB_TRY (GrB_reduce (t, NULL, NULL, GrB_PLUS_MONOID_INT64, W_t,
+                NULL)) ;
+            LG_TRY (fglt_scatter (Raw [12] + off, nb, t, I, Y, msg)) ;
+            GrB_free (&W_t) ;
+        }
 
-    GRB_TRY (GrB_Matrix_new (&F_raw, GrB_INT64, 16, n)) ;
+        //----------------------------------------------------------------------
+        // d_13 = D_{4,c}e/2, with D_{4,c} = hadamard(A_t, A_t*(C_3-1))
+        //----------------------------------------------------------------------
 
-    GrB_Vector d[16] = {d_0, d_1, d_2, d_3, d_4, d_5, d_6, d_7, d_8, d_9, d_10, d_11, d_12, d_13, d_14, d_15} ;
+        if (need [13])
+        {
+            GRB_TRY (GrB_Matrix_new (&W_t, GrB_INT64, nb, n)) ;
+            GRB_TRY (GrB_mxm (W_t, A_t, NULL, LAGraph_plus_second_int64, A_t,
+                C_3, GrB_DESC_S)) ;
+            GRB_TRY (GrB_reduce (t, NULL, NULL, GrB_PLUS_MONOID_INT64, W_t,
+                NULL)) ;
+            LG_TRY (fglt_scatter (Raw [13] + off, nb, t, I, Y, msg)) ;
+            GrB_free (&W_t) ;
+        }
 
-    for (int i = 0; i < 15 + (compute_d_15 ? 1 : 0); ++i) {
-        GRB_TRY (GrB_Vector_nvals (&nvals, d[i]));
+        GrB_free (&A_t) ;
+        GrB_free (&t) ;
 
-        GrB_Index *J = (GrB_Index*) malloc (nvals*sizeof(GrB_Index)) ;
-        int64_t *vals = (int64_t*) malloc (nvals*sizeof(int64_t)) ;
+        //----------------------------------------------------------------------
+        // the remaining terms are elementwise
+        //----------------------------------------------------------------------
 
-        GRB_TRY (GrB_Vector_extractTuples (J, vals, &nvals, d[i])) ;
-        for (int j = 0; j < nvals; ++j) {
-            GRB_TRY (GrB_Matrix_setElement (F_raw, vals[j], i, J[j])) ;
+        int64_t r ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (r = 0 ; r < (int64_t) nb ; r++)
+        {
+            int64_t p = P1 [r] ;
+            int64_t d2 = W [r] - p ;
+            int64_t c3 = need_c3 ? C3 [r] : 0 ;
+            int64_t v = off + r ;
+            if (need [ 0]) Raw [ 0][v] = 1 ;
+            if (need [ 1]) Raw [ 1][v] = p ;
+            if (need [ 2]) Raw [ 2][v] = d2 ;
+            if (need [ 3]) Raw [ 3][v] = p * (p-1) / 2 ;
+            if (need [ 4]) Raw [ 4][v] = c3 ;
+            if (need [ 5]) Raw [ 5][v] -= p * (p-1) + 2 * c3 ;
+            if (need [ 6]) Raw [ 6][v] = d2 * (p-1) - 2 * c3 ;
+            if (need [ 7]) Raw [ 7][v] /= 2 ;
+            if (need [ 8]) Raw [ 8][v] = p * (p-1) * (p-2) / 6 ;
+            if (need [ 9]) Raw [ 9][v] -= 2 * c3 ;
+            if (need [11]) Raw [11][v] = (p-2) * c3 ;
+            if (need [12]) Raw [12][v] /= 2 ;
+            if (need [13]) Raw [13][v] /= 2 ;
+            if (need [14]) Raw [14][v] /= 2 ;
         }
-
-        free (J) ;
-        free (vals) ;
     }
 
     //--------------------------------------------------------------------------
-    // construct U_inv
+    // d_15 = Te/6: the K4 counts
     //--------------------------------------------------------------------------
 
-    GRB_TRY (GrB_Matrix_new (&U_inv, GrB_INT64, 16, 16)) ;
-
-    GRB_TRY (GrB_Matrix_build (U_inv, U_inv_I, U_inv_J, U_inv_X, U_inv_nvals, GrB_PLUS_INT64)) ;
-    //GRB_TRY (GxB_print (U_inv, 3)) ;
+    if (need [15])
+    {
+        LG_TRY (LAGraph_KTruss (&T, G, 4, msg)) ;
+        LG_TRY (fglt_k4 (Raw [15], T, vfirst, vlast, nthreads, msg)) ;
+        GrB_free (&T) ;
+    }
 
     //--------------------------------------------------------------------------
-    // construct net frequencies matrix F_net
+    // F_net = U_inv * F_raw, for the requested orbits
     //--------------------------------------------------------------------------
 
-    GRB_TRY (GrB_Matrix_new (F_net, GrB_INT64, 16, n)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Fi, nr1, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Fx, nr1, sizeof (int64_t), msg)) ;
+    GRB_TRY (GrB_Matrix_new (&F, GrB_INT64, 16, nr)) ;
 
-    GRB_TRY (GrB_mxm (*F_net, NULL, NULL, GxB_PLUS_TIMES_INT64, U_inv, F_raw, NULL)) ;
+    for (int e0 = 0, e1 ; e0 < U_INV_NVALS ; e0 = e1)
+    {
+        // U_inv (i,:) is held in entries e0:e1-1
+        GrB_Index i = U_inv_I [e0] ;
+        for (e1 = e0 ; e1 < U_INV_NVALS && U_inv_I [e1] == i ; e1++) ;
+        if (!want [i]) continue ;
 
-    GrB_Vector f_net = NULL ;
-    GRB_TRY (GrB_Vector_new (&f_net, GrB_INT64, 16)) ;
-    GRB_TRY (GrB_reduce (f_net, NULL, NULL, GrB_PLUS_INT64, *F_net, NULL)) ;
-    GRB_TRY (GxB_print (f_net, 3)) ;
-    GRB_TRY (GrB_free (&f_net)) ;
-    //GRB_TRY (GxB_print (*F_net, 3)) ;
+        int64_t v ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (v = 0 ; v < (int64_t) nr ; v++)
+        {
+            int64_t s = 0 ;
+            for (int e = e0 ; e < e1 ; e++)
+            {
+                // Raw [15] is NULL if d_15 is not computed
+                int64_t *R = Raw [U_inv_J [e]] ;
+                if (R != NULL) s += U_inv_X [e] * R [v] ;
+            }
+            Fx [v] = s ;
+        }
+
+        // F (i,:) = the nonzeros of Fx
+        GrB_Index nz = 0 ;
+        for (v = 0 ; v < (int64_t) nr ; v++)
+        {
+            if (Fx [v] == 0) continue ;
+            Fi [nz] = v ;
+            Fx [nz++] = Fx [v] ;
+        }
+        GRB_TRY (GrB_Vector_new (&f, GrB_INT64, nr)) ;
+        GRB_TRY (GrB_Vector_build_INT64 (f, Fi, Fx, nz, GrB_PLUS_INT64)) ;
+        GRB_TRY (GrB_Row_assign (F, NULL, NULL, f, i, GrB_ALL, nr, NULL)) ;
+        GrB_free (&f) ;
+    }
+
+    GRB_TRY (GrB_wait (F, GrB_MATERIALIZE)) ;
 
     //--------------------------------------------------------------------------
-    // free work
+    // free workspace and return result
     //--------------------------------------------------------------------------
 
     LG_FREE_WORK ;
-
-    return (0) ;
+    (*F_net) = F ;
+    return (GrB_SUCCESS) ;
 }
 
+//------------------------------------------------------------------------------
+// LAGraph_FastGraphletTransform
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL ;
+
+int LAGraph_FastGraphletTransform
+(
+    // outputs:
+    GrB_Matrix *F_net,  // 16-by-n matrix of graphlet counts
+    // inputs:
+    LAGraph_Graph G,
+    bool compute_d_15,  // probably this makes most sense
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+    return (LAGraph_FastGraphletTransform_Range (F_net, G, compute_d_15, NULL,
+        0, n, msg)) ;
+}
@@ -0,0 +1,386 @@
+//------------------------------------------------------------------------------
+// LAGraph_IncrementalCC: connected components under edge insertions
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2021 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+// See additional acknowledgments in the LICENSE file,
+// or contact permission@sei.cmu.edu for the full terms.
+
+//------------------------------------------------------------------------------
+
+// The connected components of an undirected graph are computed once with
+// LAGr_ConnectedComponents (FastSV6 if SuiteSparse:GraphBLAS is in use, or
+// Boruvka otherwise).  The resulting component vector is a valid union-find
+// forest of depth one: parent [i] = r if node i is in the component whose
+// representative is r, and parent [r] = r.  This forest is kept in a
+// non-opaque uint64_t array, and batches of edges are then merged into it.
+
+// Each edge (u,v) is inserted by a lock-free union: the roots of u and v are
+// found, and the root with the larger index is linked to the root with the
+// smaller index with an atomic compare-and-swap.  If the compare-and-swap
+// fails, another thread has modified the root in the meantime, and the union
+// is retried.  Since parent [i] <= i always holds, the forest cannot contain a
+// cycle, and the representative of each component is always its node with the
+// smallest index.  The find operation uses path halving, where each node
+// visited is linked to its grandparent, also with a compare-and-swap.  Parent
+// pointers only ever move upwards in the forest, so a failed path-halving
+// update can safely be ignored.
+
+// Edge deletions cannot be handled incrementally.  If the graph loses any
+// edges, the state must be recomputed with LAGraph_IncrementalCC_Recompute.
+
+// References:
+
+// Richard J. Anderson and Heather Woll, Wait-free parallel algorithms for the
+// union-find problem, STOC 1991.
+
+// Siddhartha V. Jayanti and Robert E. Tarjan, A randomized concurrent
+// algorithm for disjoint set union, PODC 2016.
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+//------------------------------------------------------------------------------
+// LG_uf_find: find the root of node i, with path halving
+//------------------------------------------------------------------------------
+
+static inline uint64_t LG_uf_find (uint64_t *parent, uint64_t i)
+{
+    while (true)
+    {
+        uint64_t p = LG_ATOMIC_READ_UINT64 (&parent [i]) ;
+        if (p == i) return (i) ;
+        uint64_t gp = LG_ATOMIC_READ_UINT64 (&parent [p]) ;
+        if (gp != p)
+        {
+            // link i to its grandparent; if this fails, some other thread
+            // has already moved parent [i] further up the tree
+            LG_ATOMIC_CAS_UINT64 (&parent [i], p, gp) ;
+        }
+        i = gp ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// LG_uf_union: merge the components of u and v
+//------------------------------------------------------------------------------
+
+// Returns true if two distinct components were merged.
+
+static inline bool LG_uf_union (uint64_t *parent, uint64_t u, uint64_t v)
+{
+    while (true)
+    {
+        u = LG_uf_find (parent, u) ;
+        v = LG_uf_find (parent, v) ;
+        if (u == v) return (false) ;
+        // link the root with the larger index to the one with smaller index
+        if (u < v) { uint64_t t = u ; u = v ; v = t ; }
+        if (LG_ATOMIC_CAS_UINT64 (&parent [u], u, v)) return (true) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// LG_incremental_cc_compute: compute the forest from scratch
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL GrB_free (&component) ;
+
+static int LG_incremental_cc_compute
+(
+    LAGraph_IncrementalCC State,
+    LAGraph_Graph G,
+    char *msg
+)
+{
+    GrB_Vector component = NULL ;
+    GrB_Index n = State->n ;
+
+    // component = connected components of G
+    LG_TRY (LAGr_ConnectedComponents (&component, G, msg)) ;
+
+    // parent = component, typecasting it to uint64 if necessary
+    GRB_TRY (GrB_Vector_extractTuples (NULL, State->parent, &n, component)) ;
+    LG_ASSERT (n == State->n, GrB_INVALID_VALUE) ;
+    GRB_TRY (GrB_free (&component)) ;
+
+    // count the number of components
+    int nthreads, nthreads_outer, nthreads_inner ;
+    LG_TRY (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+    nthreads = nthreads_outer * nthreads_inner ;
+    nthreads = LAGRAPH_MIN (nthreads, n / 1024) ;
+    nthreads = LAGRAPH_MAX (nthreads, 1) ;
+    const uint64_t *parent = State->parent ;
+    int64_t ncomponents = 0 ;
+    int64_t i ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(+:ncomponents)
+    for (i = 0 ; i < n ; i++)
+    {
+        if (parent [i] == i) ncomponents++ ;
+    }
+    State->ncomponents = ncomponents ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_IncrementalCC_New: create the incremental state
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL LAGraph_IncrementalCC_Free (State, NULL) ;
+
+int LAGraph_IncrementalCC_New
+(
+    // output:
+    LAGraph_IncrementalCC *State,
+    // input:
+    LAGraph_Graph G,
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    LG_ASSERT (State != NULL, GrB_NULL_POINTER) ;
+    (*State) = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+
+    //--------------------------------------------------------------------------
+    // allocate the state
+    //--------------------------------------------------------------------------
+
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+    LG_TRY (LAGraph_Calloc ((void **) State, 1,
+        sizeof (struct LAGraph_IncrementalCC_struct), msg)) ;
+    (*State)->n = n ;
+    (*State)->ncomponents = LAGRAPH_UNKNOWN ;
+    LG_TRY (LAGraph_Malloc ((void **) &((*State)->parent), n,
+        sizeof (uint64_t), msg)) ;
+
+    //--------------------------------------------------------------------------
+    // compute the connected components of G
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LG_incremental_cc_compute (*State, G, msg)) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_IncrementalCC_Recompute: recompute the state from scratch
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL ;
+
+int LAGraph_IncrementalCC_Recompute
+(
+    // input/output:
+    LAGraph_IncrementalCC State,
+    // input:
+    LAGraph_Graph G,
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    LG_ASSERT (State != NULL, GrB_NULL_POINTER) ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+    LG_ASSERT_MSG (n == State->n, GrB_DIMENSION_MISMATCH,
+        "G must have the same number of nodes as the incremental state") ;
+    State->ncomponents = LAGRAPH_UNKNOWN ;
+    LG_TRY (LG_incremental_cc_compute (State, G, msg)) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_IncrementalCC_Insert: insert a batch of edges
+//------------------------------------------------------------------------------
+
+int LAGraph_IncrementalCC_Insert
+(
+    // input/output:
+    LAGraph_IncrementalCC State,
+    // input:
+    const GrB_Index *I,
+    const GrB_Index *J,
+    GrB_Index nedges,
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    LG_ASSERT (State != NULL, GrB_NULL_POINTER) ;
+    LG_ASSERT (I != NULL && J != NULL, GrB_NULL_POINTER) ;
+    const GrB_Index n = State->n ;
+
+    int nthreads, nthreads_outer, nthreads_inner ;
+    LG_TRY (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+    nthreads = nthreads_outer * nthreads_inner ;
+    nthreads = LAGRAPH_MIN (nthreads, nedges / 1024) ;
+    nthreads = LAGRAPH_MAX (nthreads, 1) ;
+
+    int64_t k, nbad = 0 ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(+:nbad)
+    for (k = 0 ; k < nedges ; k++)
+    {
+        if (I [k] >= n || J [k] >= n) nbad++ ;
+    }
+    LG_ASSERT_MSG (nbad == 0, GrB_INVALID_INDEX, "edge node out of range") ;
+
+    //--------------------------------------------------------------------------
+    // merge each edge into the union-find forest
+    //--------------------------------------------------------------------------
+
+    uint64_t *parent = State->parent ;
+    int64_t nmerged = 0 ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(+:nmerged)
+    for (k = 0 ; k < nedges ; k++)
+    {
+        if (LG_uf_union (parent, I [k], J [k])) nmerged++ ;
+    }
+
+    State->ncomponents -= nmerged ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_IncrementalCC_Find: find the representative of a node
+//------------------------------------------------------------------------------
+
+int LAGraph_IncrementalCC_Find
+(
+    // output:
+    GrB_Index *rep,
+    // input:
+    LAGraph_IncrementalCC State,
+    GrB_Index i,
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    LG_ASSERT (rep != NULL && State != NULL, GrB_NULL_POINTER) ;
+    LG_ASSERT_MSG (i < State->n, GrB_INVALID_INDEX, "node out of range") ;
+    (*rep) = LG_uf_find (State->parent, i) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_IncrementalCC_Component: return the component vector
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_WORK
+#define LG_FREE_WORK                            \
+{                                               \
+    LAGraph_Free ((void **) &X, NULL) ;         \
+    LAGraph_Free ((void **) &Ind, NULL) ;       \
+}
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL                             \
+{                                               \
+    LG_FREE_WORK ;                              \
+    GrB_free (component) ;                      \
+}
+
+int LAGraph_IncrementalCC_Component
+(
+    // output:
+    GrB_Vector *component,
+    // input:
+    LAGraph_IncrementalCC State,
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    uint64_t *X = NULL ;
+    GrB_Index *Ind = NULL ;
+    LG_ASSERT (component != NULL && State != NULL, GrB_NULL_POINTER) ;
+    (*component) = NULL ;
+    const GrB_Index n = State->n ;
+
+    int nthreads, nthreads_outer, nthreads_inner ;
+    LG_TRY (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+    nthreads = nthreads_outer * nthreads_inner ;
+    nthreads = LAGRAPH_MIN (nthreads, n / 1024) ;
+    nthreads = LAGRAPH_MAX (nthreads, 1) ;
+
+    //--------------------------------------------------------------------------
+    // flatten the forest and copy it into X
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_Malloc ((void **) &X, n, sizeof (uint64_t), msg)) ;
+    uint64_t *parent = State->parent ;
+    int64_t i ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (i = 0 ; i < n ; i++)
+    {
+        uint64_t r = LG_uf_find (parent, i) ;
+        parent [i] = r ;
+        X [i] = r ;
+    }
+
+    //--------------------------------------------------------------------------
+    // construct the component vector from X
+    //--------------------------------------------------------------------------
+
+    #if LAGRAPH_SUITESPARSE
+    {
+        // move X into the component vector, as a full vector
+        GRB_TRY (GxB_Vector_import_Full (component, GrB_UINT64, n,
+            (void **) &X, n * sizeof (uint64_t), false, NULL)) ;
+    }
+    #else
+    {
+        LG_TRY (LAGraph_Malloc ((void **) &Ind, n, sizeof (GrB_Index), msg)) ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (i = 0 ; i < n ; i++)
+        {
+            Ind [i] = i ;
+        }
+        GRB_TRY (GrB_Vector_new (component, GrB_UINT64, n)) ;
+        GRB_TRY (GrB_Vector_build (*component, Ind, X, n, GrB_PLUS_UINT64)) ;
+    }
+    #endif
+
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_IncrementalCC_Free: free the incremental state
+//------------------------------------------------------------------------------
+
+int LAGraph_IncrementalCC_Free
+(
+    // input/output:
+    LAGraph_IncrementalCC *State,
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    if (State != NULL && (*State) != NULL)
+    {
+        LAGraph_Free ((void **) &((*State)->parent), NULL) ;
+        LAGraph_Free ((void **) State, NULL) ;
+    }
+    return (GrB_SUCCESS) ;
+}
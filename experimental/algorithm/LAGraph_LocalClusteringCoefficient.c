@@ -0,0 +1,191 @@
+//------------------------------------------------------------------------------
+// LAGraph_LocalClusteringCoefficient: local clustering coefficient of a graph
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2021 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+// See additional acknowledgments in the LICENSE file,
+// or contact permission@sei.cmu.edu for the full terms.
+
+//------------------------------------------------------------------------------
+
+// LAGraph_LocalClusteringCoefficient computes the same metric as LAGraph_lcc
+// (see LAGraph_lcc.c for its definition), but for an LAGraph_Graph:
+
+//  lcc(v) = ntri(v) / (|N(v)| * (|N(v)|-1))     if G is directed
+//  lcc(v) = ntri(v) / (|N(v)| * (|N(v)|-1) / 2) if G is undirected
+
+// where ntri(v) is the number of edges between the neighbors of v (the number
+// of triangles containing v, if G is undirected).  The values of G->A are
+// ignored: all products use structural masks and the PLUS_ONE semiring, so
+// no sanitized copy of G->A is made.  No user-defined operators are needed.
+
+// If G has a symmetric structure, |N(v)| is G->out_degree, which is computed
+// if not already cached.  Otherwise N(v) is the pattern of A+A', which uses
+// G->AT if it is cached.  G must not have self edges (G->nself_edges is
+// computed if not known).
+
+// If the per-node counts ntri are already available (from a triangle count
+// or truss computation, for example), they can be passed in as the optional
+// input vector ntri, and no triangles are counted at all.  Otherwise ntri is
+// NULL.  Entries not present in ntri are taken as zero.
+
+// lcc(v) does not appear in the output vector if v has fewer than 2
+// neighbors, or if ntri(v) is not present.
+
+#define LG_FREE_WORK                \
+{                                   \
+    GrB_free (&C) ;                 \
+    GrB_free (&AT) ;                \
+    GrB_free (&U) ;                 \
+    GrB_free (&X) ;                 \
+    GrB_free (&T) ;                 \
+    GrB_free (&D) ;                 \
+    GrB_free (&W) ;                 \
+}
+
+#define LG_FREE_ALL                 \
+{                                   \
+    LG_FREE_WORK ;                  \
+    GrB_free (&LCC) ;               \
+}
+
+#include "LG_internal.h"
+#include <LAGraphX.h>
+
+int LAGraph_LocalClusteringCoefficient
+(
+    // output:
+    GrB_Vector *lcc,            // lcc (v) for each node v, of type GrB_FP64
+    // input/output:
+    LAGraph_Graph G,            // out_degree and nself_edges may be computed
+    // input:
+    const GrB_Vector ntri,      // optional: edges between neighbors of each
+                                // node; NULL to compute it
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Matrix C = NULL, AT = NULL, U = NULL, X = NULL ;
+    GrB_Vector T = NULL, D = NULL, W = NULL, LCC = NULL ;
+    LG_ASSERT (lcc != NULL, GrB_NULL_POINTER) ;
+    (*lcc) = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+
+    LG_TRY (LAGraph_Cached_NSelfEdges (G, msg)) ;
+    LG_ASSERT_MSG (G->nself_edges == 0, LAGRAPH_NO_SELF_EDGES_ALLOWED,
+        "G->nself_edges must be zero") ;
+
+    GrB_Matrix A = G->A ;
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+
+    bool undirected = (G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+       (G->kind == LAGraph_ADJACENCY_DIRECTED &&
+        G->is_symmetric_structure == LAGraph_TRUE)) ;
+
+    //--------------------------------------------------------------------------
+    // D = |N(v)| for each node v
+    //--------------------------------------------------------------------------
+
+    if (undirected)
+    {
+        // N(v) is the pattern of A(v,:)
+        LG_TRY (LAGraph_Cached_OutDegree (G, msg)) ;
+        GRB_TRY (GrB_Vector_dup (&D, G->out_degree)) ;
+    }
+    else
+    {
+        // C = pattern of A+A', using G->AT if it is cached
+        GrB_Matrix A_transpose = G->AT ;
+        if (A_transpose == NULL)
+        {
+            GRB_TRY (GrB_Matrix_new (&AT, GrB_BOOL, n, n)) ;
+            GRB_TRY (GrB_transpose (AT, NULL, NULL, A, NULL)) ;
+            A_transpose = AT ;
+        }
+        GRB_TRY (GrB_Matrix_new (&C, GrB_BOOL, n, n)) ;
+        GRB_TRY (GrB_assign (C, A, NULL, (bool) true, GrB_ALL, n, GrB_ALL, n,
+            GrB_DESC_S)) ;
+        GRB_TRY (GrB_assign (C, A_transpose, NULL, (bool) true, GrB_ALL, n,
+            GrB_ALL, n, GrB_DESC_S)) ;
+        GrB_free (&AT) ;
+
+        // D(v) = |N(v)|, the # of entries in C(v,:), all of which are true
+        GRB_TRY (GrB_Vector_new (&D, GrB_INT64, n)) ;
+        GRB_TRY (GrB_reduce (D, NULL, NULL, GrB_PLUS_MONOID_INT64, C, NULL)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // W = |N(v)| * (|N(v)|-1), halved if undirected, for |N(v)| >= 2
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_Vector_new (&W, GrB_INT64, n)) ;
+    GRB_TRY (GrB_apply (W, NULL, NULL, GrB_MINUS_INT64, D, (int64_t) 1,
+        NULL)) ;
+    GRB_TRY (GrB_eWiseMult (W, NULL, NULL, GrB_TIMES_INT64, W, D, NULL)) ;
+    if (undirected)
+    {
+        GRB_TRY (GrB_apply (W, NULL, NULL, GrB_DIV_INT64, W, (int64_t) 2,
+            NULL)) ;
+    }
+    GRB_TRY (GrB_select (W, NULL, NULL, GrB_VALUEGT_INT64, W, (int64_t) 0,
+        NULL)) ;
+    GrB_free (&D) ;
+
+    //--------------------------------------------------------------------------
+    // T = ntri, or count the edges between the neighbors of each node
+    //--------------------------------------------------------------------------
+
+    GrB_Vector Tri = ntri ;
+    if (Tri == NULL)
+    {
+        if (undirected)
+        {
+            // X<A,struct> = A*U' where U = triu (A): X(i,j) is the # of
+            // triangles (i,j,k) with k > j, so X(i,:) sums to the # of
+            // triangles containing i.
+            GRB_TRY (GrB_Matrix_new (&U, GrB_BOOL, n, n)) ;
+            GRB_TRY (GrB_select (U, NULL, NULL, GrB_TRIU, A, (int64_t) 0,
+                NULL)) ;
+            GRB_TRY (GrB_Matrix_new (&X, GrB_INT64, n, n)) ;
+            GRB_TRY (GrB_mxm (X, A, NULL, LAGraph_plus_one_int64, A, U,
+                GrB_DESC_ST1)) ;
+            GrB_free (&U) ;
+        }
+        else
+        {
+            // X<C,struct> = C*A: X(v,w) is the # of u in N(v) with an edge
+            // (u,w), so X(v,:) sums to the # of edges between the nodes of
+            // N(v), counting (u,w) and (w,u) separately.
+            GRB_TRY (GrB_Matrix_new (&X, GrB_INT64, n, n)) ;
+            GRB_TRY (GrB_mxm (X, C, NULL, LAGraph_plus_one_int64, C, A,
+                GrB_DESC_S)) ;
+        }
+        GRB_TRY (GrB_Vector_new (&T, GrB_INT64, n)) ;
+        GRB_TRY (GrB_reduce (T, NULL, NULL, GrB_PLUS_MONOID_INT64, X, NULL)) ;
+        GrB_free (&X) ;
+        Tri = T ;
+    }
+    GrB_free (&C) ;
+
+    //--------------------------------------------------------------------------
+    // LCC = T ./ W
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_Vector_new (&LCC, GrB_FP64, n)) ;
+    GRB_TRY (GrB_eWiseMult (LCC, NULL, NULL, GrB_DIV_FP64, Tri, W, NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_WORK ;
+    (*lcc) = LCC ;
+    return (GrB_SUCCESS) ;
+}
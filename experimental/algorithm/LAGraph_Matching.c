@@ -0,0 +1,316 @@
+//------------------------------------------------------------------------------
+// LAGraph_Matching: maximal and approximate maximum-weight matching
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2021 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+// See additional acknowledgments in the LICENSE file,
+// or contact permission@sei.cmu.edu for the full terms.
+
+//------------------------------------------------------------------------------
+
+// A matching is a set of edges, no two of which share a node.  Both methods
+// find a set of locally dominant edges in each round: each node selects its
+// heaviest remaining edge, and an edge is matched if it is selected by both of
+// its nodes.  The matched nodes and all their edges are then removed, and the
+// process repeats until no edges remain.  The result is a maximal matching.
+
+//  LAGraph_Matching_Luby: each edge (i,j) is given a random weight
+//      LG_Random64 (seed, min(i,j), max(i,j)), which depends only on the seed
+//      and the edge.  A matched edge has a larger weight than all adjacent
+//      edges, so this is Luby's maximal independent set algorithm on the line
+//      graph of G (in which the edges of G are the nodes), but the line graph
+//      is never constructed.
+
+//  LAGraph_Matching_LocallyDominant: the edge weights are the entries of G->A
+//      (typecast to double), which gives a 1/2-approximation to the maximum
+//      weight matching [Preis 1999; Manne and Bisseling 2007].  Edges with a
+//      weight <= 0 are never matched.  The seed is not used.
+
+// Ties are broken by the edge (min(i,j), max(i,j)), so the edges are totally
+// ordered, the heaviest remaining edge is always matched, and the method
+// always makes progress.  For a node i, this order is the same as the order of
+// the neighbor j, so each edge is held as a (weight key, j) pair of a user-
+// defined type, as in LAGraph_msf, and the heaviest edge of each node is found
+// by reducing the rows of the matrix with a monoid that returns the larger
+// pair.  This matrix of pairs (16 bytes per entry) is the only copy of the
+// graph held; it shrinks in each round as edges are removed with GrB_select,
+// with the matched nodes passed to the select operator in the thunk, as in
+// LAGraph_msf.  All other work is O(n) per round, and is done in parallel.
+
+// On output, mate(i) = j if the edge (i,j) is in the matching, and mate(i)
+// is not present if i is unmatched.  nmatched is the number of edges in the
+// matching.  G must be undirected, or directed with a symmetric structure.
+// Self edges are ignored.
+
+#define LG_FREE_WORK                                \
+{                                                   \
+    GrB_free (&K) ;                                 \
+    GrB_free (&best) ;                              \
+    GrB_free (&Edge) ;                              \
+    GrB_free (&emax) ;                              \
+    GrB_free (&emaxMonoid) ;                        \
+    GrB_free (&make_key) ;                          \
+    GrB_free (&keep) ;                              \
+    LAGraph_Free ((void **) &I, NULL) ;             \
+    LAGraph_Free ((void **) &X, NULL) ;             \
+    LAGraph_Free ((void **) &partner, NULL) ;       \
+    LAGraph_Free ((void **) &Mate, NULL) ;          \
+}
+
+#define LG_FREE_ALL                                 \
+{                                                   \
+    LG_FREE_WORK ;                                  \
+    GrB_free (mate) ;                               \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+//------------------------------------------------------------------------------
+// edges and their operators
+//------------------------------------------------------------------------------
+
+// An edge (i,j) in row i of K, as a (weight key, j) pair
+typedef struct
+{
+    uint64_t wt ;       // the key of the edge weight
+    uint64_t idx ;      // the other node of the edge, j
+}
+match_edge ;
+
+#define MATCH_SIGN64 (((uint64_t) 1) << 63)
+
+// z = max (x,y), comparing the weight key first and then the node
+static void edge_max (void *z, const void *x, const void *y)
+{
+    const match_edge *a = (const match_edge *) x ;
+    const match_edge *b = (const match_edge *) y ;
+    bool a_gt_b = (a->wt > b->wt) || (a->wt == b->wt && a->idx >= b->idx) ;
+    (*(match_edge *) z) = a_gt_b ? (*a) : (*b) ;
+}
+
+// z = (random key, j), for the edge A(i,j); y is the seed
+static void key_random (void *z, const void *x,
+    const GrB_Index i, const GrB_Index j, const void *y)
+{
+    uint64_t seed = (*(const uint64_t *) y) ;
+    uint64_t lo = LAGRAPH_MIN (i, j) ;
+    uint64_t hi = LAGRAPH_MAX (i, j) ;
+    match_edge e ;
+    e.wt  = LG_Random64 (seed, lo, hi) ;
+    e.idx = j ;
+    (*(match_edge *) z) = e ;
+}
+
+// z = (key of the weight x, j), for the edge A(i,j)=x, where the unsigned
+// ordering of the keys is the same as the ordering of the weights
+static void key_weight (void *z, const void *x,
+    const GrB_Index i, const GrB_Index j, const void *y)
+{
+    uint64_t k ;
+    memcpy (&k, x, sizeof (double)) ;
+    match_edge e ;
+    e.wt  = (k & MATCH_SIGN64) ? (~k) : (k | MATCH_SIGN64) ;
+    e.idx = j ;
+    (*(match_edge *) z) = e ;
+}
+
+// edges are removed with a select operator, with its state in the thunk
+typedef struct
+{
+    const int64_t *Mate ;   // Mate [i] >= 0 if node i is matched
+    uint64_t minkey ;       // edges with smaller weight keys are removed
+}
+match_thunk ;
+
+// K(i,j) is kept if i and j are unmatched, i != j, and its key is >= minkey
+static void keep_edge (void *z, const void *x,
+    const GrB_Index i, const GrB_Index j, const void *y)
+{
+    const match_thunk *T = (*(const match_thunk **) y) ;
+    const match_edge *e = (const match_edge *) x ;
+    (*(bool *) z) = (i != j) && (T->Mate [i] < 0) && (T->Mate [j] < 0) &&
+        (e->wt >= T->minkey) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Matching
+//------------------------------------------------------------------------------
+
+int LAGraph_Matching
+(
+    // outputs:
+    GrB_Vector *mate,           // mate(i) = j if (i,j) is in the matching
+    GrB_Index *nmatched,        // # of edges in the matching
+    // inputs:
+    LAGraph_Graph G,            // input graph
+    LAGraph_Matching_Method method,     // how to weight the edges
+    uint64_t seed,              // random number seed
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Matrix K = NULL ;               // the remaining edges, as pairs
+    GrB_Vector best = NULL ;            // the heaviest edge of each node
+    GrB_Type Edge = NULL ;
+    GrB_BinaryOp emax = NULL ;
+    GrB_Monoid emaxMonoid = NULL ;
+    GrB_IndexUnaryOp make_key = NULL, keep = NULL ;
+    GrB_Index *I = NULL ;
+    int64_t *partner = NULL ;
+    match_edge *X = NULL ;
+    int64_t *Mate = NULL ;
+
+    LG_ASSERT (mate != NULL && nmatched != NULL, GrB_NULL_POINTER) ;
+    (*mate) = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    LG_ASSERT_MSG (method == LAGraph_Matching_Luby ||
+        method == LAGraph_Matching_LocallyDominant, GrB_INVALID_VALUE,
+        "method is invalid") ;
+
+    if (G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+       (G->kind == LAGraph_ADJACENCY_DIRECTED &&
+        G->is_symmetric_structure == LAGraph_TRUE))
+    {
+        // the structure of A is known to be symmetric
+        ;
+    }
+    else
+    {
+        // A is not known to be symmetric
+        LG_ASSERT_MSG (false, -105, "G->A must be symmetric") ;
+    }
+
+    int nthreads_outer, nthreads_inner ;
+    LG_TRY (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+    int nthreads = nthreads_outer * nthreads_inner ;
+
+    //--------------------------------------------------------------------------
+    // create the edge type and its operators
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_Type_new (&Edge, sizeof (match_edge))) ;
+    match_edge zero = { .wt = 0, .idx = 0 } ;
+    GRB_TRY (GrB_BinaryOp_new (&emax, edge_max, Edge, Edge, Edge)) ;
+    GRB_TRY (GrB_Monoid_new_UDT (&emaxMonoid, emax, &zero)) ;
+    GRB_TRY (GrB_IndexUnaryOp_new (&make_key,
+        (method == LAGraph_Matching_Luby) ? key_random : key_weight,
+        Edge, GrB_FP64, GrB_UINT64)) ;
+    GRB_TRY (GrB_IndexUnaryOp_new (&keep, keep_edge, GrB_BOOL, Edge,
+        GrB_UINT64)) ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace
+    //--------------------------------------------------------------------------
+
+    GrB_Index n, nvals ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+    GRB_TRY (GrB_Matrix_new (&K, Edge, n, n)) ;
+    GRB_TRY (GrB_Vector_new (&best, Edge, n)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &I, n, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &X, n, sizeof (match_edge), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &partner, n, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Mate, n, sizeof (int64_t), msg)) ;
+
+    int64_t i ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (i = 0 ; i < n ; i++)
+    {
+        Mate [i] = -1 ;
+        partner [i] = -1 ;
+    }
+
+    // remove self edges, and edges of weight <= 0 (a weight of +0 has the key
+    // MATCH_SIGN64, and the smallest positive weight has the next key)
+    match_thunk thunk = { .Mate = Mate,
+        .minkey = (method == LAGraph_Matching_Luby) ? 0 : (MATCH_SIGN64+1) } ;
+    uint64_t thunk_ptr = (uint64_t) (&thunk) ;
+
+    // K(i,j) = (key of A(i,j), j)
+    GRB_TRY (GrB_apply (K, NULL, NULL, make_key, G->A, seed, NULL)) ;
+    GRB_TRY (GrB_select (K, NULL, NULL, keep, K, thunk_ptr, NULL)) ;
+    GRB_TRY (GrB_Matrix_nvals (&nvals, K)) ;
+
+    //--------------------------------------------------------------------------
+    // match the locally dominant edges, until no edges remain
+    //--------------------------------------------------------------------------
+
+    while (nvals > 0)
+    {
+        // best(i) = the heaviest edge of each node i with remaining edges
+        GrB_Index nbest = n ;
+        GRB_TRY (GrB_reduce (best, NULL, NULL, emaxMonoid, K, NULL)) ;
+        GRB_TRY (GrB_Vector_extractTuples_UDT (I, X, &nbest, best)) ;
+
+        // partner [i] = j if node i selects the edge (i,j), or -1 if node i
+        // has no remaining edges
+        int64_t k ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < nbest ; k++)
+        {
+            partner [I [k]] = (int64_t) X [k].idx ;
+        }
+
+        // the edge (i,j) is matched if it is selected by both i and j.  K
+        // need not be symmetric: if the weights of A are not, K(i,j) may be
+        // kept while K(j,i) is removed, and then node j may have no edge left
+        // and partner [j] is -1.
+        int64_t nnew = 0 ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+            reduction(+:nnew)
+        for (k = 0 ; k < nbest ; k++)
+        {
+            int64_t u = (int64_t) I [k] ;
+            int64_t v = partner [u] ;
+            if (partner [v] == u)
+            {
+                Mate [u] = v ;
+                nnew++ ;
+            }
+        }
+
+        // clear partner for the next round
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < nbest ; k++)
+        {
+            partner [I [k]] = -1 ;
+        }
+
+        // The heaviest remaining edge is always matched, unless the weights
+        // are not symmetric, in which case the selections can form a cycle.
+        LG_ASSERT_MSG (nnew > 0, -106, "edge weights must be symmetric") ;
+
+        // remove the matched nodes and all their edges
+        GRB_TRY (GrB_select (K, NULL, NULL, keep, K, thunk_ptr, NULL)) ;
+        GRB_TRY (GrB_Matrix_nvals (&nvals, K)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // construct the result
+    //--------------------------------------------------------------------------
+
+    // I and partner are reused to hold the matched nodes and their mates
+    GrB_Index nm = 0 ;
+    for (i = 0 ; i < n ; i++)
+    {
+        if (Mate [i] >= 0)
+        {
+            I [nm] = i ;
+            partner [nm] = Mate [i] ;
+            nm++ ;
+        }
+    }
+    GRB_TRY (GrB_Vector_new (mate, GrB_INT64, n)) ;
+    GRB_TRY (GrB_Vector_build_INT64 (*mate, I, partner, nm,
+        GrB_PLUS_INT64)) ;
+    (*nmatched) = nm / 2 ;
+
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
@@ -68,6 +68,8 @@
 // operates on undirected or symmetric graphs, we only need to compute the
 // upper (or lower) triangle of P2, which should reduce memory by about half.
 // However, this is not easy to do, and would complicate the implementation.
+// LAGraph_SquareClustering_Blocked computes the same result one row of P2 at
+// a time, with memory bounded by the largest 2-hop neighborhood instead.
 
 //------------------------------------------------------------------------------
 
@@ -75,6 +77,7 @@
 {                                   \
     GrB_free (&squares) ;           \
     GrB_free (&denom) ;             \
+    GrB_free (&neg_denom) ;         \
 }
 
 #define LG_FREE_ALL                 \
@@ -0,0 +1,366 @@
+//------------------------------------------------------------------------------
+// LAGraph_SquareClustering_Blocked: vertex square-clustering, one row at a time
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2022 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+// See additional acknowledgments in the LICENSE file,
+// or contact permission@sei.cmu.edu for the full terms.
+
+//------------------------------------------------------------------------------
+
+// Computes the same square clustering coefficient as LAGraph_SquareClustering
+// (see that file for the definition and the terms of the denominator), but
+// without forming P2 = A*A'.  On graphs with a heavy-tailed degree
+// distribution, P2 has about sum (degree(u)^2) entries, mostly from the rows
+// of the hubs and their neighbors, and can be far larger than A.
+
+// Instead, row i of P2 is computed on its own, in a per-thread hash table
+// keyed by the 2-hop neighbor w:  P2(i,w) = # of common neighbors of i and w.
+// All four terms of the coefficient for node i are then found from that row:
+//
+//    tri(i)        = sum of P2(i,w) for w in N(i)
+//    squares(i)    = sum of P2(i,w) * (P2(i,w) - 1) / 2 over all w
+//    uw_count(i)   = d(i) * (d(i) - 1)
+//    uw_degrees(i) = (sum of d(u) for u in N(i)) * (d(i) - 1)
+//
+// and the coefficient is written directly into the result.  The nodes are
+// split into blocks of consecutive rows with about the same number of wedges
+// (paths of length 2), and the blocks are scheduled dynamically across the
+// threads.  The workspace is O(n) for the result, plus a hash table per
+// thread sized by the largest 2-hop neighborhood that the thread has seen.
+
+// G->A is unpacked in place (SuiteSparse:GraphBLAS) and returned unchanged.
+// The degrees are taken from the pattern of G->A, so G->out_degree is not
+// required.  Without SuiteSparse, LAGraph_SquareClustering is used instead.
+// As in LAGraph_SquareClustering, 0 values are omitted from the result.
+
+//------------------------------------------------------------------------------
+
+#define LG_FREE_WORK                                \
+{                                                   \
+    LAGraph_Free ((void **) &Wedges, NULL) ;        \
+    LAGraph_Free ((void **) &Block, NULL) ;         \
+    LAGraph_Free ((void **) &Ri, NULL) ;            \
+    LAGraph_Free ((void **) &Rx, NULL) ;            \
+}
+
+#define LG_FREE_ALL                                 \
+{                                                   \
+    SQ_REPACK ;                                     \
+    LG_FREE_WORK ;                                  \
+    GrB_free (&r) ;                                 \
+}
+
+#include <LAGraph.h>
+#include <LAGraphX.h>
+#include <LG_internal.h>  // from src/utility
+
+// return G->A to its original state, if it has been unpacked
+#if LAGRAPH_SUITESPARSE
+#define SQ_REPACK                                                       \
+{                                                                       \
+    if (unpacked)                                                       \
+    {                                                                   \
+        GxB_Matrix_pack_CSR (A, &Ap, &Aj, &Ax, Ap_size, Aj_size,        \
+            Ax_size, iso, jumbled, NULL) ;                              \
+        unpacked = false ;                                              \
+    }                                                                   \
+}
+#else
+#define SQ_REPACK ;
+#endif
+
+// # of blocks per thread, for load balancing
+#define SQ_BLOCKS_PER_THREAD 64
+
+//------------------------------------------------------------------------------
+// sq_hash: hash table for one row of P2
+//------------------------------------------------------------------------------
+
+// The table has size 2^bits, with linear probing.  An empty slot has key -1.
+// The slots in use are listed in Used [0..nused-1], so the table can be
+// cleared in time proportional to the # of entries in the row.
+
+typedef struct
+{
+    int64_t *Key ;
+    int64_t *Count ;
+    int64_t *Used ;
+    int64_t nused ;
+    int bits ;
+}
+sq_hash ;
+
+static void sq_hash_free (sq_hash *H)
+{
+    LAGraph_Free ((void **) &(H->Key), NULL) ;
+    LAGraph_Free ((void **) &(H->Count), NULL) ;
+    LAGraph_Free ((void **) &(H->Used), NULL) ;
+    H->bits = 0 ;
+}
+
+// ensure the table can hold nkeys entries, at a load factor of at most 1/2
+static bool sq_hash_reserve (sq_hash *H, int64_t nkeys)
+{
+    int bits = 4 ;
+    while ((((int64_t) 1) << bits) < 2 * nkeys) bits++ ;
+    if (bits <= H->bits) return (true) ;
+    sq_hash_free (H) ;
+    int64_t size = ((int64_t) 1) << bits ;
+    if (LAGraph_Malloc ((void **) &(H->Key), size, sizeof (int64_t), NULL)
+        != GrB_SUCCESS ||
+        LAGraph_Malloc ((void **) &(H->Count), size, sizeof (int64_t), NULL)
+        != GrB_SUCCESS ||
+        LAGraph_Malloc ((void **) &(H->Used), size, sizeof (int64_t), NULL)
+        != GrB_SUCCESS)
+    {
+        sq_hash_free (H) ;
+        return (false) ;
+    }
+    for (int64_t k = 0 ; k < size ; k++)
+    {
+        H->Key [k] = -1 ;
+    }
+    H->bits = bits ;
+    H->nused = 0 ;
+    return (true) ;
+}
+
+static inline int64_t sq_hash_slot (const sq_hash *H, int64_t key)
+{
+    int64_t mask = (((int64_t) 1) << H->bits) - 1 ;
+    int64_t h = (int64_t)
+        (((uint64_t) key * 0x9E3779B97F4A7C15ULL) >> (64 - H->bits)) ;
+    while (H->Key [h] != key && H->Key [h] != -1)
+    {
+        h = (h + 1) & mask ;
+    }
+    return (h) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_SquareClustering_Blocked
+//------------------------------------------------------------------------------
+
+int LAGraph_SquareClustering_Blocked
+(
+    // outputs:
+    GrB_Vector *square_clustering,
+    // inputs:
+    LAGraph_Graph G,
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Vector r = NULL ;
+    int64_t *Wedges = NULL, *Block = NULL ;
+    GrB_Index *Ri = NULL ;
+    double *Rx = NULL ;
+    GrB_Matrix A = NULL ;
+    GrB_Index *Ap = NULL, *Aj = NULL ;
+    void *Ax = NULL ;
+    GrB_Index Ap_size = 0, Aj_size = 0, Ax_size = 0 ;
+    bool iso = false, jumbled = false, unpacked = false ;
+
+    LG_ASSERT (square_clustering != NULL, GrB_NULL_POINTER) ;
+    (*square_clustering) = NULL ;
+
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+
+    LG_ASSERT_MSG ((G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+       (G->kind == LAGraph_ADJACENCY_DIRECTED &&
+        G->is_symmetric_structure == LAGraph_TRUE)),
+        LAGRAPH_SYMMETRIC_STRUCTURE_REQUIRED,
+        "G->A must be known to be symmetric") ;
+
+    #if !LAGRAPH_SUITESPARSE
+    {
+        // the rows of G->A cannot be accessed directly
+        LG_TRY (LAGraph_Cached_OutDegree (G, msg)) ;
+        return (LAGraph_SquareClustering (square_clustering, G, msg)) ;
+    }
+    #else
+
+    A = G->A ;
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+    int nthreads_outer, nthreads_inner ;
+    LG_TRY (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+    int nthreads = nthreads_outer * nthreads_inner ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace and unpack G->A
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_Malloc ((void **) &Wedges, n+1, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Rx, LAGRAPH_MAX (n, 1),
+        sizeof (double), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Ri, LAGRAPH_MAX (n, 1),
+        sizeof (GrB_Index), msg)) ;
+
+    // the rows of A need not be sorted
+    GRB_TRY (GxB_Matrix_unpack_CSR (A, &Ap, &Aj, &Ax, &Ap_size, &Aj_size,
+        &Ax_size, &iso, &jumbled, NULL)) ;
+    unpacked = true ;
+
+    //--------------------------------------------------------------------------
+    // Wedges = cumulative sum of the work for each node
+    //--------------------------------------------------------------------------
+
+    // The work for node i is d(i) plus the sum of the degrees of its
+    // neighbors, which is also the most entries that row i of P2 can have.
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1024)
+    for (k = 0 ; k < (int64_t) n ; k++)
+    {
+        int64_t w = Ap [k+1] - Ap [k] ;
+        for (int64_t p = Ap [k] ; p < (int64_t) Ap [k+1] ; p++)
+        {
+            int64_t u = Aj [p] ;
+            w += Ap [u+1] - Ap [u] ;
+        }
+        Wedges [k] = w ;
+    }
+    int64_t total = 0 ;
+    for (k = 0 ; k < (int64_t) n ; k++)
+    {
+        int64_t w = Wedges [k] ;
+        Wedges [k] = total ;
+        total += w ;
+    }
+    Wedges [n] = total ;
+
+    //--------------------------------------------------------------------------
+    // split the nodes into blocks of about the same work
+    //--------------------------------------------------------------------------
+
+    int64_t nblocks = LAGRAPH_MIN ((int64_t) n,
+        (int64_t) nthreads * SQ_BLOCKS_PER_THREAD) ;
+    nblocks = LAGRAPH_MAX (nblocks, 1) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Block, nblocks+1, sizeof (int64_t),
+        msg)) ;
+    Block [0] = 0 ;
+    for (int64_t b = 1 ; b < nblocks ; b++)
+    {
+        // Block [b] = first node i with Wedges [i] >= target
+        int64_t target = (int64_t) (((double) b / (double) nblocks) *
+            (double) total) ;
+        int64_t lo = Block [b-1], hi = n ;
+        while (lo < hi)
+        {
+            int64_t mid = lo + (hi - lo) / 2 ;
+            if (Wedges [mid] < target) lo = mid + 1 ; else hi = mid ;
+        }
+        Block [b] = lo ;
+    }
+    Block [nblocks] = n ;
+
+    //--------------------------------------------------------------------------
+    // compute the coefficient of each node, one row of P2 at a time
+    //--------------------------------------------------------------------------
+
+    int nfail = 0 ;
+    #pragma omp parallel num_threads(nthreads) reduction(+:nfail)
+    {
+        sq_hash H = { NULL, NULL, NULL, 0, 0 } ;
+
+        #pragma omp for schedule(dynamic,1)
+        for (int64_t b = 0 ; b < nblocks ; b++)
+        {
+            for (int64_t i = Block [b] ; i < Block [b+1] ; i++)
+            {
+                Rx [i] = 0 ;
+                int64_t pi_start = Ap [i], pi_end = Ap [i+1] ;
+                int64_t di = pi_end - pi_start ;
+                if (di < 2 || nfail > 0) continue ;
+
+                // sum of the degrees of the neighbors of i
+                int64_t sum_du = Wedges [i+1] - Wedges [i] - di ;
+                if (!sq_hash_reserve (&H, LAGRAPH_MIN (sum_du, (int64_t) n)))
+                {
+                    nfail++ ;
+                    continue ;
+                }
+
+                // P2 (i,:) = sum of A (u,:) for all u in N(i), except P2 (i,i)
+                for (int64_t p = pi_start ; p < pi_end ; p++)
+                {
+                    int64_t u = Aj [p] ;
+                    for (int64_t q = Ap [u] ; q < (int64_t) Ap [u+1] ; q++)
+                    {
+                        int64_t w = Aj [q] ;
+                        if (w == i) continue ;
+                        int64_t h = sq_hash_slot (&H, w) ;
+                        if (H.Key [h] == -1)
+                        {
+                            H.Key [h] = w ;
+                            H.Count [h] = 0 ;
+                            H.Used [H.nused++] = h ;
+                        }
+                        H.Count [h]++ ;
+                    }
+                }
+
+                // tri = sum of P2 (i,u) for all u in N(i)
+                int64_t tri = 0 ;
+                for (int64_t p = pi_start ; p < pi_end ; p++)
+                {
+                    int64_t h = sq_hash_slot (&H, Aj [p]) ;
+                    if (H.Key [h] != -1) tri += H.Count [h] ;
+                }
+
+                // squares = sum of P2 (i,:) .* (P2 (i,:) - 1) / 2, and clear H
+                int64_t squares = 0 ;
+                for (int64_t t = 0 ; t < H.nused ; t++)
+                {
+                    int64_t h = H.Used [t] ;
+                    int64_t c = H.Count [h] ;
+                    squares += c * (c - 1) ;
+                    H.Key [h] = -1 ;
+                }
+                H.nused = 0 ;
+                squares /= 2 ;
+                if (squares == 0) continue ;
+
+                // denom = uw_degrees - uw_count - tri - squares
+                int64_t denom = sum_du * (di - 1) - di * (di - 1) - tri
+                    - squares ;
+                Rx [i] = ((double) squares) / ((double) denom) ;
+            }
+        }
+
+        sq_hash_free (&H) ;
+    }
+
+    SQ_REPACK ;
+    LG_ASSERT (nfail == 0, GrB_OUT_OF_MEMORY) ;
+
+    //--------------------------------------------------------------------------
+    // r = the nonzeros of Rx
+    //--------------------------------------------------------------------------
+
+    GrB_Index nz = 0 ;
+    for (k = 0 ; k < (int64_t) n ; k++)
+    {
+        if (Rx [k] == 0) continue ;
+        Ri [nz] = k ;
+        Rx [nz++] = Rx [k] ;
+    }
+    GRB_TRY (GrB_Vector_new (&r, GrB_FP64, n)) ;
+    GRB_TRY (GrB_Vector_build_FP64 (r, Ri, Rx, nz, GrB_PLUS_FP64)) ;
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_WORK ;
+    (*square_clustering) = r ;
+    return (GrB_SUCCESS) ;
+    #endif
+}
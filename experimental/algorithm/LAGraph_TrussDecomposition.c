@@ -0,0 +1,160 @@
+//------------------------------------------------------------------------------
+// LAGraph_TrussDecomposition.c: truss number of each edge of a graph
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2021 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+// See additional acknowledgments in the LICENSE file,
+// or contact permission@sei.cmu.edu for the full terms.
+
+//------------------------------------------------------------------------------
+
+// LAGraph_TrussDecomposition: find the truss number of each edge, via
+// GraphBLAS.
+
+// Given a symmetric graph A with no-self edges, T(i,j) is the truss number of
+// the edge (i,j): the largest k such that the edge is in the k-truss of A.  An
+// edge that is in no triangle has a truss number of 2.  T has the same pattern
+// as A, and is returned as a symmetric GrB_UINT32 matrix.  The k-truss of A is
+// the subgraph of entries in T that are >= k.  kmax is the smallest k for
+// which the k-truss is empty, as in LAGraph_AllKTruss.
+
+// The support of each edge (the number of triangles it is in) is computed
+// once, with C{A} = A*A'.  The edges are then peeled: at level k, all edges
+// with support less than k-2 are removed, and their truss number is k-1.  The
+// support of the remaining edges is not recomputed.  Instead, it is reduced by
+// the number of triangles lost with the removed edges R.  If C is the pattern
+// of the edges that remain, a triangle (i,j,x) with (i,j) in C is lost if
+// (i,x), (x,j), or both are in R, and the number of these triangles is the
+// (i,j) entry of R*C + C*R + R*R.  This work is proportional to the edges
+// incident on the removed edges, so the whole decomposition costs about one
+// triangle count.  Levels at which no edge is removed are skipped: once the
+// level k is done, the next level is the smallest support plus 3.
+
+#define LG_FREE_WORK                        \
+{                                           \
+    GrB_free (&C) ;                         \
+    GrB_free (&R) ;                         \
+}
+
+#define LG_FREE_ALL                         \
+{                                           \
+    LG_FREE_WORK ;                          \
+    GrB_free (T) ;                          \
+}
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+int LAGraph_TrussDecomposition
+(
+    // outputs:
+    GrB_Matrix *T,      // T(i,j) is the truss number of the edge (i,j)
+    int64_t *kmax,      // smallest k where the k-truss is empty
+    // input:
+    LAGraph_Graph G,    // input graph
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Matrix C = NULL, R = NULL ;
+    LG_ASSERT (T != NULL && kmax != NULL, GrB_NULL_POINTER) ;
+    (*T) = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+
+    if (G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+       (G->kind == LAGraph_ADJACENCY_DIRECTED &&
+        G->is_symmetric_structure == LAGraph_TRUE))
+    {
+        // the structure of A is known to be symmetric
+        ;
+    }
+    else
+    {
+        // A is not known to be symmetric
+        LG_ASSERT_MSG (false, -1005, "G->A must be symmetric") ;
+    }
+
+    // no self edges can be present
+    LG_ASSERT_MSG (G->nself_edges == 0, -1004, "G->nself_edges must be zero") ;
+
+    //--------------------------------------------------------------------------
+    // compute the support of each edge
+    //--------------------------------------------------------------------------
+
+    GrB_Index n, nvals, nremoved ;
+    GrB_Matrix A = G->A ;
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+    GRB_TRY (GrB_Matrix_new (T, GrB_UINT32, n, n)) ;
+    GRB_TRY (GrB_Matrix_new (&C, GrB_UINT32, n, n)) ;
+    GRB_TRY (GrB_Matrix_new (&R, GrB_UINT32, n, n)) ;
+
+    // C{A} = A*A'
+    GRB_TRY (GrB_mxm (C, A, NULL, LAGraph_plus_one_uint32, A, A,
+        GrB_DESC_ST1)) ;
+
+    // edges in no triangle have a truss number of 2
+    GRB_TRY (GrB_assign (*T, A, NULL, (uint32_t) 2, GrB_ALL, n, GrB_ALL, n,
+        GrB_DESC_S)) ;
+
+    //--------------------------------------------------------------------------
+    // peel the edges, one level at a time
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_Matrix_nvals (&nvals, C)) ;
+    uint32_t k = 3 ;
+    while (nvals > 0)
+    {
+        // skip to the next level at which an edge is removed
+        uint32_t minsupport ;
+        GRB_TRY (GrB_reduce (&minsupport, NULL, GrB_MIN_MONOID_UINT32, C,
+            NULL)) ;
+        k = LAGRAPH_MAX (k, minsupport + 3) ;
+
+        while (true)
+        {
+            // R = edges with support less than k-2
+            GRB_TRY (GrB_select (R, NULL, NULL, GrB_VALUELT_UINT32, C, k-2,
+                NULL)) ;
+            GRB_TRY (GrB_Matrix_nvals (&nremoved, R)) ;
+            if (nremoved == 0) break ;
+
+            // the removed edges have a truss number of k-1
+            GRB_TRY (GrB_assign (*T, R, NULL, k-1, GrB_ALL, n, GrB_ALL, n,
+                GrB_DESC_S)) ;
+
+            // remove the edges in R from C
+            GRB_TRY (GrB_select (C, NULL, NULL, GrB_VALUEGE_UINT32, C, k-2,
+                NULL)) ;
+            nvals -= nremoved ;
+            if (nvals == 0) break ;
+
+            // C{C} -= R*C + C*R + R*R, the triangles lost with R
+            GRB_TRY (GrB_mxm (C, C, GrB_MINUS_UINT32, LAGraph_plus_one_uint32,
+                R, C, GrB_DESC_S)) ;
+            GRB_TRY (GrB_mxm (C, C, GrB_MINUS_UINT32, LAGraph_plus_one_uint32,
+                C, R, GrB_DESC_S)) ;
+            GRB_TRY (GrB_mxm (C, C, GrB_MINUS_UINT32, LAGraph_plus_one_uint32,
+                R, R, GrB_DESC_S)) ;
+        }
+        k++ ;
+    }
+
+    // the k-truss is empty for all k larger than every truss number
+    GrB_Index nt = 0 ;
+    GRB_TRY (GrB_Matrix_nvals (&nt, *T)) ;
+    uint32_t tmax = 2 ;
+    if (nt > 0)
+    {
+        GRB_TRY (GrB_reduce (&tmax, NULL, GrB_MAX_MONOID_UINT32, *T, NULL)) ;
+    }
+    (*kmax) = LAGRAPH_MAX (tmax + 1, 3) ;
+
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
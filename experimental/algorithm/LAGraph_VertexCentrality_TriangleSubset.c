@@ -0,0 +1,238 @@
+//------------------------------------------------------------------------------
+// LAGraph_VertexCentrality_TriangleSubset: triangle-centrality of a subset
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2021 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+// See additional acknowledgments in the LICENSE file,
+// or contact permission@sei.cmu.edu for the full terms.
+
+//------------------------------------------------------------------------------
+
+// LAGraph_VertexCentrality_TriangleSubset: computes the triangle centrality of
+// a subset of the nodes of an undirected graph, using the same definition as
+// LAGraph_VertexCentrality_Triangle (see that file for references):
+
+//      T = A.plus_pair(A, mask=A)      # the per-edge triangle support
+//      y = T.reduce_vector()
+//      k = y.reduce_float()
+//      c = (3 * A.plus_second(y) - 2 * T.plus_second(y) + y) / k
+
+// The support matrix T is the expensive part of the computation.  It does
+// not depend on the subset, so it can be computed once and reused across many
+// calls (one batch of nodes at a time, for example).  If Support is NULL, T
+// is computed and freed.  If (*Support) is NULL on input, T is computed and
+// returned in (*Support) for use in subsequent calls.  Otherwise (*Support) is
+// taken as T: an n-by-n matrix where T(i,j) is the number of triangles
+// containing the edge (i,j), of any real type.  Entries of T may be missing or
+// explicitly zero for edges that are in no triangle.
+
+// Given T, only the rows of T and A for the nodes in the subset S are
+// accessed, and y is computed only for S and its 1-hop neighborhood.  The
+// scalar k requires a reduction of all of T, which is cheap compared with
+// computing T itself.
+
+// The subset is given as a list of nvertices node indices, which must not
+// contain duplicates.  If vertices is NULL, all nodes are used, and the
+// result is identical to LAGraph_VertexCentrality_Triangle.  On output,
+// centrality(i) is present for each node i in the subset, and no others.
+
+// The graph must be undirected (or directed with a known symmetric structure),
+// with no self edges.  The values of G->A are ignored.
+
+#define LG_FREE_WORK                \
+{                                   \
+    GrB_free (&T) ;                 \
+    GrB_free (&AS) ;                \
+    GrB_free (&TS) ;                \
+    GrB_free (&r) ;                 \
+    GrB_free (&y) ;                 \
+    GrB_free (&u) ;                 \
+    GrB_free (&w) ;                 \
+    GrB_free (&c) ;                 \
+}
+
+#define LG_FREE_ALL                 \
+{                                   \
+    LG_FREE_WORK ;                  \
+    GrB_free (centrality) ;         \
+}
+
+#include "LG_internal.h"
+#include <LAGraphX.h>
+
+//------------------------------------------------------------------------------
+// LAGraph_VertexCentrality_TriangleSubset
+//------------------------------------------------------------------------------
+
+int LAGraph_VertexCentrality_TriangleSubset
+(
+    // outputs:
+    GrB_Vector *centrality,     // centrality(i): triangle centrality of i,
+                                // for each node i in the subset
+    uint64_t *ntriangles,       // # of triangles in the graph
+    // input/output:
+    GrB_Matrix *Support,        // optional per-edge triangle support; computed
+                                // and returned if (*Support) is NULL
+    // inputs:
+    LAGraph_Graph G,            // input graph
+    const GrB_Index *vertices,  // list of nodes; NULL for all nodes
+    GrB_Index nvertices,        // # of entries in vertices
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Matrix T = NULL, AS = NULL, TS = NULL, A = NULL ;
+    GrB_Vector r = NULL, y = NULL, u = NULL, w = NULL, c = NULL ;
+
+    LG_ASSERT (centrality != NULL && ntriangles != NULL, GrB_NULL_POINTER) ;
+    (*centrality) = NULL ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+
+    if (G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+       (G->kind == LAGraph_ADJACENCY_DIRECTED &&
+        G->is_symmetric_structure == LAGraph_TRUE))
+    {
+        // the structure of A is known to be symmetric
+        A = G->A ;
+    }
+    else
+    {
+        // A is not known to be symmetric
+        LG_ASSERT_MSG (false, -1005, "G->A must be symmetric") ;
+    }
+
+    // no self edges can be present
+    LG_ASSERT_MSG (G->nself_edges == 0, -1004, "G->nself_edges must be zero") ;
+
+    GrB_Index n ;
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+
+    const GrB_Index *I = vertices ;
+    GrB_Index ns = nvertices ;
+    if (vertices == NULL)
+    {
+        I = GrB_ALL ;
+        ns = n ;
+    }
+    else
+    {
+        for (GrB_Index k = 0 ; k < ns ; k++)
+        {
+            LG_ASSERT_MSG (vertices [k] < n, GrB_INVALID_INDEX,
+                "invalid node in vertices list") ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // get or compute the per-edge triangle support
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix S = (Support == NULL) ? NULL : (*Support) ;
+    if (S == NULL)
+    {
+        // T<A,struct> = A*A', the # of triangles containing each edge
+        GRB_TRY (GrB_Matrix_new (&T, GrB_FP64, n, n)) ;
+        GRB_TRY (GrB_mxm (T, A, NULL, LAGraph_plus_one_fp64, A, A,
+            GrB_DESC_ST1)) ;
+        S = T ;
+    }
+    else
+    {
+        GrB_Index nrows, ncols ;
+        GRB_TRY (GrB_Matrix_nrows (&nrows, S)) ;
+        GRB_TRY (GrB_Matrix_ncols (&ncols, S)) ;
+        LG_ASSERT_MSG (nrows == n && ncols == n, GrB_DIMENSION_MISMATCH,
+            "Support must be n-by-n") ;
+    }
+
+    //--------------------------------------------------------------------------
+    // k = sum (T), which is 6 times the # of triangles
+    //--------------------------------------------------------------------------
+
+    double k = 0 ;
+    GRB_TRY (GrB_reduce (&k, NULL, GrB_PLUS_MONOID_FP64, S, NULL)) ;
+    (*ntriangles) = (uint64_t) (k/6) ;
+
+    //--------------------------------------------------------------------------
+    // AS = A(S,:) and TS = T(S,:), with explicit zeros dropped from TS
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_Matrix_new (&AS, GrB_BOOL, ns, n)) ;
+    GRB_TRY (GrB_extract (AS, NULL, NULL, A, I, ns, GrB_ALL, n, NULL)) ;
+    GRB_TRY (GrB_Matrix_new (&TS, GrB_FP64, ns, n)) ;
+    GRB_TRY (GrB_extract (TS, NULL, NULL, S, I, ns, GrB_ALL, n, NULL)) ;
+    GRB_TRY (GrB_select (TS, NULL, NULL, GrB_VALUENE_FP64, TS, (double) 0,
+        NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // y<r> = row sums of T, where r is the subset and its neighbors
+    //--------------------------------------------------------------------------
+
+    // r(j) is present if node j is adjacent to any node in the subset
+    GRB_TRY (GrB_Vector_new (&r, GrB_BOOL, n)) ;
+    GRB_TRY (GrB_reduce (r, NULL, NULL, GrB_LOR_MONOID_BOOL, AS,
+        GrB_DESC_T0)) ;
+    GRB_TRY (GrB_assign (r, NULL, NULL, (bool) true, I, ns, NULL)) ;
+
+    // y<r,struct> = T*e, for a full vector e; only rows of T in r are used
+    GRB_TRY (GrB_Vector_new (&y, GrB_FP64, n)) ;
+    GRB_TRY (GrB_Vector_new (&u, GrB_FP64, n)) ;
+    GRB_TRY (GrB_assign (u, NULL, NULL, (double) 1, GrB_ALL, n, NULL)) ;
+    GRB_TRY (GrB_mxv (y, r, NULL, LAGraph_plus_first_fp64, S, u, GrB_DESC_S)) ;
+    GrB_free (&u) ;
+    GrB_free (&r) ;
+
+    //--------------------------------------------------------------------------
+    // c = (3 * AS*y - 2 * TS*y + y(S)) / k
+    //--------------------------------------------------------------------------
+
+    // c = y(S), with zeros for nodes in no triangle
+    GRB_TRY (GrB_Vector_new (&c, GrB_FP64, ns)) ;
+    GRB_TRY (GrB_assign (c, NULL, NULL, (double) 0, GrB_ALL, ns, NULL)) ;
+    GRB_TRY (GrB_extract (c, NULL, GrB_PLUS_FP64, y, I, ns, NULL)) ;
+
+    // u = AS*y, w = TS*y
+    GRB_TRY (GrB_Vector_new (&u, GrB_FP64, ns)) ;
+    GRB_TRY (GrB_mxv (u, NULL, NULL, LAGraph_plus_second_fp64, AS, y, NULL)) ;
+    GRB_TRY (GrB_Vector_new (&w, GrB_FP64, ns)) ;
+    GRB_TRY (GrB_mxv (w, NULL, NULL, LAGraph_plus_second_fp64, TS, y, NULL)) ;
+
+    // c += 3*u - 2*w
+    GRB_TRY (GrB_apply (u, NULL, NULL, GrB_TIMES_FP64, (double) 3, u, NULL)) ;
+    GRB_TRY (GrB_apply (w, NULL, NULL, GrB_TIMES_FP64, (double) 2, w, NULL)) ;
+    GRB_TRY (GrB_eWiseAdd (c, NULL, GrB_PLUS_FP64, GrB_PLUS_FP64, c, u,
+        NULL)) ;
+    GRB_TRY (GrB_eWiseAdd (c, NULL, GrB_MINUS_FP64, GrB_PLUS_FP64, c, w,
+        NULL)) ;
+
+    // c = c / k (k is zero only if G has no triangles, and then c is zero)
+    if (k != 0)
+    {
+        GRB_TRY (GrB_apply (c, NULL, NULL, GrB_DIV_FP64, c, k, NULL)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // centrality(S) = c
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_Vector_new (centrality, GrB_FP64, n)) ;
+    GRB_TRY (GrB_assign (*centrality, NULL, NULL, c, I, ns, NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // return the support, if requested, and free workspace
+    //--------------------------------------------------------------------------
+
+    if (Support != NULL && (*Support) == NULL)
+    {
+        (*Support) = S ;
+        T = NULL ;
+    }
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
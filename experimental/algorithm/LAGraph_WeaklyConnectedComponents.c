@@ -0,0 +1,315 @@
+//------------------------------------------------------------------------------
+// LAGraph_WeaklyConnectedComponents: weakly connected components
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2021 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+// See additional acknowledgments in the LICENSE file,
+// or contact permission@sei.cmu.edu for the full terms.
+
+//------------------------------------------------------------------------------
+
+// The weakly connected components of a directed graph are the connected
+// components of the undirected graph with adjacency matrix A+A'.  This method
+// computes them with the FastSV algorithm (as in LG_CC_FastSV6), but without
+// constructing A+A'.  The hooking step of FastSV computes
+//
+//      mngp = min (mngp, (A+A')*gp)
+//
+// with the MIN_SECOND semiring.  This is computed as
+//
+//      mngp = min (mngp, A*gp)     pull step with A
+//      mngp = min (mngp, AT*gp)    pull step with G->AT, if it is cached
+//
+// or, if G->AT is not cached,
+//
+//      mngp = min (mngp, gp'*A)    push step with A, with the MIN_FIRST
+//                                  semiring
+//
+// The resulting component vector is identical to the one computed by
+// LAGr_ConnectedComponents on a graph with adjacency matrix A+A': component(i)
+// is the smallest node index in the component containing node i.
+
+// If the graph is undirected, or directed with a symmetric structure, then
+// LAGr_ConnectedComponents is used instead.  G->A and G->AT are not modified
+// in any case.
+
+// Unlike LG_CC_FastSV6, this method has no sampling phase, since that phase
+// relies on the structure of A being symmetric when it prunes the edges
+// incident on the largest component.
+
+// This method requires SuiteSparse:GraphBLAS, since it uses the GxB pack/unpack
+// methods.
+
+#define LG_FREE_ALL ;
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+#if LAGRAPH_SUITESPARSE
+
+//==============================================================================
+// fastsv_weak: find the weakly connected components of a graph
+//==============================================================================
+
+static inline GrB_Info fastsv_weak
+(
+    GrB_Matrix A,           // adjacency matrix, G->A
+    GrB_Matrix AT,          // G->AT, or NULL if not available
+    GrB_Vector parent,      // parent vector
+    GrB_Vector mngp,        // min neighbor grandparent
+    GrB_Vector *gp,         // grandparent
+    GrB_Vector *gp_new,     // new grandparent (swapped with gp)
+    GrB_Vector t,           // workspace
+    GrB_BinaryOp eq,        // GrB_EQ_(integer type)
+    GrB_BinaryOp min,       // GrB_MIN_(integer type)
+    GrB_Semiring min_2nd,   // GrB_MIN_SECOND_(integer type)
+    GrB_Semiring min_1st,   // GrB_MIN_FIRST_(integer type)
+    GrB_Matrix C,           // C(i,j) present if i = Px (j)
+    GrB_Index **Cp,         // 0:n, size n+1
+    GrB_Index **Px,         // Px: non-opaque copy of parent vector, size n
+    void **Cx,              // size 1, contents not accessed
+    char *msg
+)
+{
+    GrB_Index n ;
+    GRB_TRY (GrB_Vector_size (&n, parent)) ;
+    GrB_Index Cp_size = (n+1) * sizeof (GrB_Index) ;
+    GrB_Index Ci_size = n * sizeof (GrB_Index) ;
+    GrB_Index Cx_size = sizeof (bool) ;
+    bool iso = true, jumbled = false, done = false ;
+
+    while (true)
+    {
+
+        //----------------------------------------------------------------------
+        // hooking & shortcutting, with both A and A'
+        //----------------------------------------------------------------------
+
+        // mngp = min (mngp, A*gp) using the MIN_SECOND semiring
+        GRB_TRY (GrB_mxv (mngp, NULL, min, min_2nd, A, *gp, NULL)) ;
+
+        if (AT != NULL)
+        {
+            // mngp = min (mngp, AT*gp) using the MIN_SECOND semiring
+            GRB_TRY (GrB_mxv (mngp, NULL, min, min_2nd, AT, *gp, NULL)) ;
+        }
+        else
+        {
+            // mngp = min (mngp, gp'*A) using the MIN_FIRST semiring
+            GRB_TRY (GrB_vxm (mngp, NULL, min, min_1st, *gp, A, NULL)) ;
+        }
+
+        //----------------------------------------------------------------------
+        // parent = min (parent, C*mngp) where C(i,j) is present if i=Px(j)
+        //----------------------------------------------------------------------
+
+        // See LG_CC_FastSV6 for a description of this step.
+        GRB_TRY (GxB_Matrix_pack_CSC (C, Cp, /* Px is Ci: */ Px, Cx,
+            Cp_size, Ci_size, Cx_size, iso, jumbled, NULL)) ;
+        GRB_TRY (GrB_mxv (parent, NULL, min, min_2nd, C, mngp, NULL)) ;
+        GRB_TRY (GxB_Matrix_unpack_CSC (C, Cp, Px, Cx,
+            &Cp_size, &Ci_size, &Cx_size, &iso, &jumbled, NULL)) ;
+
+        //----------------------------------------------------------------------
+        // parent = min (parent, mngp, gp)
+        //----------------------------------------------------------------------
+
+        GRB_TRY (GrB_eWiseAdd (parent, NULL, min, min, mngp, *gp, NULL)) ;
+
+        //----------------------------------------------------------------------
+        // calculate grandparent: gp_new = parent (parent), and extract Px
+        //----------------------------------------------------------------------
+
+        GRB_TRY (GrB_Vector_extractTuples (NULL, *Px, &n, parent)) ;
+        GRB_TRY (GrB_extract (*gp_new, NULL, NULL, parent, *Px, n, NULL)) ;
+
+        //----------------------------------------------------------------------
+        // terminate if gp and gp_new are the same
+        //----------------------------------------------------------------------
+
+        GRB_TRY (GrB_eWiseMult (t, NULL, NULL, eq, *gp_new, *gp, NULL)) ;
+        GRB_TRY (GrB_reduce (&done, NULL, GrB_LAND_MONOID_BOOL, t, NULL)) ;
+        if (done) break ;
+
+        // swap gp and gp_new
+        GrB_Vector s = (*gp) ; (*gp) = (*gp_new) ; (*gp_new) = s ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//==============================================================================
+// LAGraph_WeaklyConnectedComponents
+//==============================================================================
+
+#undef  LG_FREE_WORK
+#define LG_FREE_WORK                            \
+{                                               \
+    LAGraph_Free ((void **) &Cp, NULL) ;        \
+    LAGraph_Free ((void **) &Px, NULL) ;        \
+    LAGraph_Free ((void **) &Cx, NULL) ;        \
+    GrB_free (&C) ;                             \
+    GrB_free (&t) ;                             \
+    GrB_free (&y) ;                             \
+    GrB_free (&gp) ;                            \
+    GrB_free (&mngp) ;                          \
+    GrB_free (&gp_new) ;                        \
+}
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL                             \
+{                                               \
+    LG_FREE_WORK ;                              \
+    GrB_free (&parent) ;                        \
+}
+
+#endif
+
+int LAGraph_WeaklyConnectedComponents
+(
+    // output:
+    GrB_Vector *component,  // component(i)=r if node is in the component r
+    // input:
+    const LAGraph_Graph G,  // input graph, not modified
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    #if LAGRAPH_SUITESPARSE
+    GrB_Index n, Cp_size = 0, *Px = NULL, *Cp = NULL ;
+    GrB_Vector parent = NULL, gp_new = NULL, mngp = NULL, gp = NULL, t = NULL,
+        y = NULL ;
+    GrB_Matrix C = NULL ;
+    void *Cx = NULL ;
+    #endif
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    LG_ASSERT (component != NULL, GrB_NULL_POINTER) ;
+
+    if (G->kind == LAGraph_ADJACENCY_UNDIRECTED ||
+       (G->kind == LAGraph_ADJACENCY_DIRECTED &&
+        G->is_symmetric_structure == LAGraph_TRUE))
+    {
+        // the weakly connected components are the connected components
+        return (LAGr_ConnectedComponents (component, G, msg)) ;
+    }
+
+#if !LAGRAPH_SUITESPARSE
+    LG_ASSERT (false, GrB_NOT_IMPLEMENTED) ;
+#else
+
+    //--------------------------------------------------------------------------
+    // initializations
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix A = G->A ;
+    GrB_Matrix AT = G->AT ;
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+
+    // determine the integer type, operators, and semirings to use
+    GrB_Type Uint, Int ;
+    GrB_IndexUnaryOp ramp ;
+    GrB_Semiring min_2nd, min_1st, min_2ndi ;
+    GrB_BinaryOp min, eq, imin ;
+    #ifdef COVERAGE
+    // Just for test coverage, use 64-bit ints for n > 100.  Do not use this
+    // rule in production!
+    #define NBIG 100
+    #else
+    // For production use: 64-bit integers if n > 2^31
+    #define NBIG INT32_MAX
+    #endif
+    if (n > NBIG)
+    {
+        // use 64-bit integers throughout
+        Uint = GrB_UINT64 ;
+        Int  = GrB_INT64  ;
+        ramp = GrB_ROWINDEX_INT64 ;
+        min  = GrB_MIN_UINT64 ;
+        imin = GrB_MIN_INT64 ;
+        eq   = GrB_EQ_UINT64 ;
+        min_2nd  = GrB_MIN_SECOND_SEMIRING_UINT64 ;
+        min_1st  = GrB_MIN_FIRST_SEMIRING_UINT64 ;
+        min_2ndi = GxB_MIN_SECONDI_INT64 ;
+    }
+    else
+    {
+        // use 32-bit integers, except for Px and for constructing the matrix C
+        Uint = GrB_UINT32 ;
+        Int  = GrB_INT32  ;
+        ramp = GrB_ROWINDEX_INT32 ;
+        min  = GrB_MIN_UINT32 ;
+        imin = GrB_MIN_INT32 ;
+        eq   = GrB_EQ_UINT32 ;
+        min_2nd  = GrB_MIN_SECOND_SEMIRING_UINT32 ;
+        min_1st  = GrB_MIN_FIRST_SEMIRING_UINT32 ;
+        min_2ndi = GxB_MIN_SECONDI_INT32 ;
+    }
+
+    LG_TRY (LAGraph_Calloc ((void **) &Cx, 1, sizeof (bool), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Px, n, sizeof (GrB_Index), msg)) ;
+
+    // create Cp = 0:n (always 64-bit) and the empty C matrix
+    GRB_TRY (GrB_Matrix_new (&C, GrB_BOOL, n, n)) ;
+    GRB_TRY (GrB_Vector_new (&t, GrB_INT64, n+1)) ;
+    GRB_TRY (GrB_assign (t, NULL, NULL, 0, GrB_ALL, n+1, NULL)) ;
+    GRB_TRY (GrB_apply (t, NULL, NULL, GrB_ROWINDEX_INT64, t, 0, NULL)) ;
+    GRB_TRY (GxB_Vector_unpack_Full (t, (void **) &Cp, &Cp_size, NULL, NULL)) ;
+    GRB_TRY (GrB_free (&t)) ;
+
+    //--------------------------------------------------------------------------
+    // warmup: parent = min (0:n-1, A*1, 1'*A) using the MIN_SECONDI semiring
+    //--------------------------------------------------------------------------
+
+    // y (i) = min (i, j) for all entries A(i,j) and A(j,i).  The first term
+    // finds the smallest out-neighbor of each node, and the second finds
+    // the smallest in-neighbor (with SECONDI, the index k in t(k)*A(k,j) is
+    // the row index of A(k,j)).
+
+    GRB_TRY (GrB_Vector_new (&t, Int, n)) ;
+    GRB_TRY (GrB_Vector_new (&y, Int, n)) ;
+    GRB_TRY (GrB_assign (t, NULL, NULL, 0, GrB_ALL, n, NULL)) ;
+    GRB_TRY (GrB_assign (y, NULL, NULL, 0, GrB_ALL, n, NULL)) ;
+    GRB_TRY (GrB_apply (y, NULL, NULL, ramp, y, 0, NULL)) ;
+    GRB_TRY (GrB_mxv (y, NULL, imin, min_2ndi, A, t, NULL)) ;
+    if (AT != NULL)
+    {
+        GRB_TRY (GrB_mxv (y, NULL, imin, min_2ndi, AT, t, NULL)) ;
+    }
+    else
+    {
+        GRB_TRY (GrB_vxm (y, NULL, imin, min_2ndi, t, A, NULL)) ;
+    }
+    GRB_TRY (GrB_free (&t)) ;
+
+    // parent = (Uint) y
+    GRB_TRY (GrB_Vector_new (&parent, Uint, n)) ;
+    GRB_TRY (GrB_assign (parent, NULL, NULL, y, GrB_ALL, n, NULL)) ;
+    GRB_TRY (GrB_free (&y)) ;
+
+    // copy parent into gp, mngp, and Px
+    GRB_TRY (GrB_Vector_extractTuples (NULL, Px, &n, parent)) ;
+    GRB_TRY (GrB_Vector_dup (&gp, parent)) ;
+    GRB_TRY (GrB_Vector_dup (&mngp, parent)) ;
+    GRB_TRY (GrB_Vector_new (&gp_new, Uint, n)) ;
+    GRB_TRY (GrB_Vector_new (&t, GrB_BOOL, n)) ;
+
+    //--------------------------------------------------------------------------
+    // find the weakly connected components
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (fastsv_weak (A, AT, parent, mngp, &gp, &gp_new, t, eq, min,
+        min_2nd, min_1st, C, &Cp, &Px, &Cx, msg)) ;
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    (*component) = parent ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+#endif
+}
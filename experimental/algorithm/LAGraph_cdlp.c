@@ -115,6 +115,13 @@
 //   outgoing edge). In the absence of such a neighbor, it picks the minimal
 //   label of its neighbors (connected through either an incoming or through
 //   an outgoing edge).
+//
+// ## Statistics
+//
+// The sanitize and cdlp times are returned in t, and are also recorded as the
+// phases "sanitize" and "cdlp" of the current stats object, if any (see
+// LAGraph_Stats_SetCurrent), with the time and the # of edges examined by
+// each iteration.
 
 #define LG_FREE_ALL                                                     \
 {                                                                       \
@@ -136,7 +143,7 @@
 #include "LG_internal.h"
 
 //****************************************************************************
-int LAGraph_cdlp
+static int cdlp
 (
     GrB_Vector *CDLP_handle, // output vector
     const GrB_Matrix A,      // input matrix
@@ -168,6 +175,8 @@ int LAGraph_cdlp
     // Arrays holding extracted tuples during the algorithm
     GrB_Index *I = NULL;
     GrB_Index *X = NULL;
+    // Statistics of this run, if collected
+    LAGraph_Stats stats = LG_Stats_Get (NULL) ;
 
     //--------------------------------------------------------------------------
     // check inputs
@@ -214,6 +223,7 @@ int LAGraph_cdlp
         GRB_TRY (GrB_Matrix_build(S, AI, AJ, AX, nz, GrB_PLUS_UINT64));
 
         t [0] = LAGraph_WallClockTime ( ) - t [0] ;
+        LG_Stats_Phase (stats, "sanitize", t [0]) ;
     }
     else
     {
@@ -257,6 +267,7 @@ int LAGraph_cdlp
         GRB_TRY (GrB_transpose (AT, NULL, NULL, A, NULL)) ;
     }
 
+    double titer = LAGraph_WallClockTime ( ) ;
     for (int iteration = 0; iteration < itermax; iteration++)
     {
         // Initialize data structures for extraction from 'AL_in' and (for directed graphs) 'AL_out'
@@ -323,6 +334,10 @@ int LAGraph_cdlp
 
         bool isequal;
         LAGraph_Matrix_IsEqual (&isequal, L_prev, L, NULL);
+        double tnow = LAGraph_WallClockTime ( ) ;
+        LG_TRY (LG_Stats_Iteration (stats, tnow - titer, -1, (int64_t) nnz,
+            -1, -1, msg)) ;
+        titer = tnow ;
         if (isequal) {
             break;
         }
@@ -349,6 +364,27 @@ int LAGraph_cdlp
     LG_FREE_ALL;
 
     t [1] = LAGraph_WallClockTime ( ) - t [1] ;
+    LG_Stats_Phase (stats, "cdlp", t [1]) ;
 
     return (GrB_SUCCESS);
 }
+
+//****************************************************************************
+int LAGraph_cdlp
+(
+    GrB_Vector *CDLP_handle, // output vector
+    const GrB_Matrix A,      // input matrix
+    bool symmetric,          // denote whether the matrix is symmetric
+    bool sanitize,           // if true, ensure A is binary
+    int itermax,             // max number of iterations,
+    double *t,               // t [0] = sanitize time, t [1] = cdlp time,
+                             // in seconds
+    char *msg
+)
+{
+    LAGraph_Stats stats = LG_Stats_Get (NULL) ;
+    LG_Stats_Begin (stats, "LAGraph_cdlp") ;
+    int status = cdlp (CDLP_handle, A, symmetric, sanitize, itermax, t, msg) ;
+    LG_Stats_End (stats) ;
+    return (status) ;
+}
@@ -33,13 +33,392 @@
 
 // On output, Y is the computed result, of the same size as Y0.
 
+// Each layer computes Y = min (relu (Y*W [layer] + Bias [layer]), 32), where
+// the bias is added only to the entries in the pattern of Y*W [layer].  Each
+// row of Y depends only on the same row of Y0, so with SuiteSparse:GraphBLAS
+// and matrices of type GrB_FP32, the rows of Y0 are split into blocks that
+// are small enough to remain in cache, and each block is pushed through all
+// the layers before the next block is started.  The blocks are done in
+// parallel.  For each row, one fused kernel computes the row of Y*W with a
+// dense accumulator (Gustavson's method), and then adds the bias, and applies
+// the ReLU and the threshold as the row is written out, so Y is never
+// rematerialized between the steps of a layer.  A row that becomes empty stays
+// empty, so it is dropped from the block, and no further work is done for it.
+// The matrices W [layer] and Y0 are accessed in place, via GxB unpack/pack,
+// if they are already held in sparse CSR form, and are returned unchanged.
+// A hypersparse, bitmap, full, or by-column matrix is copied, and the copy
+// is unpacked instead, so that the format of the input is not changed.
+
+// Otherwise, each layer is computed with four GraphBLAS calls.
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+//------------------------------------------------------------------------------
+// dnn_generic: propagate the features with GraphBLAS, one layer at a time
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_ALL
 #define LG_FREE_ALL         \
 {                           \
     GrB_free (&Y) ;         \
 }
 
-#include "LG_internal.h"
-#include "LAGraphX.h"
+static GrB_Info dnn_generic
+(
+    GrB_Matrix *Yhandle,
+    GrB_Matrix *W,
+    GrB_Matrix *Bias,
+    int nlayers,
+    GrB_Matrix Y0,
+    char *msg
+)
+{
+    GrB_Matrix Y = NULL ;
+    GrB_Index nfeatures, nneurons ;
+    GRB_TRY (GrB_Matrix_nrows (&nfeatures, Y0)) ;
+    GRB_TRY (GrB_Matrix_ncols (&nneurons,  Y0)) ;
+    GRB_TRY (GrB_Matrix_new (&Y, GrB_FP32, nfeatures, nneurons)) ;
+
+    for (int layer = 0 ; layer < nlayers ; layer++)
+    {
+        // Y = Y * W [layer], using the conventional PLUS_TIMES semiring
+        GRB_TRY (GrB_mxm (Y, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP32,
+            ((layer == 0) ? Y0 : Y), W [layer], NULL)) ;
+
+        // Y = Y * Bias [layer], using the MIN_PLUS semiring.  This computes
+        // Y(i,j) += Bias [layer] (j,j) for each entry Y(i,j).  It does not
+        // introduce any new entries in Y.  The MIN monoid is not actually used
+        // since Bias [layer] is a diagonal matrix.  The prior version used
+        // a PLUS_PLUS semiring, which also works but is not a GrB built-in.
+        GRB_TRY (GrB_mxm (Y, NULL, NULL, GrB_MIN_PLUS_SEMIRING_FP32, Y,
+            Bias [layer], NULL)) ;
+
+        // delete entries from Y: keep only those entries greater than zero
+        GRB_TRY (GrB_select (Y, NULL, NULL, GrB_VALUEGT_FP32, Y, (float) 0,
+            NULL));
+
+        // threshold maximum values: Y = min (Y, 32)
+        GRB_TRY (GrB_apply (Y, NULL, NULL, GrB_MIN_FP32, Y, (float) 32, NULL)) ;
+    }
+
+    (*Yhandle) = Y ;
+    return (GrB_SUCCESS) ;
+}
+
+#if LAGRAPH_SUITESPARSE
+
+//------------------------------------------------------------------------------
+// dnn_csr: a matrix unpacked in CSR form
+//------------------------------------------------------------------------------
+
+typedef struct
+{
+    GrB_Matrix A ;              // the unpacked matrix, or NULL if packed
+    GrB_Matrix copy ;           // copy of the input, or NULL if unpacked in
+                                // place
+    GrB_Index *Ap, *Aj ;
+    float *Ax ;
+    GrB_Index Ap_size, Aj_size, Ax_size ;
+    bool iso, jumbled ;
+}
+dnn_csr ;
+
+static GrB_Info dnn_unpack (dnn_csr *C, GrB_Matrix A)
+{
+    // unpack A in place only if it is already sparse CSR, since unpacking
+    // and packing it would convert it to that format; otherwise unpack a copy
+    int sparsity ;
+    GxB_Format_Value fmt ;
+    GrB_Info info = GxB_get (A, GxB_SPARSITY_STATUS, &sparsity) ;
+    if (info == GrB_SUCCESS) info = GxB_get (A, GxB_FORMAT, &fmt) ;
+    if (info != GrB_SUCCESS) return (info) ;
+    if (sparsity != GxB_SPARSE || fmt != GxB_BY_ROW)
+    {
+        info = GrB_Matrix_dup (&(C->copy), A) ;
+        if (info != GrB_SUCCESS) return (info) ;
+        A = C->copy ;
+    }
+
+    // the matrix may be left jumbled, since the rows need not be sorted
+    info = GxB_Matrix_unpack_CSR (A, &(C->Ap), &(C->Aj),
+        (void **) &(C->Ax), &(C->Ap_size), &(C->Aj_size), &(C->Ax_size),
+        &(C->iso), &(C->jumbled), NULL) ;
+    if (info == GrB_SUCCESS)
+    {
+        C->A = A ;
+    }
+    else
+    {
+        GrB_free (&(C->copy)) ;
+    }
+    return (info) ;
+}
+
+static void dnn_repack (dnn_csr *C)
+{
+    // the matrix is returned in the same state as it was unpacked, so this
+    // cannot fail
+    if (C->A != NULL)
+    {
+        GxB_Matrix_pack_CSR (C->A, &(C->Ap), &(C->Aj), (void **) &(C->Ax),
+            C->Ap_size, C->Aj_size, C->Ax_size, C->iso, C->jumbled, NULL) ;
+        C->A = NULL ;
+    }
+    GrB_free (&(C->copy)) ;
+}
+
+//------------------------------------------------------------------------------
+// dnn_block: per-thread workspace for one block of rows of Y
+//------------------------------------------------------------------------------
+
+// The current rows of Y for the block are held in CSR form in (Tp, Tj, Tx)
+// [cur], for the nactive rows that are not yet empty, with their global row
+// indices in rows [0..nactive-1].  Each layer reads from one buffer and
+// writes to the other.
+
+typedef struct
+{
+    float *acc ;                // dense accumulator, size nneurons
+    int64_t *mark ;             // acc [j] is in use if mark [j] == stamp
+    int64_t stamp ;
+    GrB_Index *rows ;           // size bsize
+    GrB_Index *Tp [2] ;         // size bsize+1 each
+    GrB_Index *Tj [2] ;         // size cap [0] and cap [1]
+    float *Tx [2] ;
+    GrB_Index cap [2] ;
+}
+dnn_block ;
+
+static void dnn_block_free (dnn_block *B)
+{
+    LAGraph_Free ((void **) &(B->acc), NULL) ;
+    LAGraph_Free ((void **) &(B->mark), NULL) ;
+    LAGraph_Free ((void **) &(B->rows), NULL) ;
+    for (int t = 0 ; t < 2 ; t++)
+    {
+        LAGraph_Free ((void **) &(B->Tp [t]), NULL) ;
+        LAGraph_Free ((void **) &(B->Tj [t]), NULL) ;
+        LAGraph_Free ((void **) &(B->Tx [t]), NULL) ;
+    }
+}
+
+static int dnn_block_alloc (dnn_block *B, GrB_Index bsize, GrB_Index nneurons)
+{
+    memset (B, 0, sizeof (dnn_block)) ;
+    GrB_Index cap = LAGRAPH_MAX (bsize * 64, nneurons) ;
+    bool ok = true ;
+    ok = ok && LAGraph_Malloc ((void **) &(B->acc), nneurons, sizeof (float),
+        NULL) == GrB_SUCCESS ;
+    ok = ok && LAGraph_Malloc ((void **) &(B->mark), nneurons,
+        sizeof (int64_t), NULL) == GrB_SUCCESS ;
+    ok = ok && LAGraph_Malloc ((void **) &(B->rows), bsize, sizeof (GrB_Index),
+        NULL) == GrB_SUCCESS ;
+    for (int t = 0 ; t < 2 ; t++)
+    {
+        ok = ok && LAGraph_Malloc ((void **) &(B->Tp [t]), bsize+1,
+            sizeof (GrB_Index), NULL) == GrB_SUCCESS ;
+        ok = ok && LAGraph_Malloc ((void **) &(B->Tj [t]), cap,
+            sizeof (GrB_Index), NULL) == GrB_SUCCESS ;
+        ok = ok && LAGraph_Malloc ((void **) &(B->Tx [t]), cap,
+            sizeof (float), NULL) == GrB_SUCCESS ;
+        B->cap [t] = cap ;
+    }
+    if (!ok)
+    {
+        dnn_block_free (B) ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    for (int64_t j = 0 ; j < nneurons ; j++)
+    {
+        B->mark [j] = -1 ;
+    }
+    B->stamp = 0 ;
+    return (GrB_SUCCESS) ;
+}
+
+// ensure buffer t can hold at least need entries
+static int dnn_block_grow (dnn_block *B, int t, GrB_Index need)
+{
+    if (need <= B->cap [t]) return (GrB_SUCCESS) ;
+    GrB_Index cap = LAGRAPH_MAX (2 * B->cap [t], need) ;
+    int info = LAGraph_Realloc ((void **) &(B->Tj [t]), cap, B->cap [t],
+        sizeof (GrB_Index), NULL) ;
+    if (info != GrB_SUCCESS) return (info) ;
+    info = LAGraph_Realloc ((void **) &(B->Tx [t]), cap, B->cap [t],
+        sizeof (float), NULL) ;
+    if (info != GrB_SUCCESS) return (info) ;
+    B->cap [t] = cap ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// dnn_fused: push one block of rows of Y0 through all the layers
+//------------------------------------------------------------------------------
+
+// On output, (Tp, Tj, Tx) [*cur] holds the nonempty rows of the block, and
+// rows [0..*nactive-1] are their global row indices.
+
+static int dnn_fused
+(
+    dnn_block *B,
+    int *cur,
+    GrB_Index *nactive_handle,
+    const dnn_csr *Y0,
+    const dnn_csr *L,           // unpacked layers
+    const int *map,             // W [layer] is L [map [layer]]
+    const float *bias,          // bias [layer*nneurons + j] = Bias [layer](j,j)
+    int nlayers,
+    GrB_Index nneurons,
+    GrB_Index ifirst,
+    GrB_Index ilast             // the block is Y0 (ifirst:ilast-1,:)
+)
+{
+
+    //--------------------------------------------------------------------------
+    // load the nonempty rows of Y0 into buffer 0
+    //--------------------------------------------------------------------------
+
+    int c = 0 ;
+    GrB_Index nactive = 0, q = 0 ;
+    int info = dnn_block_grow (B, 0, Y0->Ap [ilast] - Y0->Ap [ifirst]) ;
+    if (info != GrB_SUCCESS) return (info) ;
+    B->Tp [0][0] = 0 ;
+    for (GrB_Index i = ifirst ; i < ilast ; i++)
+    {
+        if (Y0->Ap [i+1] == Y0->Ap [i]) continue ;
+        for (GrB_Index p = Y0->Ap [i] ; p < Y0->Ap [i+1] ; p++)
+        {
+            B->Tj [0][q] = Y0->Aj [p] ;
+            B->Tx [0][q] = Y0->Ax [Y0->iso ? 0 : p] ;
+            q++ ;
+        }
+        B->rows [nactive++] = i ;
+        B->Tp [0][nactive] = q ;
+    }
+
+    //--------------------------------------------------------------------------
+    // propagate the rows through the layers
+    //--------------------------------------------------------------------------
+
+    for (int layer = 0 ; layer < nlayers && nactive > 0 ; layer++)
+    {
+        const dnn_csr *W = &(L [map [layer]]) ;
+        const float *b = bias + ((int64_t) layer) * nneurons ;
+        const GrB_Index *restrict Tp = B->Tp [c] ;
+        const GrB_Index *restrict Tj = B->Tj [c] ;
+        const float *restrict Tx = B->Tx [c] ;
+        const int o = 1 - c ;
+        GrB_Index nactive_new = 0 ;
+        q = 0 ;
+        B->Tp [o][0] = 0 ;
+
+        for (GrB_Index a = 0 ; a < nactive ; a++)
+        {
+            // the row can have at most nneurons entries
+            info = dnn_block_grow (B, o, q + nneurons) ;
+            if (info != GrB_SUCCESS) return (info) ;
+            GrB_Index *restrict Oj = B->Tj [o] ;
+            float *restrict Ox = B->Tx [o] ;
+            float *restrict acc = B->acc ;
+            int64_t *restrict mark = B->mark ;
+            int64_t stamp = ++(B->stamp) ;
+
+            // acc = Y(i,:) * W, with its pattern appended to Oj [q...]
+            GrB_Index cnt = 0 ;
+            for (GrB_Index t = Tp [a] ; t < Tp [a+1] ; t++)
+            {
+                GrB_Index k = Tj [t] ;
+                float y = Tx [t] ;
+                for (GrB_Index p = W->Ap [k] ; p < W->Ap [k+1] ; p++)
+                {
+                    GrB_Index j = W->Aj [p] ;
+                    float yw = y * W->Ax [W->iso ? 0 : p] ;
+                    if (mark [j] != stamp)
+                    {
+                        mark [j] = stamp ;
+                        acc [j] = yw ;
+                        Oj [q + cnt++] = j ;
+                    }
+                    else
+                    {
+                        acc [j] += yw ;
+                    }
+                }
+            }
+
+            // Y(i,:) = min (relu (acc + bias), 32), in place
+            GrB_Index r = q ;
+            for (GrB_Index t = q ; t < q + cnt ; t++)
+            {
+                GrB_Index j = Oj [t] ;
+                float v = acc [j] + b [j] ;
+                if (v > 0)
+                {
+                    Oj [r] = j ;
+                    Ox [r] = (v < 32) ? v : 32 ;
+                    r++ ;
+                }
+            }
+
+            // drop the row if it is now empty
+            if (r > q)
+            {
+                B->rows [nactive_new++] = B->rows [a] ;
+                B->Tp [o][nactive_new] = r ;
+                q = r ;
+            }
+        }
+
+        nactive = nactive_new ;
+        c = o ;
+    }
+
+    (*cur) = c ;
+    (*nactive_handle) = nactive ;
+    return (GrB_SUCCESS) ;
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+// LAGraph_dnn
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_WORK
+#define LG_FREE_WORK                                            \
+{                                                               \
+    if (L != NULL)                                              \
+    {                                                           \
+        for (int k = 0 ; k <= nlayers ; k++) dnn_repack (&(L [k])) ; \
+    }                                                           \
+    if (Bj != NULL)                                             \
+    {                                                           \
+        for (int64_t b = 0 ; b < nblocks ; b++)                 \
+        {                                                       \
+            LAGraph_Free ((void **) &(Bj [b]), NULL) ;          \
+            LAGraph_Free ((void **) &(Bx [b]), NULL) ;          \
+        }                                                       \
+    }                                                           \
+    LAGraph_Free ((void **) &L, NULL) ;                         \
+    LAGraph_Free ((void **) &map, NULL) ;                       \
+    LAGraph_Free ((void **) &bias, NULL) ;                      \
+    LAGraph_Free ((void **) &Bi, NULL) ;                        \
+    LAGraph_Free ((void **) &Bc, NULL) ;                        \
+    LAGraph_Free ((void **) &Bv, NULL) ;                        \
+    LAGraph_Free ((void **) &Bj, NULL) ;                        \
+    LAGraph_Free ((void **) &Bx, NULL) ;                        \
+    LAGraph_Free ((void **) &Yp, NULL) ;                        \
+    LAGraph_Free ((void **) &Yj, NULL) ;                        \
+    LAGraph_Free ((void **) &Yx, NULL) ;                        \
+}
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL                                             \
+{                                                               \
+    LG_FREE_WORK ;                                              \
+    GrB_free (&Y) ;                                             \
+}
 
 //****************************************************************************
 GrB_Info LAGraph_dnn    // returns GrB_SUCCESS if successful
@@ -65,47 +444,236 @@ GrB_Info LAGraph_dnn    // returns GrB_SUCCESS if successful
         return (GrB_NULL_POINTER) ;
     }
 
-    //--------------------------------------------------------------------------
-    // create the output matrix Y
-    //--------------------------------------------------------------------------
+    #if !LAGRAPH_SUITESPARSE
+    return (dnn_generic (Yhandle, W, Bias, nlayers, Y0, msg)) ;
+    #else
 
     GrB_Matrix Y = NULL ;
+    dnn_csr *L = NULL ;
+    int *map = NULL ;
+    float *bias = NULL ;
+    GrB_Index *Bi = NULL, *Bc = NULL, **Bj = NULL, *Yp = NULL, *Yj = NULL ;
+    float *Bv = NULL, **Bx = NULL, *Yx = NULL ;
+    int64_t nblocks = 0 ;
     (*Yhandle) = NULL ;
+
+    //--------------------------------------------------------------------------
+    // use the fused method only if all matrices are GrB_FP32
+    //--------------------------------------------------------------------------
+
     GrB_Index nfeatures, nneurons ;
     GRB_TRY (GrB_Matrix_nrows (&nfeatures, Y0)) ;
     GRB_TRY (GrB_Matrix_ncols (&nneurons,  Y0)) ;
-    GRB_TRY (GrB_Matrix_new (&Y, GrB_FP32, nfeatures, nneurons)) ;
+
+    char type_name [LAGRAPH_MAX_NAME_LEN] ;
+    LG_TRY (LAGraph_Matrix_TypeName (type_name, Y0, msg)) ;
+    bool fused = (nlayers > 0 && MATCHNAME (type_name, "float")) ;
+    for (int layer = 0 ; fused && layer < nlayers ; layer++)
+    {
+        LG_TRY (LAGraph_Matrix_TypeName (type_name, W [layer], msg)) ;
+        fused = MATCHNAME (type_name, "float") && (W [layer] != Y0) ;
+        LG_TRY (LAGraph_Matrix_TypeName (type_name, Bias [layer], msg)) ;
+        fused = fused && MATCHNAME (type_name, "float") ;
+    }
+
+    //--------------------------------------------------------------------------
+    // get the diagonal of each Bias [layer]
+    //--------------------------------------------------------------------------
+
+    if (fused)
+    {
+        // a missing diagonal entry of Bias [layer] would delete entries from
+        // Y, so those matrices are left to the generic method
+        LG_TRY (LAGraph_Malloc ((void **) &bias, ((size_t) nlayers) * nneurons,
+            sizeof (float), msg)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &Bi, nneurons, sizeof (GrB_Index),
+            msg)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &Bc, nneurons, sizeof (GrB_Index),
+            msg)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &Bv, nneurons, sizeof (float),
+            msg)) ;
+        for (int layer = 0 ; fused && layer < nlayers ; layer++)
+        {
+            GrB_Index nvals ;
+            GRB_TRY (GrB_Matrix_nvals (&nvals, Bias [layer])) ;
+            fused = (nvals == nneurons) ;
+            if (!fused) break ;
+            GRB_TRY (GrB_Matrix_extractTuples_FP32 (Bi, Bc, Bv, &nvals,
+                Bias [layer])) ;
+            // with nneurons entries, all on the diagonal, every diagonal
+            // entry is present
+            float *b = bias + ((int64_t) layer) * nneurons ;
+            for (int64_t k = 0 ; fused && k < nneurons ; k++)
+            {
+                fused = (Bi [k] == Bc [k]) ;
+                b [Bi [k]] = Bv [k] ;
+            }
+        }
+        LAGraph_Free ((void **) &Bi, NULL) ;
+        LAGraph_Free ((void **) &Bc, NULL) ;
+        LAGraph_Free ((void **) &Bv, NULL) ;
+    }
+
+    if (!fused)
+    {
+        LG_FREE_WORK ;
+        return (dnn_generic (Yhandle, W, Bias, nlayers, Y0, msg)) ;
+    }
 
     //--------------------------------------------------------------------------
-    // propagate the features through the neuron layers
+    // unpack Y0 and each distinct W [layer] in CSR form
     //--------------------------------------------------------------------------
 
+    // L [nlayers] is Y0.  A matrix may appear more than once in W, but it is
+    // unpacked only once.
+    LG_TRY (LAGraph_Calloc ((void **) &L, nlayers+1, sizeof (dnn_csr), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &map, nlayers, sizeof (int), msg)) ;
     for (int layer = 0 ; layer < nlayers ; layer++)
     {
-        // Y = Y * W [layer], using the conventional PLUS_TIMES semiring
-        GRB_TRY (GrB_mxm (Y, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP32,
-            ((layer == 0) ? Y0 : Y), W [layer], NULL)) ;
+        map [layer] = layer ;
+        for (int prior = 0 ; prior < layer ; prior++)
+        {
+            if (W [prior] == W [layer])
+            {
+                map [layer] = map [prior] ;
+                break ;
+            }
+        }
+        if (map [layer] == layer)
+        {
+            GRB_TRY (dnn_unpack (&(L [layer]), W [layer])) ;
+        }
+    }
+    GRB_TRY (dnn_unpack (&(L [nlayers]), Y0)) ;
+    const dnn_csr *Y0csr = &(L [nlayers]) ;
 
-        // Y = Y * Bias [layer], using the MIN_PLUS semiring.  This computes
-        // Y(i,j) += Bias [layer] (j,j) for each entry Y(i,j).  It does not
-        // introduce any new entries in Y.  The MIN monoid is not actually used
-        // since Bias [layer] is a diagonal matrix.  The prior version used
-        // a PLUS_PLUS semiring, which also works but is not a GrB built-in.
-        GRB_TRY (GrB_mxm (Y, NULL, NULL, GrB_MIN_PLUS_SEMIRING_FP32, Y,
-            Bias [layer], NULL)) ;
+    //--------------------------------------------------------------------------
+    // determine the blocks of rows
+    //--------------------------------------------------------------------------
 
-        // delete entries from Y: keep only those entries greater than zero
-        GRB_TRY (GrB_select (Y, NULL, NULL, GrB_VALUEGT_FP32, Y, (float) 0,
-            NULL));
+    int nthreads_outer, nthreads_inner ;
+    LG_TRY (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+    int nthreads = nthreads_outer * nthreads_inner ;
 
-        // threshold maximum values: Y = min (Y, 32)
-        GRB_TRY (GrB_apply (Y, NULL, NULL, GrB_MIN_FP32, Y, (float) 32, NULL)) ;
+    // each block of Y should fit in about 256KB of cache (12 bytes per entry),
+    // and there should be enough blocks to balance the work
+    GrB_Index nvals0 = Y0csr->Ap [nfeatures] ;
+    double rownz = LAGRAPH_MAX ((double) nvals0 / LAGRAPH_MAX (nfeatures, 1),
+        1) ;
+    GrB_Index bsize = (GrB_Index) ((256 * 1024) / (12 * rownz)) ;
+    bsize = LAGRAPH_MIN (bsize, 4096) ;
+    bsize = LAGRAPH_MIN (bsize, (nfeatures + 4*nthreads - 1) / (4*nthreads)) ;
+    bsize = LAGRAPH_MAX (bsize, 1) ;
+    nblocks = (nfeatures + bsize - 1) / bsize ;
+
+    LG_TRY (LAGraph_Calloc ((void **) &Bj, nblocks, sizeof (GrB_Index *),
+        msg)) ;
+    LG_TRY (LAGraph_Calloc ((void **) &Bx, nblocks, sizeof (float *), msg)) ;
+    LG_TRY (LAGraph_Calloc ((void **) &Yp, nfeatures+1, sizeof (GrB_Index),
+        msg)) ;
+
+    //--------------------------------------------------------------------------
+    // push each block through all the layers
+    //--------------------------------------------------------------------------
+
+    int result = GrB_SUCCESS ;
+    #pragma omp parallel num_threads(nthreads)
+    {
+        dnn_block B ;
+        int my_result = dnn_block_alloc (&B, bsize, nneurons) ;
+        int64_t b ;
+        #pragma omp for schedule(dynamic,1)
+        for (b = 0 ; b < nblocks ; b++)
+        {
+            if (my_result != GrB_SUCCESS) continue ;
+            GrB_Index ifirst = b * bsize ;
+            GrB_Index ilast = LAGRAPH_MIN (ifirst + bsize, nfeatures) ;
+            int c ;
+            GrB_Index nactive ;
+            my_result = dnn_fused (&B, &c, &nactive, Y0csr, L, map, bias,
+                nlayers, nneurons, ifirst, ilast) ;
+            if (my_result != GrB_SUCCESS) continue ;
+
+            // save the rows of the block, and their counts in Yp
+            GrB_Index bnz = B.Tp [c][nactive] ;
+            if (bnz == 0) continue ;
+            bool ok = LAGraph_Malloc ((void **) &(Bj [b]), bnz,
+                sizeof (GrB_Index), NULL) == GrB_SUCCESS ;
+            ok = ok && LAGraph_Malloc ((void **) &(Bx [b]), bnz,
+                sizeof (float), NULL) == GrB_SUCCESS ;
+            if (!ok)
+            {
+                my_result = GrB_OUT_OF_MEMORY ;
+                continue ;
+            }
+            memcpy (Bj [b], B.Tj [c], bnz * sizeof (GrB_Index)) ;
+            memcpy (Bx [b], B.Tx [c], bnz * sizeof (float)) ;
+            for (GrB_Index a = 0 ; a < nactive ; a++)
+            {
+                Yp [B.rows [a] + 1] = B.Tp [c][a+1] - B.Tp [c][a] ;
+            }
+        }
+        dnn_block_free (&B) ;
+        if (my_result != GrB_SUCCESS)
+        {
+            #pragma omp critical (LG_dnn)
+            {
+                result = my_result ;
+            }
+        }
+    }
+    LG_TRY (result) ;
+
+    //--------------------------------------------------------------------------
+    // return Y0 and W to the caller
+    //--------------------------------------------------------------------------
+
+    for (int k = 0 ; k <= nlayers ; k++)
+    {
+        dnn_repack (&(L [k])) ;
     }
 
+    //--------------------------------------------------------------------------
+    // assemble the blocks into Y
+    //--------------------------------------------------------------------------
+
+    for (int64_t i = 0 ; i < nfeatures ; i++)
+    {
+        Yp [i+1] += Yp [i] ;
+    }
+    GrB_Index ynz = Yp [nfeatures] ;
+    LG_TRY (LAGraph_Malloc ((void **) &Yj, LAGRAPH_MAX (ynz, 1),
+        sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Yx, LAGRAPH_MAX (ynz, 1),
+        sizeof (float), msg)) ;
+
+    int64_t b ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (b = 0 ; b < nblocks ; b++)
+    {
+        // the rows of each block are contiguous in Y
+        GrB_Index ifirst = b * bsize ;
+        GrB_Index ilast = LAGRAPH_MIN (ifirst + bsize, nfeatures) ;
+        GrB_Index pstart = Yp [ifirst] ;
+        GrB_Index bnz = Yp [ilast] - pstart ;
+        if (bnz == 0) continue ;
+        memcpy (Yj + pstart, Bj [b], bnz * sizeof (GrB_Index)) ;
+        memcpy (Yx + pstart, Bx [b], bnz * sizeof (float)) ;
+    }
+
+    // the rows of Y are jumbled
+    GRB_TRY (GrB_Matrix_new (&Y, GrB_FP32, nfeatures, nneurons)) ;
+    GRB_TRY (GxB_Matrix_pack_CSR (Y, &Yp, &Yj, (void **) &Yx,
+        (nfeatures+1) * sizeof (GrB_Index),
+        LAGRAPH_MAX (ynz, 1) * sizeof (GrB_Index),
+        LAGRAPH_MAX (ynz, 1) * sizeof (float), false, true, NULL)) ;
+
     //--------------------------------------------------------------------------
     // return result
     //--------------------------------------------------------------------------
 
+    LG_FREE_WORK ;
     (*Yhandle) = Y ;
     return (GrB_SUCCESS) ;
+    #endif
 }
@@ -58,6 +58,14 @@
 // not equal to 1 (even zero-weight edges are not allowed), or if it has self
 // edges.
 
+// The sanitize and lcc times are returned in t, and are also recorded as the
+// phases "sanitize" and "lcc" of the current stats object, if any (see
+// LAGraph_Stats_SetCurrent).
+
+// LAGraph_LocalClusteringCoefficient computes the same metric for an
+// LAGraph_Graph, without a sanitized copy of A, and can reuse G->out_degree
+// and a precomputed per-node triangle count.
+
 #define LG_FREE_ALL                 \
 {                                   \
     GrB_free (&C) ;                 \
@@ -66,8 +74,6 @@
     GrB_free (&U) ;                 \
     GrB_free (&W) ;                 \
     GrB_free (&LCC) ;               \
-    GrB_free (&LAGraph_COMB_DIR_FP64) ;                 \
-    GrB_free (&LAGraph_COMB_UNDIR_FP64) ;                 \
 }
 
 #include "LG_internal.h"
@@ -75,38 +81,10 @@
 #include <LAGraphX.h>
 
 //------------------------------------------------------------------------------
-
-#define F_UNARY(f)  ((void (*)(void *, const void *)) f)
-
-// z = x * (x - 1), used by LAGraph_lcc.
-// This operator calculates the 2-permutation of d(v).
-void LAGraph_comb_dir_fp64
-(
-    void *z,
-    const void *x
-)
-{
-    double xd = *(double *) x ;
-    double *zd = (double *) z ;
-    (*zd) = ((xd) * (xd - 1)) ;
-}
-
-// z = x * (x - 1) / 2, used by LAGraph_lcc.
-// This operator calculates the 2-combination of d(v).
-void LAGraph_comb_undir_fp64
-(
-    void *z,
-    const void *x
-)
-{
-    double xd = *(double *) x ;
-    double *zd = (double *) z ;
-    (*zd) = ((xd) * (xd - 1)) / 2;
-}
-
+// lcc: compute the lcc
 //------------------------------------------------------------------------------
 
-int LAGraph_lcc            // compute lcc for all nodes in A
+static int lcc
 (
     GrB_Vector *LCC_handle,     // output vector
     const GrB_Matrix A,         // input matrix
@@ -133,8 +111,6 @@ int LAGraph_lcc            // compute lcc for all nodes in A
 
     GrB_Matrix C = NULL, CL = NULL, S = NULL, U = NULL ;
     GrB_Vector W = NULL, LCC = NULL ;
-    GrB_UnaryOp LAGraph_COMB_DIR_FP64 = NULL ;
-    GrB_UnaryOp LAGraph_COMB_UNDIR_FP64 = NULL ;
     GrB_Info info ;
 
     // n = size of A (# of nodes in the graph)
@@ -168,6 +144,7 @@ int LAGraph_lcc            // compute lcc for all nodes in A
         // remove all self edges
         GrB_select (S, NULL, NULL, GrB_OFFDIAG, S, 0, NULL) ;
         t [0] = LAGraph_WallClockTime ( ) - t [0] ;
+        LG_Stats_Phase (LG_Stats_Get (NULL), "sanitize", t [0]) ;
     }
     else
     {
@@ -178,18 +155,6 @@ int LAGraph_lcc            // compute lcc for all nodes in A
 
     t [1] = LAGraph_WallClockTime ( ) ;
 
-    //--------------------------------------------------------------------------
-    // create the operators for LAGraph_lcc
-    //--------------------------------------------------------------------------
-
-    GRB_TRY (GrB_UnaryOp_new (&LAGraph_COMB_DIR_FP64,
-                                 F_UNARY (LAGraph_comb_dir_fp64),
-                                 GrB_FP64, GrB_FP64)) ;
-
-    GRB_TRY (GrB_UnaryOp_new (&LAGraph_COMB_UNDIR_FP64,
-                                 F_UNARY (LAGraph_comb_undir_fp64),
-                                 GrB_FP64, GrB_FP64)) ;
-
     GRB_TRY (GrB_Matrix_new (&C, GrB_FP64, n, n)) ;
     GRB_TRY (GrB_Matrix_new (&U, GrB_UINT32, n, n)) ;
 
@@ -246,16 +211,15 @@ int LAGraph_lcc            // compute lcc for all nodes in A
     GRB_TRY (GrB_Vector_new (&W, GrB_FP64, n)) ;
     GRB_TRY (GrB_reduce (W, NULL, NULL, GrB_PLUS_FP64, C, NULL)) ;
 
-    // Compute vector W defining the number of wedges per vertex
+    // Compute vector W defining the number of wedges per vertex:
+    // W = W .* (W-1), the 2-permutation of d(v)
+    GRB_TRY (GrB_apply (W, NULL, GrB_TIMES_FP64, GrB_MINUS_FP64, W, (double) 1,
+        NULL)) ;
     if (symmetric)
     {
-        // the graph is undirected
-        GRB_TRY (GrB_apply(W, NULL, NULL, LAGraph_COMB_UNDIR_FP64, W, NULL));
-    }
-    else
-    {
-        // the graph is directed
-        GRB_TRY (GrB_apply(W, NULL, NULL, LAGraph_COMB_DIR_FP64, W, NULL)) ;
+        // the graph is undirected: W = W/2, the 2-combination of d(v)
+        GRB_TRY (GrB_apply (W, NULL, NULL, GrB_DIV_FP64, W, (double) 2,
+            NULL)) ;
     }
 
     //--------------------------------------------------------------------------
@@ -288,6 +252,29 @@ int LAGraph_lcc            // compute lcc for all nodes in A
 
     LG_FREE_ALL ;
     t [1] = LAGraph_WallClockTime ( ) - t [1] ;
+    LG_Stats_Phase (LG_Stats_Get (NULL), "lcc", t [1]) ;
     return (GrB_SUCCESS) ;
 #endif
 }
+
+//------------------------------------------------------------------------------
+// LAGraph_lcc: compute the lcc, and record its statistics
+//------------------------------------------------------------------------------
+
+int LAGraph_lcc            // compute lcc for all nodes in A
+(
+    GrB_Vector *LCC_handle,     // output vector
+    const GrB_Matrix A,         // input matrix
+    bool symmetric,             // if true, the matrix is symmetric
+    bool sanitize,              // if true, ensure A is binary
+    double t [2],               // t [0] = sanitize time, t [1] = lcc time,
+                                // in seconds
+    char *msg
+)
+{
+    LAGraph_Stats S = LG_Stats_Get (NULL) ;
+    LG_Stats_Begin (S, "LAGraph_lcc") ;
+    int status = lcc (LCC_handle, A, symmetric, sanitize, t, msg) ;
+    LG_Stats_End (S) ;
+    return (status) ;
+}
@@ -15,199 +15,354 @@
  * Code is based on Boruvka's minimum spanning forest algorithm
  */
 
-#define LG_FREE_ALL                                  \
-{                                                    \
-    GrB_free (&S);                                   \
-    GrB_free (&T);                                   \
-    free(I); free(V);                                \
-    free(SI); free(SJ); free(SX);                    \
-    free(parent); free(partner); free(weight);       \
-    GrB_free (&f);                      \
-    GrB_free (&i);                      \
-    GrB_free (&t);                      \
-    GrB_free (&edge);                   \
-    GrB_free (&cedge);                  \
-    GrB_free (&mask);                   \
-    GrB_free (&index);                  \
-    GrB_free (&comb);                   \
-    GrB_free (&combMin);                \
-    GrB_free (&fst);                    \
-    GrB_free (&snd);                    \
-    GrB_free (&s1);                     \
-    GrB_free (&s2);                     \
-}
+// Each edge is represented as a (weight, index) pair of a user-defined type,
+// msf_tuple, and the minimum edge of each vertex is found with a semiring
+// whose monoid selects the lexicographically smallest pair.  Both parts of the
+// pair are 64 bits wide, so any vertex index can be held.
+
+// The edge weights of A may be of any built-in type.  Each weight is encoded
+// as a uint64_t key whose unsigned ordering is the same as the ordering of the
+// weights:  floating-point weights are mapped with the usual sign-flipping
+// transformation, signed integers have their sign bit flipped, and unsigned
+// integers (and bool) are used as-is.  The result has the type FP32 or FP64
+// if A has that type, GrB_INT64 if A has a signed integer type, and
+// GrB_UINT64 otherwise.  The largest key (a NaN, or a weight equal to
+// INT64_MAX or UINT64_MAX) is reserved to denote "no edge".
+
+// Reduce_assign (w [Px [i]] = min (w [Px [i]], s [i])) is done as w = min (w,
+// C*s), where C(i,j) is present if i = Px [j], exactly as in LG_CC_FastSV6.
+// The matrix C is constructed in O(1) time with GxB pack/unpack, from
+// workspace that is allocated once and reused in each Boruvka round.
+
+// The Filter-Kruskal method (Osipov, Sanders, and Singler, 2009) is also
+// available.  The edges of tril (S,-1) are extracted as (key, i, j) triplets,
+// with i > j so that the forest is lower triangular, and they are
+// partitioned around the median of a sample of the keys.  The forest of the
+// light edges is found first (recursively, or with Kruskal's method and the
+// parallel LG_msort3 once the problem is small), and then heavy edges whose
+// endpoints are already connected are filtered out before the heavy edges are
+// considered.  Ties are broken by (i,j), so the result is deterministic.  The
+// partition and the filter are sequential; the sorts are parallel.
+
+#define LG_FREE_ALL ;
 
 #include "LG_internal.h"
 #include <LAGraph.h>
 #include <LAGraphX.h>
 
+#if LAGRAPH_SUITESPARSE
+
 //****************************************************************************
-// encode each edge into a single uint64_t
+// msf_tuple: an edge, as a pair of a weight key and a vertex index
+typedef struct
+{
+    uint64_t wt ;       // the key of the edge weight
+    uint64_t idx ;      // a vertex index
+}
+msf_tuple ;
+
+#define MSF_SIGN64 (((uint64_t) 1) << 63)
+#define MSF_SIGN32 (((uint32_t) 1) << 31)
+
+// combine a weight key and an index into an edge
 static void combine (void *z, const void *x, const void *y)
 {
-    *(uint64_t*)z = ((*(uint64_t*)x) << 32) + (*(uint64_t*)y);
+    msf_tuple e ;
+    e.wt  = (*(const uint64_t *) x) ;
+    e.idx = (*(const uint64_t *) y) ;
+    (*(msf_tuple *) z) = e ;
+}
+
+// z = min (x,y), comparing the weight first and then the index
+static void tuple_min (void *z, const void *x, const void *y)
+{
+    const msf_tuple *a = (const msf_tuple *) x ;
+    const msf_tuple *b = (const msf_tuple *) y ;
+    bool a_lt_b = (a->wt < b->wt) || (a->wt == b->wt && a->idx <= b->idx) ;
+    (*(msf_tuple *) z) = a_lt_b ? (*a) : (*b) ;
+}
+
+// z = y, where x is the (ignored) boolean entry of C
+static void tuple_second (void *z, const void *x, const void *y)
+{
+    (*(msf_tuple *) z) = (*(const msf_tuple *) y) ;
+}
+
+// z = (x == y)
+static void tuple_eq (void *z, const void *x, const void *y)
+{
+    const msf_tuple *a = (const msf_tuple *) x ;
+    const msf_tuple *b = (const msf_tuple *) y ;
+    (*(bool *) z) = (a->wt == b->wt) && (a->idx == b->idx) ;
 }
 
 static void get_fst (void *y, const void *x)
 {
-    *(uint64_t*)y = (*(uint64_t*)x) >> 32;
+    (*(uint64_t *) y) = ((const msf_tuple *) x)->wt ;
 }
 
 static void get_snd (void *y, const void *x)
 {
-    *(uint64_t*)y = (*(uint64_t*)x) & INT_MAX;
+    (*(uint64_t *) y) = ((const msf_tuple *) x)->idx ;
 }
 
 //****************************************************************************
-// w[index[i]] = min(w[index[i]], s[i]) for i in [0..n-1]
-static GrB_Info Reduce_assign (GrB_Vector w,
-        GrB_Vector s, GrB_Index *index, GrB_Index n)
+// order-preserving weight keys, and their inverses
+
+static void key_fp64 (void *z, const void *x)
 {
-    GrB_Index *mem = (GrB_Index*) malloc(sizeof(GrB_Index) * n * 3);
-    GrB_Index *ind = mem, *sval = mem + n, *wval = sval + n;
-    GrB_Vector_extractTuples(ind, wval, &n, w);
-    GrB_Vector_extractTuples(ind, sval, &n, s);
-    for (GrB_Index i = 0; i < n; i++)
-        if (sval[i] < wval[index[i]])
-            wval[index[i]] = sval[i];
-    GrB_Vector_clear(w);
-    GrB_Vector_build(w, ind, wval, n, GrB_PLUS_UINT64);
-    free(mem);
-    return GrB_SUCCESS;
+    uint64_t k ;
+    memcpy (&k, x, sizeof (double)) ;
+    (*(uint64_t *) z) = (k & MSF_SIGN64) ? (~k) : (k | MSF_SIGN64) ;
+}
+
+static void key_fp32 (void *z, const void *x)
+{
+    uint32_t k ;
+    memcpy (&k, x, sizeof (float)) ;
+    (*(uint64_t *) z) = (k & MSF_SIGN32) ? (~k) : (k | MSF_SIGN32) ;
+}
+
+static void key_int64 (void *z, const void *x)
+{
+    (*(uint64_t *) z) = ((uint64_t) (*(const int64_t *) x)) ^ MSF_SIGN64 ;
+}
+
+static inline double unkey_fp64 (uint64_t k)
+{
+    k = (k & MSF_SIGN64) ? (k & ~MSF_SIGN64) : (~k) ;
+    double x ;
+    memcpy (&x, &k, sizeof (double)) ;
+    return (x) ;
+}
+
+static inline float unkey_fp32 (uint64_t key)
+{
+    uint32_t k = (uint32_t) key ;
+    k = (k & MSF_SIGN32) ? (k & ~MSF_SIGN32) : (~k) ;
+    float x ;
+    memcpy (&x, &k, sizeof (float)) ;
+    return (x) ;
 }
 
 //****************************************************************************
-// global C arrays (for implementing various GxB_SelectOp)
-static GrB_Index *weight = NULL, *parent = NULL, *partner = NULL;
+// select operators, with their state passed in the thunk
+
+typedef struct
+{
+    const GrB_Index *weight ;   // weight [i]: key of the edge i selected
+    const GrB_Index *parent ;   // parent [i]: the component of vertex i
+    const GrB_Index *partner ;  // partner [i]: component i connects to
+}
+msf_thunk ;
 
 // generate solution:
 // for each element A(i, j), it is selected if
 //   1. weight[i] == A(i, j)    -- where weight[i] stores i's minimum edge weight
 //   2. parent[j] == partner[i] -- j belongs to the specified connected component
-bool f1 (
-    GrB_Index i, GrB_Index j,
-    const void *x, const void *thunk)
+static void f1 (void *z, const void *x,
+    const GrB_Index i, const GrB_Index j, const void *y)
 {
-    uint64_t *aij = (uint64_t*) x;
-    return (weight[i] == *aij) && (parent[j] == partner[i]);
+    const msf_thunk *T = (*(const msf_thunk **) y) ;
+    uint64_t aij = (*(const uint64_t *) x) ;
+    (*(bool *) z) = (T->weight [i] == aij) && (T->parent [j] == T->partner [i]);
 }
 
 // edge removal:
 // A(i, j) is removed when parent[i] == parent[j]
-bool f2 (
-    GrB_Index i, GrB_Index j,
-    const void *x, const void *thunk)
+static void f2 (void *z, const void *x,
+    const GrB_Index i, const GrB_Index j, const void *y)
 {
-    uint64_t *aij = (uint64_t*) x;
-    return (parent[i] != parent[j]);
+    const msf_thunk *T = (*(const msf_thunk **) y) ;
+    (*(bool *) z) = (T->parent [i] != T->parent [j]) ;
 }
 
 //****************************************************************************
-//****************************************************************************
-int LAGraph_msf
+// w[Px[i]] = min(w[Px[i]], s[i]) for i in [0..n-1]
+
+// w and s are full.  The matrix C is packed from Cp (0:n), Px, and Cx (iso),
+// so that C(i,j) is present if i = Px [j], and then w = min (w, C*s) with the
+// given semiring, whose multiplicative operator returns s(j).  Px is returned
+// to the caller when done.  No workspace is allocated.
+
+static GrB_Info Reduce_assign
 (
-    GrB_Matrix *result, // output: an unsymmetrical matrix, the spanning forest
-    GrB_Matrix A,       // input matrix
-    bool sanitize,      // if true, ensure A is symmetric
+    GrB_Vector w,           // input/output vector of size n
+    GrB_Vector s,           // input vector of size n
+    GrB_BinaryOp min,       // accum operator
+    GrB_Semiring min_2nd,   // semiring: min monoid, second multiply
+    GrB_Matrix C,           // empty n-by-n boolean matrix
+    GrB_Index **Cp,         // 0:n, size n+1
+    GrB_Index **Px,         // size n
+    void **Cx,              // size 1, contents not accessed
+    GrB_Index n,
     char *msg
 )
 {
+    GrB_Index Cp_size = (n+1) * sizeof (GrB_Index) ;
+    GrB_Index Ci_size = n * sizeof (GrB_Index) ;
+    GrB_Index Cx_size = sizeof (bool) ;
+    bool iso = true, jumbled = false ;
+    GRB_TRY (GxB_Matrix_pack_CSC (C, Cp, /* Px is Ci: */ Px, Cx,
+        Cp_size, Ci_size, Cx_size, iso, jumbled, NULL)) ;
+    GRB_TRY (GrB_mxv (w, NULL, min, min_2nd, C, s, NULL)) ;
+    GRB_TRY (GxB_Matrix_unpack_CSC (C, Cp, Px, Cx,
+        &Cp_size, &Ci_size, &Cx_size, &iso, &jumbled, NULL)) ;
+    return (GrB_SUCCESS) ;
+}
 
-    LG_CLEAR_MSG ;
-#if !LAGRAPH_SUITESPARSE
-    LG_ASSERT (false, GrB_NOT_IMPLEMENTED) ;
-#else
-    GrB_Info info;
-    GrB_Index n;
-    GrB_Matrix S = NULL, T = NULL;
-    GrB_Vector f = NULL, i = NULL, t = NULL,
-        edge = NULL, cedge = NULL, mask = NULL, index = NULL;
-    GrB_Index *I = NULL, *V = NULL, *SI = NULL, *SJ = NULL, *SX = NULL;
-
-    GrB_BinaryOp comb = NULL;
-    GrB_Semiring combMin = NULL;
-    GrB_UnaryOp fst = NULL, snd = NULL;
-
-    GxB_SelectOp s1 = NULL, s2 = NULL;
-    if (result == NULL || A == NULL) return (GrB_NULL_POINTER) ;
-
-    GrB_Index ncols ;
-    GRB_TRY (GrB_Matrix_nrows (&n, A));
-    GRB_TRY (GrB_Matrix_ncols (&ncols, A));
-    if (n != ncols) return (GrB_DIMENSION_MISMATCH) ;
+//****************************************************************************
+// msf_boruvka: Boruvka's method
+//****************************************************************************
 
-    if (sanitize)
-    {
-        // S = A+A'
-        GRB_TRY (GrB_Matrix_new (&S, GrB_UINT64, n, n));
-        GRB_TRY (GrB_eWiseAdd (S, 0, 0, GrB_PLUS_UINT64, A, A, GrB_DESC_T1));
-    }
-    else
-    {
-        // Use the input as-is, and assume it is GrB_UINT64 and symmetric
-        GRB_TRY (GrB_Matrix_dup (&S, A));
-    }
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL                                         \
+{                                                           \
+    GrB_free (&T) ;                                         \
+    GrB_free (&C) ;                                         \
+    LAGraph_Free ((void **) &V, NULL) ;                     \
+    LAGraph_Free ((void **) &Cp, NULL) ;                    \
+    LAGraph_Free ((void **) &Cx, NULL) ;                    \
+    LAGraph_Free ((void **) &parent, NULL) ;                \
+    LAGraph_Free ((void **) &partner, NULL) ;               \
+    LAGraph_Free ((void **) &weight, NULL) ;                \
+    GrB_free (&f) ;                                         \
+    GrB_free (&i) ;                                         \
+    GrB_free (&t) ;                                         \
+    GrB_free (&tt) ;                                        \
+    GrB_free (&edge) ;                                      \
+    GrB_free (&cedge) ;                                     \
+    GrB_free (&mask) ;                                      \
+    GrB_free (&index) ;                                     \
+    GrB_free (&Tuple) ;                                     \
+    GrB_free (&comb) ;                                      \
+    GrB_free (&tmin) ;                                      \
+    GrB_free (&tsecond) ;                                   \
+    GrB_free (&teq) ;                                       \
+    GrB_free (&tminMonoid) ;                                \
+    GrB_free (&combMin) ;                                   \
+    GrB_free (&minSecond) ;                                 \
+    GrB_free (&fst) ;                                       \
+    GrB_free (&snd) ;                                       \
+    GrB_free (&s1) ;                                        \
+    GrB_free (&s2) ;                                        \
+}
 
-    GRB_TRY (GrB_Matrix_new (&T, GrB_UINT64, n, n));
+static GrB_Info msf_boruvka
+(
+    // output:
+    GrB_Index *SI,          // forest edges (SI [k], SJ [k]) with weight key
+    GrB_Index *SJ,          // SX [k], for k = 0 to ntuples-1.  Each array
+    GrB_Index *SX,          // has size 2*n.
+    GrB_Index *ntuples_handle,
+    // input/output:
+    GrB_Matrix S,           // symmetric matrix of weight keys; destroyed
+    // input:
+    GrB_Index n,
+    int nthreads,
+    char *msg
+)
+{
+    GrB_Matrix T = NULL, C = NULL ;
+    GrB_Vector f = NULL, i = NULL, t = NULL, tt = NULL,
+        edge = NULL, cedge = NULL, mask = NULL, index = NULL;
+    GrB_Index *V = NULL, *Cp = NULL, *parent = NULL, *partner = NULL,
+        *weight = NULL ;
+    void *Cx = NULL ;
+    GrB_Type Tuple = NULL ;
+    GrB_BinaryOp comb = NULL, tmin = NULL, tsecond = NULL, teq = NULL ;
+    GrB_Monoid tminMonoid = NULL ;
+    GrB_Semiring combMin = NULL, minSecond = NULL ;
+    GrB_UnaryOp fst = NULL, snd = NULL ;
+    GrB_IndexUnaryOp s1 = NULL, s2 = NULL ;
+
+    //--------------------------------------------------------------------------
+    // create the edge type and its operators
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_Type_new (&Tuple, sizeof (msf_tuple))) ;
+    msf_tuple inf = { .wt = UINT64_MAX, .idx = UINT64_MAX } ;
+    GRB_TRY (GrB_BinaryOp_new (&comb, combine, Tuple, GrB_UINT64,
+        GrB_UINT64)) ;
+    GRB_TRY (GrB_BinaryOp_new (&tmin, tuple_min, Tuple, Tuple, Tuple)) ;
+    GRB_TRY (GrB_BinaryOp_new (&tsecond, tuple_second, Tuple, GrB_BOOL,
+        Tuple)) ;
+    GRB_TRY (GrB_BinaryOp_new (&teq, tuple_eq, GrB_BOOL, Tuple, Tuple)) ;
+    GRB_TRY (GrB_Monoid_new_UDT (&tminMonoid, tmin, &inf)) ;
+    GRB_TRY (GrB_Semiring_new (&combMin, tminMonoid, comb)) ;
+    GRB_TRY (GrB_Semiring_new (&minSecond, tminMonoid, tsecond)) ;
+    GRB_TRY (GrB_UnaryOp_new (&fst, get_fst, GrB_UINT64, Tuple)) ;
+    GRB_TRY (GrB_UnaryOp_new (&snd, get_snd, GrB_UINT64, Tuple)) ;
+
+    // the select operators, with a pointer to the thunk struct as their y
+    GRB_TRY (GrB_IndexUnaryOp_new (&s1, f1, GrB_BOOL, GrB_UINT64,
+        GrB_UINT64)) ;
+    GRB_TRY (GrB_IndexUnaryOp_new (&s2, f2, GrB_BOOL, GrB_UINT64,
+        GrB_UINT64)) ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace
+    //--------------------------------------------------------------------------
 
     GRB_TRY (GrB_Vector_new (&t, GrB_UINT64, n));
+    GRB_TRY (GrB_Vector_new (&tt, Tuple, n));
     GRB_TRY (GrB_Vector_new (&f, GrB_UINT64, n));
     GRB_TRY (GrB_Vector_new (&i, GrB_UINT64, n));
-    GRB_TRY (GrB_Vector_new (&edge, GrB_UINT64, n));
-    GRB_TRY (GrB_Vector_new (&cedge, GrB_UINT64, n));
+    GRB_TRY (GrB_Vector_new (&edge, Tuple, n));
+    GRB_TRY (GrB_Vector_new (&cedge, Tuple, n));
     GRB_TRY (GrB_Vector_new (&mask, GrB_BOOL, n));
     GRB_TRY (GrB_Vector_new (&index, GrB_UINT64, n));
+    GRB_TRY (GrB_Matrix_new (&C, GrB_BOOL, n, n)) ;
 
-    // temporary arrays
-    I = malloc (sizeof(GrB_Index) * n);
-    V = malloc (sizeof(GrB_Index) * n);
-    SI = malloc (sizeof(GrB_Index) * n * 2);
-    SJ = malloc (sizeof(GrB_Index) * n * 2);
-    SX = malloc (sizeof(GrB_Index) * n * 2);
-
-    // global arrays
-    parent = malloc (sizeof(GrB_Index) * n);
-    weight = malloc (sizeof(GrB_Index) * n);
-    partner = malloc (sizeof(GrB_Index) * n);
+    LG_TRY (LAGraph_Malloc ((void **) &V, n, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Cp, n+1, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Calloc ((void **) &Cx, 1, sizeof (bool), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &parent, n, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &weight, n, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &partner, n, sizeof (GrB_Index), msg)) ;
 
     // prepare vectors
-    for (GrB_Index i = 0; i < n; i++)
-        I[i] = parent[i] = i;
-    GRB_TRY (GrB_Vector_build (f, I, parent, n, GrB_PLUS_UINT64));
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (k = 0 ; k <= n ; k++)
+    {
+        Cp [k] = k ;
+        if (k < n) parent [k] = k ;
+    }
+    GRB_TRY (GrB_assign (f, NULL, NULL, 0, GrB_ALL, n, NULL)) ;
+    GRB_TRY (GrB_apply (f, NULL, NULL, GrB_ROWINDEX_INT64, f, 0, NULL)) ;
     GRB_TRY (GrB_assign (i, 0, 0, f, GrB_ALL, 0, 0));
 
-    // semiring & monoid
-    GrB_Index inf = ((uint64_t) INT_MAX << 32) ^ INT_MAX;
-    GRB_TRY (GrB_BinaryOp_new (&comb, combine, GrB_UINT64, GrB_UINT64, GrB_UINT64));
-    GRB_TRY (GrB_Semiring_new (&combMin, GrB_MIN_MONOID_UINT64, comb));
-    GRB_TRY (GrB_UnaryOp_new (&fst, get_fst, GrB_UINT64, GrB_UINT64));
-    GRB_TRY (GrB_UnaryOp_new (&snd, get_snd, GrB_UINT64, GrB_UINT64));
-
-    // GrB_SelectOp
-    GxB_SelectOp_new (&s1, f1, GrB_UINT64, GrB_NULL);
-    GxB_SelectOp_new (&s2, f2, GrB_UINT64, GrB_NULL);
+    msf_thunk thunk = { .weight = weight, .parent = parent,
+        .partner = partner } ;
+    uint64_t thunk_ptr = (uint64_t) (&thunk) ;
 
+    //--------------------------------------------------------------------------
     // the main computation
+    //--------------------------------------------------------------------------
+
     GrB_Index nvals, diff, ntuples = 0, num;
     GRB_TRY (GrB_Matrix_nvals (&nvals, S));
+    GRB_TRY (GrB_Matrix_new (&T, GrB_UINT64, n, n));
     for (int iters = 1; nvals > 0; iters++)
     {
         // every vertex points to a root vertex at the beginning
         // edge[u] = u's minimum edge (weight and index are encoded together)
-        GRB_TRY (GrB_assign (edge, 0, 0, inf, GrB_ALL, 0, 0));
-        GRB_TRY (GrB_mxv (edge, 0, GrB_MIN_UINT64, combMin, S, f, 0));
+        GRB_TRY (GrB_Vector_assign_UDT (edge, 0, 0, &inf, GrB_ALL, n, 0));
+        GRB_TRY (GrB_mxv (edge, 0, tmin, combMin, S, f, 0));
         // cedge[u] = children's minimum edge  | if u is a root
-        //          = (INT_MAX, u)             | otherwise
-        GRB_TRY (GrB_assign (t, 0, 0, (uint64_t) INT_MAX, GrB_ALL, 0, 0));
+        //          = (UINT64_MAX, u)          | otherwise
+        GRB_TRY (GrB_assign (t, 0, 0, UINT64_MAX, GrB_ALL, 0, 0));
         GRB_TRY (GrB_eWiseMult (cedge, 0, 0, comb, t, i, 0));
-        LG_TRY (Reduce_assign (cedge, edge, parent, n));
+        LG_TRY (Reduce_assign (cedge, edge, tmin, minSecond, C, &Cp, &parent,
+            &Cx, n, msg)) ;
         // if (f[u] == u) f[u] := snd(cedge[u])  -- the index part of the edge
         GRB_TRY (GrB_eWiseMult (mask, 0, 0, GrB_EQ_UINT64, f, i, 0));
         GRB_TRY (GrB_apply (f, mask, GrB_SECOND_UINT64, snd, cedge, 0));
         // identify all the vertex pairs (u, v) where f[u] == v and f[v] == u
         // and then select the minimum of u, v as the new root;
         // if (f[f[i]] == i) f[i] = min(f[i], i)
-        GRB_TRY (GrB_Vector_extractTuples (I, V, &n, f));
+        GRB_TRY (GrB_Vector_extractTuples (NULL, V, &n, f));
         GRB_TRY (GrB_extract (t, 0, 0, f, V, n, 0));
         GRB_TRY (GrB_eWiseMult (mask, 0, 0, GrB_EQ_UINT64, i, t, 0));
         GRB_TRY (GrB_assign (f, mask, GrB_MIN_UINT64, i, GrB_ALL, 0, 0));
@@ -215,34 +370,36 @@ int LAGraph_msf
         // five steps to generate the solution
         // 1. new roots (f[i] == i) revise their entries in cedge
         GRB_TRY (GrB_eWiseMult (mask, 0, 0, GrB_EQ_UINT64, i, f, 0));
-        GRB_TRY (GrB_assign (cedge, mask, 0, inf, GrB_ALL, 0, 0));
+        GRB_TRY (GrB_Vector_assign_UDT (cedge, mask, 0, &inf, GrB_ALL, n, 0));
 
         // 2. every vertex tries to know whether one of its edges is selected
-        GRB_TRY (GrB_extract (t, 0, 0, cedge, parent, n, 0));
-        GRB_TRY (GrB_eWiseMult (mask ,0, 0, GrB_EQ_UINT64, edge, t, 0));
+        GRB_TRY (GrB_extract (tt, 0, 0, cedge, parent, n, 0));
+        GRB_TRY (GrB_eWiseMult (mask ,0, 0, teq, edge, tt, 0));
 
         // 3. each root picks a vertex from its children to generate the solution
         GRB_TRY (GrB_assign (index, 0, 0, n, GrB_ALL, 0, 0));
         GRB_TRY (GrB_assign (index, mask, 0, i, GrB_ALL, 0, 0));
         GRB_TRY (GrB_assign (t, 0, 0, n, GrB_ALL, 0, 0));
-        LG_TRY (Reduce_assign (t, index, parent, n));
+        LG_TRY (Reduce_assign (t, index, GrB_MIN_UINT64,
+            GrB_MIN_SECOND_SEMIRING_UINT64, C, &Cp, &parent, &Cx, n, msg)) ;
         GRB_TRY (GrB_extract (index, 0, 0, t, parent, n, 0));
         GRB_TRY (GrB_eWiseMult (mask ,0, 0, GrB_EQ_UINT64, i, index, 0));
 
-        // 4. generate the select function (set the global pointers)
-        GRB_TRY (GrB_assign (t, 0, 0, inf, GrB_ALL, 0, 0));
+        // 4. generate the select function (set the thunk pointers)
+        GRB_TRY (GrB_assign (t, 0, 0, UINT64_MAX, GrB_ALL, 0, 0));
         GRB_TRY (GrB_apply (t, mask, 0, fst, edge, 0));
-        GRB_TRY (GrB_Vector_extractTuples (I, weight, &n, t));
-        GRB_TRY (GrB_assign (t, 0, 0, inf, GrB_ALL, 0, 0));
+        GRB_TRY (GrB_Vector_extractTuples (NULL, weight, &n, t));
+        GRB_TRY (GrB_assign (t, 0, 0, UINT64_MAX, GrB_ALL, 0, 0));
         GRB_TRY (GrB_apply (t, mask, 0, snd, edge, 0));
-        GRB_TRY (GrB_Vector_extractTuples (I, partner, &n, t));
-        GRB_TRY (GxB_select (T, 0, 0, s1, S, GrB_NULL, 0));
+        GRB_TRY (GrB_Vector_extractTuples (NULL, partner, &n, t));
+        thunk.parent = parent ;
+        GRB_TRY (GrB_select (T, 0, 0, s1, S, thunk_ptr, 0));
         GRB_TRY (GrB_Vector_clear (t));
 
         // 5. the generated matrix may still have redundant edges
         //    remove the duplicates by GrB_mxv() and store them as tuples
         GRB_TRY (GrB_Vector_clear (edge));
-        GRB_TRY (GrB_mxv (edge, mask, GrB_MIN_UINT64, combMin, T, i, 0));
+        GRB_TRY (GrB_mxv (edge, mask, tmin, combMin, T, i, 0));
         GRB_TRY (GrB_Vector_nvals (&num, edge));
         GRB_TRY (GrB_apply (t, 0, 0, snd, edge, 0));
         GRB_TRY (GrB_Vector_extractTuples (SI + ntuples, SJ + ntuples, &num, t));
@@ -253,7 +410,7 @@ int LAGraph_msf
 
         // path halving until every vertex points on a root
         do {
-            GRB_TRY (GrB_Vector_extractTuples (I, V, &n, f));
+            GRB_TRY (GrB_Vector_extractTuples (NULL, V, &n, f));
             GRB_TRY (GrB_extract (t, 0, 0, f, V, n, 0));
             GRB_TRY (GrB_eWiseMult (mask, 0, 0, GrB_NE_UINT64, f, t, 0));
             GRB_TRY (GrB_assign (f, 0, 0, t, GrB_ALL, 0, 0));
@@ -261,13 +418,445 @@ int LAGraph_msf
         } while (diff != 0);
 
         // remove the edges in the same connected component
-        GRB_TRY (GrB_Vector_extractTuples (I, parent, &n, f));
-        GRB_TRY (GxB_select (S, 0, 0, s2, S, GrB_NULL, 0));
-        GrB_Matrix_nvals (&nvals, S);
+        GRB_TRY (GrB_Vector_extractTuples (NULL, parent, &n, f));
+        thunk.parent = parent ;
+        GRB_TRY (GrB_select (S, 0, 0, s2, S, thunk_ptr, 0));
+        GRB_TRY (GrB_Matrix_nvals (&nvals, S));
         if (nvals == 0) break;
     }
-    GRB_TRY (GrB_Matrix_clear (T));
-    GRB_TRY (GrB_Matrix_build (T, SI, SJ, SX, ntuples, GrB_SECOND_UINT64));
+
+    (*ntuples_handle) = ntuples ;
+    LG_FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
+
+//****************************************************************************
+// msf_filter_kruskal: the Filter-Kruskal method
+//****************************************************************************
+
+// The edges are held as three int64_t arrays, (K [k], I [k], J [k]), with
+// I [k] > J [k], where K [k] is the weight key of the edge with its sign bit
+// flipped, so that the signed ordering of K matches the ordering of the
+// weights.  This is the form used by the parallel LG_msort3.  The forest is
+// held as a union-find structure P with P [i] <= i, where P [i] = i if i is a
+// root.
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL ;
+
+// # of edges sampled to select a pivot, or to estimate the weight diversity
+#define MSF_NSAMPLE 1024
+
+// msf_find: find the root of i, with path halving
+static inline int64_t msf_find (int64_t *P, int64_t i)
+{
+    while (P [i] != i)
+    {
+        P [i] = P [P [i]] ;
+        i = P [i] ;
+    }
+    return (i) ;
+}
+
+// msf_sample: sort a sample of the keys K [0..m-1], and return its size
+static int64_t msf_sample (int64_t *sample, const int64_t *K, int64_t m)
+{
+    int64_t ns = LAGRAPH_MIN (m, MSF_NSAMPLE) ;
+    for (int64_t s = 0 ; s < ns ; s++)
+    {
+        sample [s] = K [(s * m) / ns] ;
+    }
+    LG_qsort_1a (sample, ns) ;
+    return (ns) ;
+}
+
+// msf_kruskal: Kruskal's method on the edges K, I, J [0..m-1]
+static GrB_Info msf_kruskal
+(
+    int64_t *K, int64_t *I, int64_t *J, int64_t m,
+    int64_t *P,
+    GrB_Index *SI, GrB_Index *SJ, GrB_Index *SX, GrB_Index *ntuples,
+    char *msg
+)
+{
+    // sort the edges by weight, with ties broken by I and then J
+    LG_TRY (LG_msort3 (K, I, J, m, msg)) ;
+    for (int64_t k = 0 ; k < m ; k++)
+    {
+        int64_t ri = msf_find (P, I [k]) ;
+        int64_t rj = msf_find (P, J [k]) ;
+        if (ri == rj) continue ;
+        // add the edge to the forest, linking the larger root to the smaller
+        P [LAGRAPH_MAX (ri, rj)] = LAGRAPH_MIN (ri, rj) ;
+        SI [*ntuples] = I [k] ;
+        SJ [*ntuples] = J [k] ;
+        SX [*ntuples] = ((uint64_t) K [k]) ^ MSF_SIGN64 ;
+        (*ntuples)++ ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
+// msf_filter_kruskal: partition the edges with a sampled pivot weight, find
+// the forest of the light edges, then discard the heavy edges whose endpoints
+// are already connected, and find the forest of the remaining heavy edges.
+static GrB_Info msf_filter_kruskal
+(
+    int64_t *K, int64_t *I, int64_t *J, int64_t m,
+    int64_t *P,
+    GrB_Index *SI, GrB_Index *SJ, GrB_Index *SX, GrB_Index *ntuples,
+    char *msg
+)
+{
+    if (m <= LG_BASECASE)
+    {
+        return (msf_kruskal (K, I, J, m, P, SI, SJ, SX, ntuples, msg)) ;
+    }
+
+    // select the pivot as the median of a sample of the weights
+    int64_t sample [MSF_NSAMPLE] ;
+    int64_t ns = msf_sample (sample, K, m) ;
+    int64_t pivot = sample [ns/2] ;
+
+    // partition the edges: light edges (K <= pivot) first, then heavy edges
+    int64_t lo = 0, hi = m-1 ;
+    while (lo <= hi)
+    {
+        if (K [lo] <= pivot)
+        {
+            lo++ ;
+        }
+        else
+        {
+            int64_t tk = K [lo] ; K [lo] = K [hi] ; K [hi] = tk ;
+            int64_t ti = I [lo] ; I [lo] = I [hi] ; I [hi] = ti ;
+            int64_t tj = J [lo] ; J [lo] = J [hi] ; J [hi] = tj ;
+            hi-- ;
+        }
+    }
+    int64_t nlight = lo ;
+    if (nlight == m)
+    {
+        // the pivot is the largest weight; the edges cannot be split
+        return (msf_kruskal (K, I, J, m, P, SI, SJ, SX, ntuples, msg)) ;
+    }
+
+    // find the forest of the light edges
+    LG_TRY (msf_filter_kruskal (K, I, J, nlight, P, SI, SJ, SX, ntuples,
+        msg)) ;
+
+    // filter the heavy edges
+    int64_t nheavy = 0 ;
+    int64_t *Kh = K + nlight, *Ih = I + nlight, *Jh = J + nlight ;
+    for (int64_t k = 0 ; k < m - nlight ; k++)
+    {
+        if (msf_find (P, Ih [k]) != msf_find (P, Jh [k]))
+        {
+            Kh [nheavy] = Kh [k] ;
+            Ih [nheavy] = Ih [k] ;
+            Jh [nheavy] = Jh [k] ;
+            nheavy++ ;
+        }
+    }
+
+    // find the forest of the remaining heavy edges
+    return (msf_filter_kruskal (Kh, Ih, Jh, nheavy, P, SI, SJ, SX, ntuples,
+        msg)) ;
+}
+
+//****************************************************************************
+// msf_low_diversity: estimate if the weights have low diversity
+//****************************************************************************
+
+// The weights of up to MSF_NROWS evenly-spaced rows of S are extracted, so
+// the estimate takes time proportional to the # of entries in those rows, not
+// to the # of edges of the graph.  The weights have low diversity if a sample
+// of them has at most 1/16th distinct values.
+
+#define MSF_NROWS 64
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL                                         \
+{                                                           \
+    GrB_free (&R) ;                                         \
+    LAGraph_Free ((void **) &Rx, NULL) ;                    \
+}
+
+static GrB_Info msf_low_diversity
+(
+    bool *low_diversity,
+    GrB_Matrix S,
+    GrB_Index n,
+    char *msg
+)
+{
+    GrB_Matrix R = NULL ;
+    int64_t *Rx = NULL ;
+    GrB_Index rows [MSF_NROWS], nr = LAGRAPH_MIN (n, MSF_NROWS), nrx ;
+    for (int64_t r = 0 ; r < nr ; r++)
+    {
+        rows [r] = (r * n) / nr ;
+    }
+    GRB_TRY (GrB_Matrix_new (&R, GrB_UINT64, nr, n)) ;
+    GRB_TRY (GrB_extract (R, NULL, NULL, S, rows, nr, GrB_ALL, n, NULL)) ;
+    GRB_TRY (GrB_Matrix_nvals (&nrx, R)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Rx, LAGRAPH_MAX (nrx, 1),
+        sizeof (int64_t), msg)) ;
+    GRB_TRY (GrB_Matrix_extractTuples_UINT64 (NULL, NULL, (uint64_t *) Rx,
+        &nrx, R)) ;
+    int64_t sample [MSF_NSAMPLE] ;
+    int64_t ns = msf_sample (sample, Rx, nrx), ndistinct = 0 ;
+    for (int64_t s = 0 ; s < ns ; s++)
+    {
+        if (s == 0 || sample [s] != sample [s-1]) ndistinct++ ;
+    }
+    (*low_diversity) = (ns >= 16 && ndistinct <= ns / 16) ;
+    LG_FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
+
+//****************************************************************************
+// LAGraph_msf_ByMethod
+//****************************************************************************
+
+#undef  LG_FREE_WORK
+#define LG_FREE_WORK                                        \
+{                                                           \
+    GrB_free (&S) ;                                         \
+    GrB_free (&W) ;                                         \
+    GrB_free (&encode) ;                                    \
+    LAGraph_Free ((void **) &SI, NULL) ;                    \
+    LAGraph_Free ((void **) &SJ, NULL) ;                    \
+    LAGraph_Free ((void **) &SX, NULL) ;                    \
+    LAGraph_Free ((void **) &Wx, NULL) ;                    \
+    LAGraph_Free ((void **) &EI, NULL) ;                    \
+    LAGraph_Free ((void **) &EJ, NULL) ;                    \
+    LAGraph_Free ((void **) &EK, NULL) ;                    \
+    LAGraph_Free ((void **) &P, NULL) ;                     \
+}
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL                                         \
+{                                                           \
+    LG_FREE_WORK ;                                          \
+    GrB_free (&T) ;                                         \
+}
+
+#endif
+
+int LAGraph_msf_ByMethod
+(
+    GrB_Matrix *result, // output: an unsymmetrical matrix, the spanning forest
+    GrB_Matrix A,       // input matrix
+    bool sanitize,      // if true, ensure A is symmetric
+    LAGraph_msf_Method *method, // input/output: method to use
+    char *msg
+)
+{
+
+    LG_CLEAR_MSG ;
+#if !LAGRAPH_SUITESPARSE
+    LG_ASSERT (false, GrB_NOT_IMPLEMENTED) ;
+#else
+    GrB_Index n;
+    GrB_Matrix S = NULL, T = NULL, W = NULL ;
+    GrB_UnaryOp encode = NULL ;
+    GrB_Index *SI = NULL, *SJ = NULL, *SX = NULL ;
+    int64_t *EI = NULL, *EJ = NULL, *EK = NULL, *P = NULL ;
+    void *Wx = NULL ;
+
+    LG_ASSERT (result != NULL && A != NULL, GrB_NULL_POINTER) ;
+    (*result) = NULL ;
+    LAGraph_msf_Method m = (method == NULL) ? LAGraph_msf_AutoMethod
+        : (*method) ;
+    LG_ASSERT_MSG (m == LAGraph_msf_AutoMethod || m == LAGraph_msf_Boruvka
+        || m == LAGraph_msf_FilterKruskal, GrB_INVALID_VALUE,
+        "method is invalid") ;
+
+    GrB_Index ncols ;
+    GRB_TRY (GrB_Matrix_nrows (&n, A));
+    GRB_TRY (GrB_Matrix_ncols (&ncols, A));
+    LG_ASSERT_MSG (n == ncols, GrB_DIMENSION_MISMATCH, "A must be square") ;
+
+    int nthreads_outer, nthreads_inner ;
+    LG_TRY (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+    int nthreads = nthreads_outer * nthreads_inner ;
+
+    //--------------------------------------------------------------------------
+    // determine the type of the weights
+    //--------------------------------------------------------------------------
+
+    GrB_Type atype, wtype ;
+    char typename [LAGRAPH_MAX_NAME_LEN] ;
+    LG_TRY (LAGraph_Matrix_TypeName (typename, A, msg)) ;
+    LG_TRY (LAGraph_TypeFromName (&atype, typename, msg)) ;
+    if (atype == GrB_FP64)
+    {
+        wtype = GrB_FP64 ;
+        GRB_TRY (GrB_UnaryOp_new (&encode, key_fp64, GrB_UINT64, GrB_FP64)) ;
+    }
+    else if (atype == GrB_FP32)
+    {
+        wtype = GrB_FP32 ;
+        GRB_TRY (GrB_UnaryOp_new (&encode, key_fp32, GrB_UINT64, GrB_FP32)) ;
+    }
+    else if (atype == GrB_INT8  || atype == GrB_INT16 ||
+             atype == GrB_INT32 || atype == GrB_INT64)
+    {
+        wtype = GrB_INT64 ;
+        GRB_TRY (GrB_UnaryOp_new (&encode, key_int64, GrB_UINT64, GrB_INT64));
+    }
+    else
+    {
+        LG_ASSERT_MSG (atype == GrB_BOOL   || atype == GrB_UINT8  ||
+                       atype == GrB_UINT16 || atype == GrB_UINT32 ||
+                       atype == GrB_UINT64, GrB_DOMAIN_MISMATCH,
+                       "edge weights must have a built-in real type") ;
+        wtype = GrB_UINT64 ;
+    }
+
+    //--------------------------------------------------------------------------
+    // S = keys of the weights of A (or A+A')
+    //--------------------------------------------------------------------------
+
+    if (sanitize)
+    {
+        // W = A+A'
+        GRB_TRY (GrB_Matrix_new (&W, wtype, n, n));
+        GrB_BinaryOp plus = (wtype == GrB_FP64) ? GrB_PLUS_FP64 :
+                            (wtype == GrB_FP32) ? GrB_PLUS_FP32 :
+                            (wtype == GrB_INT64) ? GrB_PLUS_INT64 :
+                                                   GrB_PLUS_UINT64 ;
+        GRB_TRY (GrB_eWiseAdd (W, 0, 0, plus, A, A, GrB_DESC_T1));
+    }
+
+    // Use the input (or A+A') and assume it is symmetric
+    GRB_TRY (GrB_Matrix_new (&S, GrB_UINT64, n, n));
+    if (encode != NULL)
+    {
+        GRB_TRY (GrB_apply (S, NULL, NULL, encode, sanitize ? W : A, NULL)) ;
+    }
+    else
+    {
+        GRB_TRY (GrB_assign (S, NULL, NULL, sanitize ? W : A, GrB_ALL, n,
+            GrB_ALL, n, NULL)) ;
+    }
+    GRB_TRY (GrB_free (&W)) ;
+
+    int64_t k ;
+    GrB_Index ntuples = 0 ;
+    LG_TRY (LAGraph_Malloc ((void **) &SI, 2*n, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &SJ, 2*n, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &SX, 2*n, sizeof (GrB_Index), msg)) ;
+
+    //--------------------------------------------------------------------------
+    // select the method
+    //--------------------------------------------------------------------------
+
+    // The automatic selection uses Filter-Kruskal if the graph is sparse
+    // (average degree of 16 or less), or if its weights have low diversity
+    // (a sample of the weights has at most 1/16th distinct values).
+    // Otherwise, Boruvka's method is used.
+
+    if (m == LAGraph_msf_AutoMethod)
+    {
+        GrB_Index nvals ;
+        GRB_TRY (GrB_Matrix_nvals (&nvals, S)) ;
+        bool sparse = (nvals <= 16 * n) ;
+        bool low_diversity = false ;
+        if (!sparse)
+        {
+            LG_TRY (msf_low_diversity (&low_diversity, S, n, msg)) ;
+        }
+        m = (sparse || low_diversity) ? LAGraph_msf_FilterKruskal
+                                      : LAGraph_msf_Boruvka ;
+    }
+
+    //--------------------------------------------------------------------------
+    // find the forest with Filter-Kruskal
+    //--------------------------------------------------------------------------
+
+    if (m == LAGraph_msf_FilterKruskal)
+    {
+        // get the edges of tril (S,-1)
+        GrB_Index ne ;
+        GRB_TRY (GrB_Matrix_new (&W, GrB_UINT64, n, n)) ;
+        GRB_TRY (GrB_select (W, NULL, NULL, GrB_TRIL, S, -1, NULL)) ;
+        GRB_TRY (GrB_Matrix_nvals (&ne, W)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &EI, ne, sizeof (int64_t), msg)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &EJ, ne, sizeof (int64_t), msg)) ;
+        LG_TRY (LAGraph_Malloc ((void **) &EK, ne, sizeof (int64_t), msg)) ;
+        GRB_TRY (GrB_Matrix_extractTuples_UINT64 ((GrB_Index *) EI,
+            (GrB_Index *) EJ, (uint64_t *) EK, &ne, W)) ;
+        GRB_TRY (GrB_free (&W)) ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < ne ; k++)
+        {
+            EK [k] = (int64_t) (((uint64_t) EK [k]) ^ MSF_SIGN64) ;
+        }
+
+        LG_TRY (LAGraph_Malloc ((void **) &P, n, sizeof (int64_t), msg)) ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < n ; k++)
+        {
+            P [k] = k ;
+        }
+        LG_TRY (msf_filter_kruskal (EK, EI, EJ, ne, P, SI, SJ, SX,
+            &ntuples, msg)) ;
+
+        LAGraph_Free ((void **) &EI, NULL) ;
+        LAGraph_Free ((void **) &EJ, NULL) ;
+        LAGraph_Free ((void **) &EK, NULL) ;
+        LAGraph_Free ((void **) &P, NULL) ;
+    }
+
+    if (m == LAGraph_msf_Boruvka)
+    {
+        LG_TRY (msf_boruvka (SI, SJ, SX, &ntuples, S, n, nthreads, msg)) ;
+    }
+    if (method != NULL) (*method) = m ;
+
+    //--------------------------------------------------------------------------
+    // construct the result, with the weights decoded from their keys
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_Matrix_new (&T, wtype, n, n));
+    if (wtype == GrB_FP64)
+    {
+        LG_TRY (LAGraph_Malloc (&Wx, ntuples, sizeof (double), msg)) ;
+        double *X = (double *) Wx ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < ntuples ; k++)
+        {
+            X [k] = unkey_fp64 (SX [k]) ;
+        }
+        GRB_TRY (GrB_Matrix_build (T, SI, SJ, X, ntuples, GrB_SECOND_FP64)) ;
+    }
+    else if (wtype == GrB_FP32)
+    {
+        LG_TRY (LAGraph_Malloc (&Wx, ntuples, sizeof (float), msg)) ;
+        float *X = (float *) Wx ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < ntuples ; k++)
+        {
+            X [k] = unkey_fp32 (SX [k]) ;
+        }
+        GRB_TRY (GrB_Matrix_build (T, SI, SJ, X, ntuples, GrB_SECOND_FP32)) ;
+    }
+    else if (wtype == GrB_INT64)
+    {
+        LG_TRY (LAGraph_Malloc (&Wx, ntuples, sizeof (int64_t), msg)) ;
+        int64_t *X = (int64_t *) Wx ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < ntuples ; k++)
+        {
+            X [k] = (int64_t) (SX [k] ^ MSF_SIGN64) ;
+        }
+        GRB_TRY (GrB_Matrix_build (T, SI, SJ, X, ntuples, GrB_SECOND_INT64)) ;
+    }
+    else
+    {
+        GRB_TRY (GrB_Matrix_build (T, SI, SJ, SX, ntuples, GrB_SECOND_UINT64));
+    }
     *result = T;
     T = NULL ;
 
@@ -275,3 +864,18 @@ int LAGraph_msf
     return GrB_SUCCESS;
 #endif
 }
+
+//****************************************************************************
+// LAGraph_msf: minimum spanning forest, with automatic method selection
+//****************************************************************************
+
+int LAGraph_msf
+(
+    GrB_Matrix *result, // output: an unsymmetrical matrix, the spanning forest
+    GrB_Matrix A,       // input matrix
+    bool sanitize,      // if true, ensure A is symmetric
+    char *msg
+)
+{
+    return (LAGraph_msf_ByMethod (result, A, sanitize, NULL, msg)) ;
+}
@@ -19,18 +19,52 @@
  * DOI: https://doi.org/10.14778/2733085.2733089
  **/
 
+// The method has three phases:
+//
+// (1) trimming: vertices with no incoming or no outgoing edges are trivial
+//      SCCs (trim-1).  Pairs of vertices u and v where v is the only
+//      in-neighbor (or only out-neighbor) of u, and u is the only in-neighbor
+//      (or only out-neighbor) of v, form an SCC of size two (trim-2).  The
+//      edges incident on these vertices are removed, and trimming repeats
+//      until it no longer makes significant progress.
+//
+// (2) forward-backward pivot: a single vertex p of high in- and out-degree is
+//      selected, and the vertices reachable from p (forward) and that can
+//      reach p (backward) are found.  Their intersection is the SCC of p,
+//      which is the giant SCC in many real graphs.  No SCC can contain
+//      vertices of two different sets of this forward/backward partition, so
+//      the edges between them are removed.
+//
+// (3) coloring: the Min-Label algorithm finds the remaining SCCs.
+//
+// Each SCC is labeled with the smallest vertex index it contains.
+
+// This method is reentrant: the arrays read by the IndexUnaryOp that removes
+// edges are passed to it through the thunk of GrB_select, as a pointer to a
+// struct.
+
 #define LG_FREE_ALL ;
 
 #include "LG_internal.h"
 #include <LAGraph.h>
 #include <LAGraphX.h>
 
+#if LAGRAPH_SUITESPARSE
+
 //****************************************************************************
-// global C arrays used in SelectOp
-GrB_Index *I = NULL, *V = NULL, *F = NULL, *B = NULL, *M = NULL;
+// scc_thunk: the state used by edge_removal
+typedef struct
+{
+    const GrB_Index *F ;    // forward labels, or NULL
+    const GrB_Index *B ;    // backward labels, or NULL
+    const GrB_Index *M ;    // M [i] = SCC of i, or n if not yet assigned
+    GrB_Index n ;           // # of vertices
+}
+scc_thunk ;
 
+//****************************************************************************
 // edge_removal:
-//  - remove the edges connected to newly identified SCCs (vertices u with M[u]==1)
+//  - remove the edges connected to identified SCCs (vertices u with M[u]!=n)
 //  - remove the edges (u, v) where u and v can never be in the same SCC.
 //
 // Here's a brief explanation of the second case. After the forward and backward
@@ -40,22 +74,24 @@ GrB_Index *I = NULL, *V = NULL, *F = NULL, *B = NULL, *M = NULL;
 // If two vertices u and v are in the same SCC, then F[u]==F[v] and B[u]==B[v] must
 // hold. The converse is not true unless F[u]==B[u]. However, we can safely remove
 // an edge (u, v) if either F[u]!=F[v] or B[u]!=B[v] holds, which can accelerate
-// the SCC computation in the future rounds.
-bool edge_removal (GrB_Index i, GrB_Index j, const void *x, const void *thunk) ;
-bool edge_removal (GrB_Index i, GrB_Index j, const void *x, const void *thunk)
-{
-    return !M[i] && !M[j] && F[i] == F[j] && B[i] == B[j];
-}
+// the SCC computation in the future rounds.  The same holds for the labels
+// computed by the forward-backward pivot phase.
+//
+// Rather than using global variables, the arrays are passed to the select
+// function as a uint64_t value that contains a pointer to an scc_thunk struct,
+// as in LG_CC_Boruvka.
 
-//****************************************************************************
-// trim_one: remove the edges connected to trivial SCCs
-//  - A vertex is a trivial SCC if it has no incoming or outgoing edges.
-//  - M[i] = i   | if vertex i is a trivial SCC
-//    M[i] = n   | otherwise
-bool trim_one (GrB_Index i, GrB_Index j, const void *x, const void *thunk) ;
-bool trim_one (GrB_Index i, GrB_Index j, const void *x, const void *thunk)
+static void edge_removal (void *z, const void *x,
+    const GrB_Index i, const GrB_Index j, const void *y)
 {
-    return M[i] == M[j];
+    const scc_thunk *T = (*(const scc_thunk **) y) ;
+    const GrB_Index *M = T->M ;
+    bool keep = (M [i] == T->n && M [j] == T->n) ;
+    if (keep && T->F != NULL)
+    {
+        keep = (T->F [i] == T->F [j] && T->B [i] == T->B [j]) ;
+    }
+    (*((bool *) z)) = keep ;
 }
 
 //****************************************************************************
@@ -66,13 +102,20 @@ bool trim_one (GrB_Index i, GrB_Index j, const void *x, const void *thunk)
 //  - AT     : (input) transposed matrix
 //  - n      : (input) number of vertices
 
+#undef  LG_FREE_WORK
+#define LG_FREE_WORK        \
+{                           \
+    GrB_free (&s) ;         \
+    GrB_free (&t) ;         \
+}
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL LG_FREE_WORK
+
 static GrB_Info propagate (GrB_Vector label, GrB_Vector mask,
         GrB_Matrix A, GrB_Matrix AT, GrB_Index n, char *msg)
 {
-    GrB_Info info;
-    // semirings
-
-    GrB_Vector s, t;
+    GrB_Vector s = NULL, t = NULL ;
     GRB_TRY (GrB_Vector_new (&s, GrB_UINT64, n));
     GRB_TRY (GrB_Vector_new (&t, GrB_UINT64, n));
     GRB_TRY (GrB_assign (s, mask, 0, label, GrB_ALL, 0, 0));
@@ -91,13 +134,88 @@ static GrB_Info propagate (GrB_Vector label, GrB_Vector mask,
         GRB_TRY (GrB_assign (s, mask, 0, label, GrB_ALL, 0, 0));
     }
 
-    GRB_TRY (GrB_free (&s));
-    GRB_TRY (GrB_free (&t));
+    LG_FREE_WORK ;
     return GrB_SUCCESS;
 }
 
+//****************************************************************************
+// degrees: find the in/out-degree of each vertex, and its smallest in/out-
+// neighbor (Pin [i] and Pout [i] are only meaningful if the degree is one).
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL ;
+
+static GrB_Info degrees
+(
+    GrB_Index *Din,         // Din [i]: # of in-neighbors of i
+    GrB_Index *Dout,        // Dout [i]: # of out-neighbors of i
+    GrB_Index *Pin,         // Pin [i]: smallest in-neighbor of i
+    GrB_Index *Pout,        // Pout [i]: smallest out-neighbor of i
+    GrB_Vector d,           // workspace, GrB_UINT64 of size n
+    GrB_Vector w,           // workspace, GrB_INT64 of size n
+    GrB_Matrix FW,          // FW(i,j) present for each edge i->j
+    GrB_Matrix BW,          // BW = FW'
+    GrB_Index n,
+    char *msg
+)
+{
+    // d = 0, then d += sum (BW (i,:)), and w = min (n, BW*d) using the
+    // MIN_SECONDI semiring (the values of d are not accessed).
+    GRB_TRY (GrB_assign (d, NULL, NULL, 0, GrB_ALL, n, NULL)) ;
+    GRB_TRY (GrB_reduce (d, NULL, GrB_PLUS_UINT64, GrB_PLUS_MONOID_UINT64,
+        BW, NULL)) ;
+    GRB_TRY (GrB_Vector_extractTuples (NULL, Din, &n, d)) ;
+    GRB_TRY (GrB_assign (w, NULL, NULL, n, GrB_ALL, n, NULL)) ;
+    GRB_TRY (GrB_mxv (w, NULL, GrB_MIN_INT64, GxB_MIN_SECONDI_INT64, BW, d,
+        NULL)) ;
+    GRB_TRY (GrB_Vector_extractTuples (NULL, Pin, &n, w)) ;
+
+    // likewise for the out-neighbors, with FW
+    GRB_TRY (GrB_assign (d, NULL, NULL, 0, GrB_ALL, n, NULL)) ;
+    GRB_TRY (GrB_reduce (d, NULL, GrB_PLUS_UINT64, GrB_PLUS_MONOID_UINT64,
+        FW, NULL)) ;
+    GRB_TRY (GrB_Vector_extractTuples (NULL, Dout, &n, d)) ;
+    GRB_TRY (GrB_assign (w, NULL, NULL, n, GrB_ALL, n, NULL)) ;
+    GRB_TRY (GrB_mxv (w, NULL, GrB_MIN_INT64, GxB_MIN_SECONDI_INT64, FW, d,
+        NULL)) ;
+    GRB_TRY (GrB_Vector_extractTuples (NULL, Pout, &n, w)) ;
+    return (GrB_SUCCESS) ;
+}
+
 //****************************************************************************
 //****************************************************************************
+
+#undef  LG_FREE_WORK
+#define LG_FREE_WORK                            \
+{                                               \
+    LAGraph_Free ((void **) &I, NULL) ;         \
+    LAGraph_Free ((void **) &F, NULL) ;         \
+    LAGraph_Free ((void **) &B, NULL) ;         \
+    LAGraph_Free ((void **) &M, NULL) ;         \
+    LAGraph_Free ((void **) &Din, NULL) ;       \
+    LAGraph_Free ((void **) &Dout, NULL) ;      \
+    LAGraph_Free ((void **) &Pin, NULL) ;       \
+    LAGraph_Free ((void **) &Pout, NULL) ;      \
+    GrB_free (&ind) ;                           \
+    GrB_free (&inf) ;                           \
+    GrB_free (&f) ;                             \
+    GrB_free (&b) ;                             \
+    GrB_free (&w) ;                             \
+    GrB_free (&mask) ;                          \
+    GrB_free (&FW) ;                            \
+    GrB_free (&BW) ;                            \
+    GrB_free (&sel) ;                           \
+}
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL                             \
+{                                               \
+    LG_FREE_WORK ;                              \
+    GrB_free (&scc) ;                           \
+}
+
+#endif
+
 int LAGraph_scc
 (
     GrB_Vector *result,     // output: array of component identifiers
@@ -110,79 +228,208 @@ int LAGraph_scc
 #if !LAGRAPH_SUITESPARSE
     LG_ASSERT (false, GrB_NOT_IMPLEMENTED) ;
 #else
-    GrB_Info info;
-    GrB_Vector scc;
-    GrB_Vector ind;
-    GrB_Vector inf;
-    GrB_Vector f, b, mask;
-    GxB_SelectOp sel1, sel2;
-    GrB_Monoid Add;
+    GrB_Index *I = NULL, *F = NULL, *B = NULL, *M = NULL, *Din = NULL,
+        *Dout = NULL, *Pin = NULL, *Pout = NULL ;
+    GrB_Vector scc = NULL, ind = NULL, inf = NULL, f = NULL, b = NULL,
+        w = NULL, mask = NULL ;
+    GrB_Matrix FW = NULL, BW = NULL ;
+    GrB_IndexUnaryOp sel = NULL ;
 
-    if (result == NULL || A == NULL) return (GrB_NULL_POINTER) ;
+    LG_ASSERT (result != NULL && A != NULL, GrB_NULL_POINTER) ;
+    (*result) = NULL ;
 
     GrB_Index n, ncols, nvals;
     GRB_TRY (GrB_Matrix_nrows (&n, A));
     GRB_TRY (GrB_Matrix_ncols (&ncols, A));
-    if (n != ncols) return (GrB_DIMENSION_MISMATCH) ;
-
-    // store the graph in both directions (forward / backward)
-    GrB_Matrix FW, BW;
-    GRB_TRY (GrB_Matrix_new (&FW, GrB_BOOL, n, n));
+    LG_ASSERT_MSG (n == ncols, GrB_DIMENSION_MISMATCH, "A must be square") ;
+
+    // store the graph in both directions (forward / backward), without its
+    // self-edges.  Any input format is accepted; FW and BW are held by row so
+    // that the vxm in propagate is a push step.
+    LG_TRY (LAGraph_Matrix_Structure (&FW, A, msg)) ;
+    GRB_TRY (GxB_set (FW, GxB_FORMAT, GxB_BY_ROW)) ;
+    GRB_TRY (GrB_select (FW, NULL, NULL, GrB_OFFDIAG, FW, 0, NULL)) ;
     GRB_TRY (GrB_Matrix_new (&BW, GrB_BOOL, n, n));
-    GRB_TRY (GrB_transpose (FW, 0, 0, A, GrB_DESC_T0)); // FW = A
-    GRB_TRY (GrB_transpose (BW, 0, 0, A, 0));     // BW = A'
-
-    // check format
-    GxB_Format_Value A_format, AT_format;
-    GRB_TRY (GxB_get (FW, GxB_FORMAT, &A_format));
-    GRB_TRY (GxB_get (BW, GxB_FORMAT, &AT_format));
-
-    bool is_csr = (A_format == GxB_BY_ROW && AT_format == GxB_BY_ROW);
-    if (!is_csr) return (GrB_INVALID_VALUE) ;
-
-    I = (GrB_Index*) malloc(sizeof(GrB_Index) * n);
-    V = (GrB_Index*) malloc(sizeof(GrB_Index) * n);
-    F = (GrB_Index*) malloc(sizeof(GrB_Index) * n);
-    B = (GrB_Index*) malloc(sizeof(GrB_Index) * n);
-    M = (GrB_Index*) malloc(sizeof(GrB_Index) * n);
-    for (GrB_Index i = 0; i < n; i++)
-        I[i] = V[i] = i;
+    GRB_TRY (GxB_set (BW, GxB_FORMAT, GxB_BY_ROW)) ;
+    GRB_TRY (GrB_transpose (BW, NULL, NULL, FW, NULL));     // BW = FW'
+
+    LG_TRY (LAGraph_Malloc ((void **) &I, n, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &F, n, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &B, n, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &M, n, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Din, n, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Dout, n, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Pin, n, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Pout, n, sizeof (GrB_Index), msg)) ;
+
+    int nthreads_outer, nthreads_inner ;
+    LG_TRY (LAGraph_GetNumThreads (&nthreads_outer, &nthreads_inner, msg)) ;
+    int nthreads = nthreads_outer * nthreads_inner ;
+    int64_t i ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (i = 0; i < n; i++)
+    {
+        I [i] = i ;
+        M [i] = n ;
+    }
 
     // scc: the SCC identifier for each vertex
     // scc[u] == n: not assigned yet
     GRB_TRY (GrB_Vector_new (&scc, GrB_UINT64, n));
     // vector of indices: ind[i] == i
     GRB_TRY (GrB_Vector_new (&ind, GrB_UINT64, n));
-    GRB_TRY (GrB_Vector_build (ind, I, V, n, GrB_PLUS_UINT64));
+    GRB_TRY (GrB_Vector_build (ind, I, I, n, GrB_PLUS_UINT64));
     // vector of infinite value: inf[i] == n
     GRB_TRY (GrB_Vector_new (&inf, GrB_UINT64, n));
     GRB_TRY (GrB_assign (inf, 0, 0, n, GrB_ALL, 0, 0));
     // other vectors
     GRB_TRY (GrB_Vector_new (&f, GrB_UINT64, n));
     GRB_TRY (GrB_Vector_new (&b, GrB_UINT64, n));
+    GRB_TRY (GrB_Vector_new (&w, GrB_INT64, n));
     GRB_TRY (GrB_Vector_new (&mask, GrB_UINT64, n));
-    // GxB_SelectOp
-    GRB_TRY (GxB_SelectOp_new (&sel1, trim_one, GrB_BOOL, GrB_NULL));
-    GRB_TRY (GxB_SelectOp_new (&sel2, edge_removal, GrB_BOOL, GrB_NULL));
-
-    // remove trivial SCCs
-    GRB_TRY (GrB_reduce (f, 0, GrB_PLUS_UINT64, GrB_PLUS_UINT64, FW, 0));
-    GRB_TRY (GrB_reduce (b, 0, GrB_PLUS_UINT64, GrB_PLUS_UINT64, BW, 0));
-    GRB_TRY (GrB_eWiseMult (mask, 0, GxB_LAND_UINT64, GxB_LAND_UINT64, f, b, 0));
-    GRB_TRY (GrB_Vector_nvals (&nvals, mask));
-
-    GRB_TRY (GrB_assign (scc, 0, 0, ind, GrB_ALL, 0, 0));
-    GRB_TRY (GrB_assign (scc, mask, 0, n, GrB_ALL, 0, 0));
-    GRB_TRY (GrB_Vector_clear (mask));
-
-    if (nvals < n)
+    // the select operator, with a pointer to the thunk struct as its y input
+    GRB_TRY (GrB_IndexUnaryOp_new (&sel, edge_removal, GrB_BOOL,
+        /* aij: ignored */ GrB_BOOL, /* y: pointer to thunk */ GrB_UINT64)) ;
+    scc_thunk thunk = { .F = NULL, .B = NULL, .M = M, .n = n } ;
+    uint64_t thunk_ptr = (uint64_t) (&thunk) ;
+
+    //--------------------------------------------------------------------------
+    // phase 1: trim-1 and trim-2
+    //--------------------------------------------------------------------------
+
+    GrB_Index nleft = n ;
+    while (nleft > 0)
     {
-        GRB_TRY (GrB_Vector_extractTuples (I, M, &n, scc));
-        GRB_TRY (GxB_select (FW, 0, 0, sel1, FW, GrB_NULL, 0));
-        GRB_TRY (GxB_select (BW, 0, 0, sel1, BW, GrB_NULL, 0));
+        LG_TRY (degrees (Din, Dout, Pin, Pout, f, w, FW, BW, n, msg)) ;
+        int64_t ntrim = 0 ;
+
+        // trim-1: vertex i is a trivial SCC if it has no in/out-neighbors
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+            reduction(+:ntrim)
+        for (i = 0 ; i < n ; i++)
+        {
+            if (M [i] == n && (Din [i] == 0 || Dout [i] == 0))
+            {
+                M [i] = i ;
+                ntrim++ ;
+            }
+        }
+
+        // trim-2: vertices i and j form an SCC if j is the only in-neighbor
+        // of i and i is the only in-neighbor of j (or likewise for the
+        // out-neighbors).  Such vertices have in- and out-degree at least
+        // one, so none of them were trimmed by trim-1 above.  Each iteration
+        // only modifies M [i].
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+            reduction(+:ntrim)
+        for (i = 0 ; i < n ; i++)
+        {
+            if (M [i] != n) continue ;
+            GrB_Index j = Pin [i] ;
+            if (Din [i] == 1 && Din [j] == 1 && Pin [j] == i)
+            {
+                M [i] = LAGRAPH_MIN (i, j) ;
+                ntrim++ ;
+                continue ;
+            }
+            j = Pout [i] ;
+            if (Dout [i] == 1 && Dout [j] == 1 && Pout [j] == i)
+            {
+                M [i] = LAGRAPH_MIN (i, j) ;
+                ntrim++ ;
+            }
+        }
+
+        if (ntrim == 0) break ;
+        nleft -= ntrim ;
+
+        // remove the edges incident on the trimmed vertices
+        GRB_TRY (GrB_select (FW, NULL, NULL, sel, FW, thunk_ptr, NULL)) ;
+        GRB_TRY (GrB_select (BW, NULL, NULL, sel, BW, thunk_ptr, NULL)) ;
+
+        // stop if this pass trimmed less than 1% of the remaining vertices;
+        // the coloring phase will find the rest
+        if (ntrim < (nleft + ntrim) / 100) break ;
     }
 
     GRB_TRY (GrB_Matrix_nvals (&nvals, FW));
+
+    //--------------------------------------------------------------------------
+    // phase 2: forward-backward search from a pivot vertex
+    //--------------------------------------------------------------------------
+
+    if (nvals > 0)
+    {
+        // select the pivot with the largest product of in- and out-degree.
+        // Din and Dout are from the last trimming pass, which is fine for
+        // this heuristic.
+        GrB_Index pivot = n, dmax = 0 ;
+        for (GrB_Index k = 0 ; k < n ; k++)
+        {
+            GrB_Index d = Din [k] * Dout [k] ;
+            if (M [k] == n && d > dmax)
+            {
+                dmax = d ;
+                pivot = k ;
+            }
+        }
+
+        if (pivot < n)
+        {
+            // f(i) = pivot if i is reachable from the pivot, n otherwise
+            GRB_TRY (GrB_assign (f, 0, 0, inf, GrB_ALL, 0, 0));
+            GRB_TRY (GrB_Vector_setElement (f, pivot, pivot)) ;
+            GRB_TRY (GrB_Vector_clear (mask)) ;
+            GRB_TRY (GrB_Vector_setElement (mask, 1, pivot)) ;
+            LG_TRY (propagate (f, mask, FW, BW, n, msg));
+
+            // b(i) = pivot if i can reach the pivot, n otherwise
+            GRB_TRY (GrB_assign (b, 0, 0, inf, GrB_ALL, 0, 0));
+            GRB_TRY (GrB_Vector_setElement (b, pivot, pivot)) ;
+            GRB_TRY (GrB_Vector_clear (mask)) ;
+            GRB_TRY (GrB_Vector_setElement (mask, 1, pivot)) ;
+            LG_TRY (propagate (b, mask, BW, FW, n, msg));
+
+            GRB_TRY (GrB_Vector_extractTuples (I, F, &n, f));
+            GRB_TRY (GrB_Vector_extractTuples (I, B, &n, b));
+
+            // the SCC of the pivot is the intersection of the two sets, and
+            // is labeled with its smallest vertex
+            int64_t root = pivot ;
+            #pragma omp parallel for num_threads(nthreads) schedule(static) \
+                reduction(min:root)
+            for (i = 0 ; i < n ; i++)
+            {
+                if (F [i] == pivot && B [i] == pivot)
+                {
+                    root = LAGRAPH_MIN (root, i) ;
+                }
+            }
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (i = 0 ; i < n ; i++)
+            {
+                if (F [i] == pivot && B [i] == pivot) M [i] = root ;
+            }
+
+            // remove the edges of the pivot SCC, and the edges between the
+            // vertex sets of the forward/backward partition
+            thunk.F = F ;
+            thunk.B = B ;
+            GRB_TRY (GrB_select (FW, NULL, NULL, sel, FW, thunk_ptr, NULL)) ;
+            GRB_TRY (GrB_select (BW, NULL, NULL, sel, BW, thunk_ptr, NULL)) ;
+            GRB_TRY (GrB_Matrix_nvals (&nvals, FW));
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // phase 3: coloring
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_Vector_build (scc, I, M, n, GrB_PLUS_UINT64));
+    GRB_TRY (GrB_Vector_clear (mask));
+
+    thunk.F = F ;
+    thunk.B = B ;
     while (nvals > 0)
     {
         GRB_TRY (GrB_eWiseMult (mask, 0, 0, GxB_ISEQ_UINT64, scc, inf, 0));
@@ -199,38 +446,20 @@ int LAGraph_scc
 
         GRB_TRY (GrB_Vector_extractTuples (I, F, &n, f));
         GRB_TRY (GrB_Vector_extractTuples (I, B, &n, b));
-        GRB_TRY (GrB_Vector_extractTuples (I, M, &n, mask));
+        GRB_TRY (GrB_Vector_extractTuples (I, M, &n, scc));
 
-        GRB_TRY (GxB_select (FW, 0, 0, sel2, FW, GrB_NULL, 0));
-        GRB_TRY (GxB_select (BW, 0, 0, sel2, BW, GrB_NULL, 0));
+        GRB_TRY (GrB_select (FW, NULL, NULL, sel, FW, thunk_ptr, NULL)) ;
+        GRB_TRY (GrB_select (BW, NULL, NULL, sel, BW, thunk_ptr, NULL)) ;
 
         GRB_TRY (GrB_Matrix_nvals (&nvals, FW));
     }
+
+    // any vertex not yet assigned is an SCC by itself
     GRB_TRY (GrB_eWiseMult (mask, 0, 0, GxB_ISEQ_UINT64, scc, inf, 0));
     GRB_TRY (GrB_assign (scc, mask, 0, ind, GrB_ALL, 0, 0));
 
-    GRB_TRY (GrB_eWiseMult (mask, 0, 0, GxB_ISEQ_UINT64, scc, ind, 0));
-    GRB_TRY (GrB_reduce (&nvals, 0, GrB_PLUS_MONOID_UINT64, mask, 0));
-
-    *result = scc;
-    scc = NULL;
-
-    free (I);
-    free (V);
-    free (F);
-    free (B);
-    free (M);
-    GrB_free (&ind);
-    GrB_free (&inf);
-    GrB_free (&f);
-    GrB_free (&b);
-    GrB_free (&mask);
-    GrB_free (&FW);
-    GrB_free (&BW);
-    GrB_free (&sel1);
-    GrB_free (&sel2);
-    GrB_free (&scc);
-
-    return GrB_SUCCESS;
+    (*result) = scc ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
 #endif
 }
@@ -0,0 +1,88 @@
+//------------------------------------------------------------------------------
+// LG_check_coloring: test if a vertex coloring is valid
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2021 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+// See additional acknowledgments in the LICENSE file,
+// or contact permission@sei.cmu.edu for the full terms.
+
+//------------------------------------------------------------------------------
+
+// Checks that every node has a color in the range 1 to ncolors, that the
+// color ncolors is used, and that no two adjacent nodes have the same color.
+// This is a simple serial method, for testing only.
+
+#define LG_FREE_WORK                            \
+{                                               \
+    LAGraph_Free ((void **) &Ci, NULL) ;        \
+    LAGraph_Free ((void **) &Cx, NULL) ;        \
+    LAGraph_Free ((void **) &c, NULL) ;         \
+    LAGraph_Free ((void **) &Ai, NULL) ;        \
+    LAGraph_Free ((void **) &Aj, NULL) ;        \
+}
+
+#define LG_FREE_ALL                             \
+{                                               \
+    LG_FREE_WORK ;                              \
+}
+
+#include "LG_internal.h"
+#include "LG_test.h"
+
+int LG_check_coloring
+(
+    // input
+    GrB_Vector color,           // color(i) is the color of node i
+    int64_t ncolors,            // # of colors used
+    GrB_Matrix A,               // symmetric adjacency matrix
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // get the colors
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Index *Ci = NULL, *Ai = NULL, *Aj = NULL ;
+    int64_t *Cx = NULL, *c = NULL ;
+
+    GrB_Index n, nvals ;
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+    GRB_TRY (GrB_Vector_nvals (&nvals, color)) ;
+    LG_ASSERT_MSG (nvals == n, -1000, "every node must be colored") ;
+
+    LG_TRY (LAGraph_Malloc ((void **) &Ci, n, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Cx, n, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Calloc ((void **) &c, n, sizeof (int64_t), msg)) ;
+    GRB_TRY (GrB_Vector_extractTuples_INT64 (Ci, Cx, &nvals, color)) ;
+
+    bool used = (n == 0) ;
+    for (int64_t k = 0 ; k < nvals ; k++)
+    {
+        int64_t ck = Cx [k] ;
+        LG_ASSERT_MSG (ck >= 1 && ck <= ncolors, -1001, "color out of range") ;
+        c [Ci [k]] = ck ;
+        used = used || (ck == ncolors) ;
+    }
+    LG_ASSERT_MSG (used, -1002, "ncolors is wrong") ;
+
+    //--------------------------------------------------------------------------
+    // check each edge
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_Matrix_nvals (&nvals, A)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Ai, nvals, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Aj, nvals, sizeof (GrB_Index), msg)) ;
+    GRB_TRY (GrB_Matrix_extractTuples_BOOL (Ai, Aj, NULL, &nvals, A)) ;
+
+    for (int64_t k = 0 ; k < nvals ; k++)
+    {
+        LG_ASSERT_MSG (Ai [k] == Aj [k] || c [Ai [k]] != c [Aj [k]], -1003,
+            "adjacent nodes have the same color") ;
+    }
+
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
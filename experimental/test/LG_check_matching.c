@@ -0,0 +1,166 @@
+//------------------------------------------------------------------------------
+// LG_check_matching: test if a matching is valid and maximal
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2021 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+// See additional acknowledgments in the LICENSE file,
+// or contact permission@sei.cmu.edu for the full terms.
+
+//------------------------------------------------------------------------------
+
+// Checks that mate is a valid matching of A (each matched edge (i,j) is an
+// edge of A, with mate(i)=j and mate(j)=i), and that it is maximal:  every
+// edge of A (other than self edges) has at least one matched node.  If
+// weighted is true, only edges with a weight > 0 are considered, and the
+// matching must be identical to the serial greedy matching, which takes the
+// edges in decreasing order of weight, with ties broken by (min(i,j),
+// max(i,j)) in decreasing order.  This is a simple serial method, for testing
+// only.
+
+#define LG_FREE_WORK                            \
+{                                               \
+    LAGraph_Free ((void **) &Mi, NULL) ;        \
+    LAGraph_Free ((void **) &Mx, NULL) ;        \
+    LAGraph_Free ((void **) &M, NULL) ;         \
+    LAGraph_Free ((void **) &Greedy, NULL) ;    \
+    LAGraph_Free ((void **) &Ai, NULL) ;        \
+    LAGraph_Free ((void **) &Aj, NULL) ;        \
+    LAGraph_Free ((void **) &Ax, NULL) ;        \
+    LAGraph_Free ((void **) &E, NULL) ;         \
+}
+
+#define LG_FREE_ALL                             \
+{                                               \
+    LG_FREE_WORK ;                              \
+}
+
+#include "LG_internal.h"
+#include "LG_test.h"
+
+typedef struct
+{
+    double w ;
+    GrB_Index i, j ;    // i < j
+}
+check_edge ;
+
+// sort edges in decreasing order of (w, i, j)
+static int check_edge_compare (const void *x, const void *y)
+{
+    const check_edge *a = (const check_edge *) x ;
+    const check_edge *b = (const check_edge *) y ;
+    if (a->w != b->w) return ((a->w > b->w) ? -1 : 1) ;
+    if (a->i != b->i) return ((a->i > b->i) ? -1 : 1) ;
+    if (a->j != b->j) return ((a->j > b->j) ? -1 : 1) ;
+    return (0) ;
+}
+
+int LG_check_matching
+(
+    // input
+    GrB_Vector mate,            // mate(i) = j if (i,j) is in the matching
+    GrB_Index nmatched,         // # of edges in the matching
+    GrB_Matrix A,               // symmetric adjacency matrix
+    bool weighted,              // if true, compare with the greedy matching
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // get the matching
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Index *Mi = NULL, *Ai = NULL, *Aj = NULL ;
+    int64_t *Mx = NULL, *M = NULL, *Greedy = NULL ;
+    double *Ax = NULL ;
+    check_edge *E = NULL ;
+
+    GrB_Index n, nm, nvals ;
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+    GRB_TRY (GrB_Vector_nvals (&nm, mate)) ;
+    LG_ASSERT_MSG (nm == 2 * nmatched, -1000, "nmatched is wrong") ;
+
+    LG_TRY (LAGraph_Malloc ((void **) &Mi, nm, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Mx, nm, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &M, n, sizeof (int64_t), msg)) ;
+    GRB_TRY (GrB_Vector_extractTuples_INT64 (Mi, Mx, &nm, mate)) ;
+    for (int64_t i = 0 ; i < n ; i++)
+    {
+        M [i] = -1 ;
+    }
+    for (int64_t k = 0 ; k < nm ; k++)
+    {
+        LG_ASSERT_MSG (Mx [k] >= 0 && Mx [k] < n && Mx [k] != Mi [k], -1001,
+            "mate out of range") ;
+        M [Mi [k]] = Mx [k] ;
+    }
+    for (int64_t i = 0 ; i < n ; i++)
+    {
+        LG_ASSERT_MSG (M [i] < 0 || M [M [i]] == i, -1002,
+            "mate is not symmetric") ;
+    }
+
+    //--------------------------------------------------------------------------
+    // check each edge
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_Matrix_nvals (&nvals, A)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Ai, nvals, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Aj, nvals, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Ax, nvals, sizeof (double), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &E, nvals, sizeof (check_edge), msg)) ;
+    GRB_TRY (GrB_Matrix_extractTuples_FP64 (Ai, Aj, Ax, &nvals, A)) ;
+
+    int64_t nfound = 0, ne = 0 ;
+    for (int64_t k = 0 ; k < nvals ; k++)
+    {
+        GrB_Index i = Ai [k], j = Aj [k] ;
+        if (i == j || (weighted && !(Ax [k] > 0))) continue ;
+        // each edge must have a matched node
+        LG_ASSERT_MSG (M [i] >= 0 || M [j] >= 0, -1003,
+            "matching is not maximal") ;
+        if (M [i] == j) nfound++ ;
+        if (i < j)
+        {
+            E [ne].w = weighted ? Ax [k] : 0 ;
+            E [ne].i = i ;
+            E [ne].j = j ;
+            ne++ ;
+        }
+    }
+    // each matched edge must be an edge of A
+    LG_ASSERT_MSG (nfound == nm, -1004, "matched edge not in A") ;
+
+    //--------------------------------------------------------------------------
+    // compare with the greedy matching
+    //--------------------------------------------------------------------------
+
+    if (weighted)
+    {
+        LG_TRY (LAGraph_Malloc ((void **) &Greedy, n, sizeof (int64_t), msg)) ;
+        for (int64_t i = 0 ; i < n ; i++)
+        {
+            Greedy [i] = -1 ;
+        }
+        qsort (E, ne, sizeof (check_edge), check_edge_compare) ;
+        for (int64_t k = 0 ; k < ne ; k++)
+        {
+            GrB_Index i = E [k].i, j = E [k].j ;
+            if (Greedy [i] < 0 && Greedy [j] < 0)
+            {
+                Greedy [i] = j ;
+                Greedy [j] = i ;
+            }
+        }
+        for (int64_t i = 0 ; i < n ; i++)
+        {
+            LG_ASSERT_MSG (Greedy [i] == M [i], -1005,
+                "matching differs from the greedy matching") ;
+        }
+    }
+
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,131 @@
+//------------------------------------------------------------------------------
+// LG_check_msf: stand-alone test for minimum spanning forest
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2021 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+// See additional acknowledgments in the LICENSE file,
+// or contact permission@sei.cmu.edu for the full terms.
+
+//------------------------------------------------------------------------------
+
+// Computes the total weight and number of edges of a minimum spanning forest
+// of a symmetric matrix A with Kruskal's algorithm, using a simple sort and a
+// union-find with path halving.  The weights are converted to double.  The
+// result can be compared with the forest computed by LAGraph_msf: the forest
+// itself need not be unique, but its total weight and number of edges are.
+
+#define LG_FREE_WORK                                \
+{                                                   \
+    LAGraph_Free ((void **) &I, NULL) ;             \
+    LAGraph_Free ((void **) &J, NULL) ;             \
+    LAGraph_Free ((void **) &X, NULL) ;             \
+    LAGraph_Free ((void **) &P, NULL) ;             \
+    LAGraph_Free ((void **) &E, NULL) ;             \
+}
+
+#define LG_FREE_ALL                                 \
+{                                                   \
+    LG_FREE_WORK ;                                  \
+}
+
+#include "LG_internal.h"
+#include "LG_test.h"
+#include "LG_Xtest.h"
+
+typedef struct
+{
+    double x ;
+    GrB_Index i, j ;
+}
+LG_msf_edge ;
+
+static int LG_msf_edge_compare (const void *a, const void *b)
+{
+    double x = ((const LG_msf_edge *) a)->x ;
+    double y = ((const LG_msf_edge *) b)->x ;
+    return ((x < y) ? -1 : ((x > y) ? 1 : 0)) ;
+}
+
+static GrB_Index LG_msf_find (GrB_Index *P, GrB_Index i)
+{
+    while (P [i] != i)
+    {
+        P [i] = P [P [i]] ;
+        i = P [i] ;
+    }
+    return (i) ;
+}
+
+int LG_check_msf
+(
+    // output
+    double *forest_weight,      // total weight of the forest
+    GrB_Index *forest_edges,    // # of edges in the forest
+    // input
+    GrB_Matrix A,               // symmetric matrix of edge weights
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs and extract the edges of A
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Index *I = NULL, *J = NULL, *P = NULL ;
+    double *X = NULL ;
+    LG_msf_edge *E = NULL ;
+    LG_ASSERT (forest_weight != NULL && forest_edges != NULL && A != NULL,
+        GrB_NULL_POINTER) ;
+    GrB_Index n, nvals ;
+    GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
+    GRB_TRY (GrB_Matrix_nvals (&nvals, A)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &I, nvals, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &J, nvals, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &X, nvals, sizeof (double), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &P, n, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &E, nvals, sizeof (LG_msf_edge), msg)) ;
+    GRB_TRY (GrB_Matrix_extractTuples_FP64 (I, J, X, &nvals, A)) ;
+
+    // keep just the upper triangular part
+    GrB_Index nedges = 0 ;
+    for (GrB_Index k = 0 ; k < nvals ; k++)
+    {
+        if (I [k] < J [k])
+        {
+            E [nedges].x = X [k] ;
+            E [nedges].i = I [k] ;
+            E [nedges].j = J [k] ;
+            nedges++ ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // Kruskal's algorithm
+    //--------------------------------------------------------------------------
+
+    qsort (E, nedges, sizeof (LG_msf_edge), LG_msf_edge_compare) ;
+    for (GrB_Index k = 0 ; k < n ; k++)
+    {
+        P [k] = k ;
+    }
+    double w = 0 ;
+    GrB_Index nforest = 0 ;
+    for (GrB_Index k = 0 ; k < nedges ; k++)
+    {
+        GrB_Index ri = LG_msf_find (P, E [k].i) ;
+        GrB_Index rj = LG_msf_find (P, E [k].j) ;
+        if (ri != rj)
+        {
+            P [LAGRAPH_MAX (ri, rj)] = LAGRAPH_MIN (ri, rj) ;
+            w += E [k].x ;
+            nforest++ ;
+        }
+    }
+
+    (*forest_weight) = w ;
+    (*forest_edges) = nforest ;
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,163 @@
+//------------------------------------------------------------------------------
+// LG_check_scc: stand-alone test for strongly connected components
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2021 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+// See additional acknowledgments in the LICENSE file,
+// or contact permission@sei.cmu.edu for the full terms.
+
+//------------------------------------------------------------------------------
+
+// The SCCs of G are computed with Tarjan's algorithm (with an explicit stack
+// in place of recursion), and each SCC is labeled with its smallest vertex.
+// The result must match the vector computed by LAGraph_scc.
+
+#define LG_FREE_WORK                                \
+{                                                   \
+    LAGraph_Free ((void **) &Ap, NULL) ;            \
+    LAGraph_Free ((void **) &Aj, NULL) ;            \
+    LAGraph_Free ((void **) &Ax, NULL) ;            \
+    LAGraph_Free ((void **) &index, NULL) ;         \
+    LAGraph_Free ((void **) &low, NULL) ;           \
+    LAGraph_Free ((void **) &next, NULL) ;          \
+    LAGraph_Free ((void **) &calls, NULL) ;         \
+    LAGraph_Free ((void **) &stack, NULL) ;         \
+    LAGraph_Free ((void **) &onstack, NULL) ;       \
+    LAGraph_Free ((void **) &label, NULL) ;         \
+}
+
+#define LG_FREE_ALL                                 \
+{                                                   \
+    LG_FREE_WORK ;                                  \
+}
+
+#include "LG_internal.h"
+#include "LG_test.h"
+#include "LG_Xtest.h"
+
+int LG_check_scc
+(
+    // input
+    GrB_Vector scc,         // scc(i) = smallest vertex in the SCC of i
+    LAGraph_Graph G,
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Index *Ap = NULL, *Aj = NULL, *next = NULL, *label = NULL ;
+    void *Ax = NULL ;
+    int64_t *index = NULL, *low = NULL, *calls = NULL, *stack = NULL ;
+    bool *onstack = NULL ;
+    GrB_Index Ap_len, Aj_len, Ax_len, n, nvals ;
+    size_t typesize ;
+    LG_TRY (LAGraph_CheckGraph (G, msg)) ;
+    LG_ASSERT (scc != NULL, GrB_NULL_POINTER) ;
+    GRB_TRY (GrB_Matrix_nrows (&n, G->A)) ;
+    GRB_TRY (GrB_Vector_nvals (&nvals, scc)) ;
+    LG_ASSERT_MSG (nvals == n, -1001, "scc must be full") ;
+
+    //--------------------------------------------------------------------------
+    // export G->A and allocate workspace
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LG_check_export (G, &Ap, &Aj, &Ax, &Ap_len, &Aj_len, &Ax_len,
+        &typesize, msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &index, n, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &low, n, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &next, n, sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &calls, n, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &stack, n, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Calloc ((void **) &onstack, n, sizeof (bool), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &label, n, sizeof (GrB_Index), msg)) ;
+    for (int64_t i = 0 ; i < n ; i++)
+    {
+        index [i] = -1 ;
+    }
+
+    //--------------------------------------------------------------------------
+    // Tarjan's algorithm
+    //--------------------------------------------------------------------------
+
+    int64_t count = 0, ncalls = 0, nstack = 0 ;
+    for (int64_t s = 0 ; s < n ; s++)
+    {
+        if (index [s] >= 0) continue ;
+
+        // visit s
+        index [s] = low [s] = count++ ;
+        stack [nstack++] = s ;
+        onstack [s] = true ;
+        next [s] = Ap [s] ;
+        calls [ncalls++] = s ;
+
+        while (ncalls > 0)
+        {
+            int64_t v = calls [ncalls-1] ;
+            if (next [v] < Ap [v+1])
+            {
+                // examine the next edge v->w
+                int64_t w = Aj [next [v]++] ;
+                if (index [w] < 0)
+                {
+                    // visit w
+                    index [w] = low [w] = count++ ;
+                    stack [nstack++] = w ;
+                    onstack [w] = true ;
+                    next [w] = Ap [w] ;
+                    calls [ncalls++] = w ;
+                }
+                else if (onstack [w])
+                {
+                    low [v] = LAGRAPH_MIN (low [v], index [w]) ;
+                }
+            }
+            else
+            {
+                // all edges of v have been examined; return to the caller
+                ncalls-- ;
+                if (ncalls > 0)
+                {
+                    int64_t u = calls [ncalls-1] ;
+                    low [u] = LAGRAPH_MIN (low [u], low [v]) ;
+                }
+                if (low [v] == index [v])
+                {
+                    // v is the root of an SCC, held in stack [k..nstack-1]
+                    int64_t k = nstack - 1 ;
+                    while (stack [k] != v) k-- ;
+                    int64_t smallest = v ;
+                    for (int64_t p = k ; p < nstack ; p++)
+                    {
+                        smallest = LAGRAPH_MIN (smallest, stack [p]) ;
+                    }
+                    for (int64_t p = k ; p < nstack ; p++)
+                    {
+                        label [stack [p]] = smallest ;
+                        onstack [stack [p]] = false ;
+                    }
+                    nstack = k ;
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // compare with the scc vector
+    //--------------------------------------------------------------------------
+
+    for (int64_t i = 0 ; i < n ; i++)
+    {
+        GrB_Index c = n ;
+        GRB_TRY (GrB_Vector_extractElement (&c, scc, i)) ;
+        LG_ASSERT_MSG (c == label [i], -1002, "invalid scc") ;
+    }
+
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
@@ -58,4 +58,41 @@ int LG_check_kcore_decompose
     char *msg
 ) ;
 
+int LG_check_scc
+(
+    // input
+    GrB_Vector scc,         // scc(i) = smallest vertex in the SCC of i
+    LAGraph_Graph G,
+    char *msg
+) ;
+
+int LG_check_msf
+(
+    // output
+    double *forest_weight,      // total weight of the forest
+    GrB_Index *forest_edges,    // # of edges in the forest
+    // input
+    GrB_Matrix A,               // symmetric matrix of edge weights
+    char *msg
+) ;
+
+int LG_check_coloring
+(
+    // input
+    GrB_Vector color,           // color(i) is the color of node i
+    int64_t ncolors,            // # of colors used
+    GrB_Matrix A,               // symmetric adjacency matrix
+    char *msg
+) ;
+
+int LG_check_matching
+(
+    // input
+    GrB_Vector mate,            // mate(i) = j if (i,j) is in the matching
+    GrB_Index nmatched,         // # of edges in the matching
+    GrB_Matrix A,               // symmetric adjacency matrix
+    bool weighted,              // if true, compare with the greedy matching
+    char *msg
+) ;
+
 #endif
@@ -101,18 +101,35 @@ void test_AllKCore (void)
         uint64_t km1;
         uint64_t km2;
         bool ok;
-        //test the k-core
-        OK(LAGraph_KCore_All(&c1, &km1, G, msg)) ;
-        // printf ("kmax: %lu km1 %lu\n",  kmax, km1) ;
-        TEST_CHECK(kmax == km1) ;
-
         OK(LG_check_kcore(&c2, &km2, G, check_kmax, msg)) ;
         // printf ("kmax: %lu km1 %lu\n",  kmax, km2) ;
-        
         TEST_CHECK(kmax == km2) ;
-        TEST_CHECK(km1 == km2) ;
-        OK (LAGraph_Vector_IsEqual (&ok, c1, c2, msg)) ;
-        TEST_CHECK (ok) ;
+
+        //test the k-core, with each method
+        for (int m = 0 ; m <= LAGraph_KCore_Bucket ; m++)
+        {
+            LAGraph_KCore_Method method = m ;
+            int result = LAGraph_KCore_All_ByMethod(&c1, &km1, G, &method, msg) ;
+            #if !LAGRAPH_SUITESPARSE
+            if (m == LAGraph_KCore_Bucket)
+            {
+                TEST_CHECK (result == GrB_NOT_IMPLEMENTED) ;
+                continue ;
+            }
+            #endif
+            OK (result) ;
+            TEST_CHECK (method != LAGraph_KCore_AutoMethod) ;
+            // printf ("kmax: %lu km1 %lu\n",  kmax, km1) ;
+            TEST_CHECK(kmax == km1) ;
+            TEST_CHECK(km1 == km2) ;
+            OK (LAGraph_Vector_IsEqual (&ok, c1, c2, msg)) ;
+            TEST_CHECK (ok) ;
+            OK (GrB_free (&c1)) ;
+        }
+        OK (GrB_free (&c2)) ;
+
+        // the pattern of G->A is unchanged
+        OK (LAGraph_CheckGraph (G, msg)) ;
 
         OK (LAGraph_Delete (&G, msg)) ;
     }
@@ -170,6 +187,14 @@ void test_errors (void)
     TEST_CHECK (result == -1005) ;
     TEST_CHECK (c == NULL) ;
 
+    // invalid method
+    G->kind = LAGraph_ADJACENCY_UNDIRECTED ;
+    LAGraph_KCore_Method method = 42 ;
+    result = LAGraph_KCore_All_ByMethod (&c, &kmax, G, &method, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    TEST_CHECK (c == NULL) ;
+
     OK (LAGraph_Delete (&G, msg)) ;
     LAGraph_Finalize (msg) ;
 }
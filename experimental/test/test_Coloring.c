@@ -0,0 +1,214 @@
+//------------------------------------------------------------------------------
+// LAGraph/experimental/test/test_Coloring
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2021 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+// See additional acknowledgments in the LICENSE file,
+// or contact permission@sei.cmu.edu for the full terms.
+
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+#include <LG_Xtest.h>
+
+//------------------------------------------------------------------------------
+// test cases
+//------------------------------------------------------------------------------
+
+const char *files [ ] =
+{
+    "A.mtx",
+    "jagmesh7.mtx",
+    "bcsstk13.mtx",
+    "karate.mtx",
+    "ldbc-cdlp-undirected-example.mtx",
+    "ldbc-cdlp-directed-example.mtx",
+    "ldbc-undirected-example-bool.mtx",
+    "ldbc-undirected-example-unweighted.mtx",
+    "ldbc-undirected-example.mtx",
+    "ldbc-wcc-example.mtx",
+    "LFAT5.mtx",
+    "LFAT5_two.mtx",
+    "cryg2500.mtx",
+    "msf2.mtx",
+    "olm1000.mtx",
+    "west0067.mtx",
+    ""
+} ;
+
+#define LEN 512
+char filename [LEN+1] ;
+
+char msg [LAGRAPH_MSG_LEN] ;
+GrB_Vector color = NULL ;
+GrB_Matrix A = NULL, C = NULL ;
+LAGraph_Graph G = NULL ;
+
+//------------------------------------------------------------------------------
+// setup: start a test
+//------------------------------------------------------------------------------
+
+void setup (void)
+{
+    OK (LAGraph_Init (msg)) ;
+    OK (LAGraph_Random_Init (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// teardown: finalize a test
+//------------------------------------------------------------------------------
+
+void teardown (void)
+{
+    OK (LAGraph_Random_Finalize (msg)) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_Coloring: test the vertex coloring
+//------------------------------------------------------------------------------
+
+void test_Coloring (void)
+{
+    setup ( ) ;
+
+    for (int k = 0 ; ; k++)
+    {
+
+        // load the matrix as A
+        const char *aname = files [k] ;
+        if (strlen (aname) == 0) break;
+        TEST_CASE (aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+        TEST_MSG ("Loading of valued matrix failed") ;
+        printf ("\nMatrix: %s\n", aname) ;
+
+        // C = structure of A
+        OK (LAGraph_Matrix_Structure (&C, A, msg)) ;
+        OK (GrB_free (&A)) ;
+
+        // construct a directed graph G with adjacency matrix C
+        OK (LAGraph_New (&G, &C, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+        TEST_CHECK (C == NULL) ;
+
+        // make the adjacency matrix symmetric
+        OK (LAGraph_Cached_IsSymmetricStructure (G, msg)) ;
+        if (G->is_symmetric_structure == LAGraph_FALSE)
+        {
+            OK (LAGraph_Cached_AT (G, msg)) ;
+            OK (GrB_eWiseAdd (G->A, NULL, NULL, GrB_LOR, G->A, G->AT, NULL)) ;
+            OK (LAGraph_DeleteCached (G, msg)) ;
+        }
+        G->kind = LAGraph_ADJACENCY_UNDIRECTED ;
+
+        // remove self-edges
+        OK (LAGraph_Cached_NSelfEdges (G, msg)) ;
+        if (G->nself_edges != 0)
+        {
+            OK (LAGraph_DeleteSelfEdges (G, msg)) ;
+            TEST_CHECK (G->nself_edges == 0) ;
+        }
+
+        // compute the row degree
+        OK (LAGraph_Cached_OutDegree (G, msg)) ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, G->A)) ;
+
+        for (int method = 0 ; method <= 1 ; method++)
+        {
+            for (int minimize = 0 ; minimize <= 1 ; minimize++)
+            {
+                for (int64_t seed = 0 ; seed <= 4*n ; seed += n)
+                {
+                    int64_t ncolors ;
+                    OK (LAGraph_Coloring (&color, &ncolors, G,
+                        (LAGraph_Coloring_Method) method, (bool) minimize,
+                        seed, msg)) ;
+                    printf ("method %d minimize %d: %g colors\n", method,
+                        minimize, (double) ncolors) ;
+                    OK (LG_check_coloring (color, ncolors, G->A, msg)) ;
+                    OK (GrB_free (&color)) ;
+                }
+            }
+        }
+
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+    teardown ( ) ;
+}
+
+//------------------------------------------------------------------------------
+// test_Coloring_errors: test error handling
+//------------------------------------------------------------------------------
+
+void test_Coloring_errors (void)
+{
+    setup ( ) ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "karate.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+    TEST_CHECK (A == NULL) ;
+    int64_t ncolors ;
+
+    // G->A is not known to be symmetric
+    int result = LAGraph_Coloring (&color, &ncolors, G,
+        LAGraph_Coloring_JonesPlassmann, false, 0, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == -105) ;
+    TEST_CHECK (color == NULL) ;
+
+    // G->out_degree is missing
+    G->kind = LAGraph_ADJACENCY_UNDIRECTED ;
+    result = LAGraph_Coloring (&color, &ncolors, G,
+        LAGraph_Coloring_JonesPlassmann, false, 0, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == -106) ;
+    TEST_CHECK (color == NULL) ;
+
+    // G->nself_edges is unknown
+    OK (LAGraph_Cached_OutDegree (G, msg)) ;
+    result = LAGraph_Coloring (&color, &ncolors, G,
+        LAGraph_Coloring_JonesPlassmann, false, 0, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == -107) ;
+    TEST_CHECK (color == NULL) ;
+
+    // invalid method
+    result = LAGraph_Coloring (&color, &ncolors, G,
+        (LAGraph_Coloring_Method) 42, false, 0, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    TEST_CHECK (color == NULL) ;
+
+    // color is NULL
+    result = LAGraph_Coloring (NULL, &ncolors, G,
+        LAGraph_Coloring_JonesPlassmann, false, 0, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    teardown ( ) ;
+}
+
+//-----------------------------------------------------------------------------
+// TEST_LIST: the list of tasks for this entire test
+//-----------------------------------------------------------------------------
+
+TEST_LIST =
+{
+    { "Coloring", test_Coloring },
+    { "Coloring_errors", test_Coloring_errors },
+    { NULL, NULL }
+} ;
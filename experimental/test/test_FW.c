@@ -0,0 +1,245 @@
+//------------------------------------------------------------------------------
+// LAGraph/experimental/test/test_FW.c: test cases for Floyd-Warshall
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2021 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+// See additional acknowledgments in the LICENSE file,
+// or contact permission@sei.cmu.edu for the full terms.
+
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+//------------------------------------------------------------------------------
+// globals
+//------------------------------------------------------------------------------
+
+#define LEN 512
+char filename [LEN+1] ;
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+GrB_Matrix A = NULL, D = NULL, T = NULL ;
+GrB_Vector d = NULL ;
+
+//------------------------------------------------------------------------------
+// test cases: the weights are made positive before the test, as LG_check_sssp
+// requires
+//------------------------------------------------------------------------------
+
+const char *files [ ] =
+{
+    "cover.mtx",
+    "matrix_fp32.mtx",
+    "matrix_int32.mtx",
+    "ldbc-directed-example.mtx",
+    "test_FW_1000.mtx",
+    ""
+} ;
+
+//------------------------------------------------------------------------------
+// test_FW: compare each row of D with a single-source shortest path
+//------------------------------------------------------------------------------
+
+void test_FW (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    for (int k = 0 ; ; k++)
+    {
+        const char *aname = files [k] ;
+        if (strlen (aname) == 0) break ;
+        printf ("\n================================== %s:\n", aname) ;
+        TEST_CASE (aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+        TEST_MSG ("Loading of adjacency matrix failed") ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, A)) ;
+
+        char atype_name [LAGRAPH_MAX_NAME_LEN] ;
+        GrB_Type atype, D_type ;
+        OK (LAGraph_Matrix_TypeName (atype_name, A, msg)) ;
+        OK (LAGraph_TypeFromName (&atype, atype_name, msg)) ;
+
+        // ensure all entries are in the range 1 to 255, keeping the type of A
+        OK (GrB_Matrix_new (&T, GrB_INT32, n, n)) ;
+        OK (GrB_assign (T, NULL, NULL, A, GrB_ALL, n, GrB_ALL, n, NULL)) ;
+        OK (GrB_Matrix_apply_BinaryOp2nd_INT32 (T, NULL, NULL,
+            GrB_BAND_INT32, T, 255, NULL)) ;
+        OK (GrB_Matrix_apply_BinaryOp2nd_INT32 (T, NULL, NULL,
+            GrB_MAX_INT32, T, 1, NULL)) ;
+        OK (GrB_assign (A, NULL, NULL, T, GrB_ALL, n, GrB_ALL, n, NULL)) ;
+        OK (GrB_free (&T)) ;
+        OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+
+        for (int nthreads = 1 ; nthreads <= 4 ; nthreads *= 2)
+        {
+            OK (LAGraph_SetNumThreads (1, nthreads, msg)) ;
+            OK (LAGraph_FW (G->A, &D, &D_type)) ;
+            if (atype == GrB_FP32)
+            {
+                TEST_CHECK (D_type == GrB_FP32) ;
+            }
+            else if (atype == GrB_INT32)
+            {
+                TEST_CHECK (D_type == GrB_INT64) ;
+            }
+            else
+            {
+                TEST_CHECK (D_type == GrB_FP64) ;
+            }
+
+            // check the path lengths from a few sources
+            for (GrB_Index src = 0 ; src < n ; src += (n / 4) + 1)
+            {
+                OK (GrB_Vector_new (&d, D_type, n)) ;
+                OK (GrB_Col_extract (d, NULL, NULL, D, GrB_ALL, n, src,
+                    GrB_DESC_T0)) ;
+                OK (LG_check_sssp (d, G, src, msg)) ;
+                OK (GrB_free (&d)) ;
+            }
+            OK (GrB_free (&D)) ;
+        }
+
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_FW_negative: negative edge weights and negative cycles
+//------------------------------------------------------------------------------
+
+void test_FW_negative (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    // a small graph with a negative edge, but no negative cycle
+    GrB_Index I [4] = { 0, 0, 2, 1 } ;
+    GrB_Index J [4] = { 1, 2, 1, 3 } ;
+    int8_t    X [4] = { 4, 1, -2, 3 } ;
+    GrB_Type D_type ;
+    OK (GrB_Matrix_new (&A, GrB_INT8, 5, 5)) ;
+    OK (GrB_Matrix_build (A, I, J, X, 4, GrB_PLUS_INT8)) ;
+    OK (LAGraph_FW (A, &D, &D_type)) ;
+    TEST_CHECK (D_type == GrB_INT64) ;
+
+    int64_t t = 0 ;
+    OK (GrB_Matrix_extractElement (&t, D, 0, 1)) ;
+    TEST_CHECK (t == -1) ;
+    OK (GrB_Matrix_extractElement (&t, D, 0, 3)) ;
+    TEST_CHECK (t == 2) ;
+    OK (GrB_Matrix_extractElement (&t, D, 2, 3)) ;
+    TEST_CHECK (t == 1) ;
+    OK (GrB_Matrix_extractElement (&t, D, 4, 4)) ;
+    TEST_CHECK (t == 0) ;
+    int info = GrB_Matrix_extractElement (&t, D, 1, 0) ;
+    TEST_CHECK (info == GrB_NO_VALUE) ;
+    info = GrB_Matrix_extractElement (&t, D, 4, 0) ;
+    TEST_CHECK (info == GrB_NO_VALUE) ;
+
+    // 11 entries: the diagonal, 0->{1,2,3}, 1->3, and 2->{1,3}
+    GrB_Index nvals ;
+    OK (GrB_Matrix_nvals (&nvals, D)) ;
+    TEST_CHECK (nvals == 11) ;
+    OK (GrB_free (&D)) ;
+    OK (GrB_free (&A)) ;
+
+    // weights of INT32_MAX are kept, and path lengths do not overflow
+    OK (GrB_Matrix_new (&A, GrB_INT32, 3, 3)) ;
+    OK (GrB_Matrix_setElement (A, INT32_MAX, 0, 1)) ;
+    OK (GrB_Matrix_setElement (A, INT32_MAX, 1, 2)) ;
+    OK (LAGraph_FW (A, &D, &D_type)) ;
+    TEST_CHECK (D_type == GrB_INT64) ;
+    OK (GrB_Matrix_extractElement (&t, D, 0, 1)) ;
+    TEST_CHECK (t == INT32_MAX) ;
+    OK (GrB_Matrix_extractElement (&t, D, 0, 2)) ;
+    TEST_CHECK (t == 2 * ((int64_t) INT32_MAX)) ;
+    OK (GrB_free (&D)) ;
+    OK (GrB_free (&A)) ;
+
+    // a negative cycle of INT32_MIN weights saturates, with no overflow
+    OK (GrB_Matrix_new (&A, GrB_INT32, 3, 3)) ;
+    OK (GrB_Matrix_setElement (A, INT32_MIN, 0, 1)) ;
+    OK (GrB_Matrix_setElement (A, INT32_MIN, 1, 0)) ;
+    OK (GrB_Matrix_setElement (A, INT32_MAX, 1, 2)) ;
+    OK (LAGraph_FW (A, &D, &D_type)) ;
+    OK (GrB_Matrix_extractElement (&t, D, 0, 0)) ;
+    TEST_CHECK (t < 0) ;
+    OK (GrB_Matrix_extractElement (&t, D, 1, 1)) ;
+    TEST_CHECK (t < 0) ;
+    info = GrB_Matrix_extractElement (&t, D, 2, 0) ;
+    TEST_CHECK (info == GrB_NO_VALUE) ;
+    OK (GrB_free (&D)) ;
+    OK (GrB_free (&A)) ;
+
+    // west0067 has negative cycles, which appear on the diagonal of D
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "west0067.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_FW (A, &D, &D_type)) ;
+    TEST_CHECK (D_type == GrB_FP64) ;
+    GrB_Index n ;
+    OK (GrB_Matrix_nrows (&n, A)) ;
+    double dmin = 0 ;
+    for (GrB_Index i = 0 ; i < n ; i++)
+    {
+        double dii = 0 ;
+        OK (GrB_Matrix_extractElement (&dii, D, i, i)) ;
+        dmin = LAGRAPH_MIN (dmin, dii) ;
+    }
+    TEST_CHECK (dmin < 0) ;
+    OK (GrB_free (&D)) ;
+    OK (GrB_free (&A)) ;
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_FW_errors
+//------------------------------------------------------------------------------
+
+void test_FW_errors (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    GrB_Type D_type ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, 3, 4)) ;
+
+    int result = LAGraph_FW (NULL, &D, &D_type) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGraph_FW (A, NULL, &D_type) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGraph_FW (A, &D, NULL) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    // A is not square
+    result = LAGraph_FW (A, &D, &D_type) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    TEST_CHECK (D == NULL) ;
+
+    OK (GrB_free (&A)) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// TEST_LIST: the list of tasks for this entire test
+//------------------------------------------------------------------------------
+
+TEST_LIST =
+{
+    {"FW", test_FW},
+    {"FW_negative", test_FW_negative},
+    {"FW_errors", test_FW_errors},
+    {NULL, NULL}
+} ;
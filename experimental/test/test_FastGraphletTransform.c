@@ -143,8 +143,9 @@ void test_FastGraphletTransform(void)
         // check that each element matches fglt result
         for (int i = 0 ; i < n ; i++) {
             for (int j = 0 ; j < 16 ; j++) {
-                int64_t x = 0 ;
-                OK (GrB_Matrix_extractElement (&x, F_net, j, i)) ;
+                int64_t x ;
+                if (GrB_Matrix_extractElement (&x, F_net, j, i) == GrB_NO_VALUE)
+                    x = 0 ;
                 ok &= (x == A_graphlet_counts [16 * i + j]) ;
             }
         }
@@ -161,9 +162,113 @@ void test_FastGraphletTransform(void)
 }
 
 
+//------------------------------------------------------------------------------
+// test_FastGraphletTransform_Range: subsets of orbits and vertex ranges
+//------------------------------------------------------------------------------
+
+void test_FastGraphletTransform_Range (void)
+{
+    LAGraph_Init (msg) ;
+    GrB_Matrix A = NULL, F_net = NULL ;
+    GrB_Index n ;
+    bool ok = 1 ;
+
+    // create the karate graph
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "karate.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+    TEST_CHECK (A == NULL) ;    // A has been moved into G->A
+    OK (LAGraph_DeleteSelfEdges (G, msg)) ;
+    OK (GrB_Matrix_nrows (&n, G->A)) ;
+
+    // each orbit on its own, a few orbits at once, and all of them
+    bool orbits [16] ;
+    for (int trial = 0 ; trial <= 18 ; trial++)
+    {
+        for (int j = 0 ; j < 16 ; j++)
+        {
+            orbits [j] = (trial < 16) ? (j == trial) :
+                         (trial == 16) ? (j % 3 == 0) :
+                         (trial == 17) ? (j >= 10) : true ;
+        }
+
+        // vertices 5:n-4 only
+        GrB_Index vfirst = 5, vlast = n - 3 ;
+        OK (LAGraph_FastGraphletTransform_Range (&F_net, G, true, orbits,
+            vfirst, vlast, msg)) ;
+        GrB_Index nrows, ncols ;
+        OK (GrB_Matrix_nrows (&nrows, F_net)) ;
+        OK (GrB_Matrix_ncols (&ncols, F_net)) ;
+        TEST_CHECK (nrows == 16 && ncols == vlast - vfirst) ;
+
+        for (GrB_Index v = vfirst ; v < vlast ; v++) {
+            for (int j = 0 ; j < 16 ; j++) {
+                int64_t x ;
+                GrB_Info info = GrB_Matrix_extractElement (&x, F_net, j,
+                    v - vfirst) ;
+                if (info == GrB_NO_VALUE) x = 0 ;
+                ok &= (info == GrB_SUCCESS || info == GrB_NO_VALUE) ;
+                // no explicit zeros, and nothing for other orbits
+                ok &= (info == GrB_NO_VALUE || (x != 0 && orbits [j])) ;
+                if (orbits [j])
+                    ok &= (x == karate_graphlet_counts [16 * v + j]) ;
+            }
+        }
+        TEST_CHECK (ok) ;
+        OK (GrB_free (&F_net)) ;
+    }
+
+    // an empty range
+    OK (LAGraph_FastGraphletTransform_Range (&F_net, G, true, NULL, 7, 7,
+        msg)) ;
+    GrB_Index nvals ;
+    OK (GrB_Matrix_nvals (&nvals, F_net)) ;
+    TEST_CHECK (nvals == 0) ;
+    OK (GrB_free (&F_net)) ;
+
+    // without d_15, orbits 0 to 4 are unchanged
+    OK (LAGraph_FastGraphletTransform_Range (&F_net, G, false, NULL, 0, n,
+        msg)) ;
+    for (GrB_Index v = 0 ; v < n ; v++) {
+        for (int j = 0 ; j <= 4 ; j++) {
+            int64_t x ;
+            if (GrB_Matrix_extractElement (&x, F_net, j, v) == GrB_NO_VALUE)
+                x = 0 ;
+            ok &= (x == karate_graphlet_counts [16 * v + j]) ;
+        }
+    }
+    TEST_CHECK (ok) ;
+    OK (GrB_free (&F_net)) ;
+
+    // invalid range
+    int result = LAGraph_FastGraphletTransform_Range (&F_net, G, true, NULL,
+        4, n + 1, msg) ;
+    TEST_CHECK (result == GrB_INVALID_INDEX) ;
+    TEST_CHECK (F_net == NULL) ;
+
+    // F_net is NULL
+    result = LAGraph_FastGraphletTransform_Range (NULL, G, true, NULL, 0, n,
+        msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    // G may have self edges
+    G->nself_edges = LAGRAPH_UNKNOWN ;
+    result = LAGraph_FastGraphletTransform_Range (&F_net, G, true, NULL, 0, n,
+        msg) ;
+    TEST_CHECK (result == -1004) ;
+    TEST_CHECK (F_net == NULL) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
 //****************************************************************************
 //****************************************************************************
 TEST_LIST = {
     {"FastGraphletTransform", test_FastGraphletTransform},
+    {"FastGraphletTransform_Range", test_FastGraphletTransform_Range},
     {NULL, NULL}
 };
@@ -0,0 +1,210 @@
+//------------------------------------------------------------------------------
+// LAGraph/experimental/test/test_IncrementalCC.c: test incremental CC
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2021 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+// See additional acknowledgments in the LICENSE file,
+// or contact permission@sei.cmu.edu for the full terms.
+
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL, G0 = NULL ;
+LAGraph_IncrementalCC State = NULL ;
+GrB_Matrix A = NULL, A0 = NULL ;
+GrB_Vector C = NULL, C2 = NULL ;
+GrB_Index *I = NULL, *J = NULL, *I0 = NULL, *J0 = NULL, *Ins = NULL,
+    *Jns = NULL ;
+bool *X0 = NULL ;
+#define LEN 512
+char filename [LEN+1] ;
+
+const char *files [ ] =
+{
+    "karate.mtx",
+    "A.mtx",
+    "jagmesh7.mtx",
+    "ldbc-undirected-example.mtx",
+    "LFAT5.mtx",
+    "LFAT5_two.mtx",
+    "bcsstk13.mtx",
+    "tree-example.mtx",
+    "zenios.mtx",
+    ""
+} ;
+
+//------------------------------------------------------------------------------
+// test_IncrementalCC: insert edges into a graph and compare with CC
+//------------------------------------------------------------------------------
+
+void test_IncrementalCC (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    for (int k = 0 ; ; k++)
+    {
+
+        //----------------------------------------------------------------------
+        // load the full graph G
+        //----------------------------------------------------------------------
+
+        const char *aname = files [k] ;
+        if (strlen (aname) == 0) break ;
+        printf ("\nMatrix: %s\n", aname) ;
+        TEST_CASE (aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+        GrB_Index n, nvals ;
+        OK (GrB_Matrix_nrows (&n, A)) ;
+        OK (GrB_Matrix_nvals (&nvals, A)) ;
+        OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+
+        //----------------------------------------------------------------------
+        // split the edges of G into G0 and a batch of edges to insert
+        //----------------------------------------------------------------------
+
+        // edge (i,j) is held back from G0 if (i+j) % 3 == 0, which keeps G0
+        // symmetric.  Only one of (i,j) and (j,i) is inserted later.
+        OK (LAGraph_Malloc ((void **) &I, nvals, sizeof (GrB_Index), msg)) ;
+        OK (LAGraph_Malloc ((void **) &J, nvals, sizeof (GrB_Index), msg)) ;
+        OK (LAGraph_Malloc ((void **) &I0, nvals, sizeof (GrB_Index), msg)) ;
+        OK (LAGraph_Malloc ((void **) &J0, nvals, sizeof (GrB_Index), msg)) ;
+        OK (LAGraph_Malloc ((void **) &Ins, nvals, sizeof (GrB_Index), msg)) ;
+        OK (LAGraph_Malloc ((void **) &Jns, nvals, sizeof (GrB_Index), msg)) ;
+        OK (LAGraph_Calloc ((void **) &X0, nvals, sizeof (bool), msg)) ;
+        GrB_Index nvals2 = nvals ;
+        OK (GrB_Matrix_extractTuples (I, J, (bool *) NULL, &nvals2, G->A)) ;
+        TEST_CHECK (nvals2 == nvals) ;
+        GrB_Index n0 = 0, nins = 0 ;
+        for (int64_t p = 0 ; p < nvals ; p++)
+        {
+            if ((I [p] + J [p]) % 3 == 0)
+            {
+                if (I [p] < J [p])
+                {
+                    Ins [nins] = I [p] ;
+                    Jns [nins] = J [p] ;
+                    nins++ ;
+                }
+            }
+            else
+            {
+                I0 [n0] = I [p] ;
+                J0 [n0] = J [p] ;
+                n0++ ;
+            }
+        }
+        OK (GrB_Matrix_new (&A0, GrB_BOOL, n, n)) ;
+        OK (GrB_Matrix_build (A0, I0, J0, X0, n0, GrB_LOR)) ;
+        OK (LAGraph_New (&G0, &A0, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+        printf ("edges in G0: %g, edges to insert: %g\n", (double) n0,
+            (double) nins) ;
+
+        //----------------------------------------------------------------------
+        // compute the CC of G0, then insert the held-back edges
+        //----------------------------------------------------------------------
+
+        OK (LAGraph_IncrementalCC_New (&State, G0, msg)) ;
+        TEST_CHECK (State != NULL) ;
+        OK (LAGr_ConnectedComponents (&C, G0, msg)) ;
+        OK (LG_check_cc (C, G0, msg)) ;
+        OK (GrB_free (&C)) ;
+
+        // insert the batch in two halves, the first half twice
+        GrB_Index nhalf = nins / 2 ;
+        OK (LAGraph_IncrementalCC_Insert (State, Ins, Jns, nhalf, msg)) ;
+        OK (LAGraph_IncrementalCC_Insert (State, Ins, Jns, nhalf, msg)) ;
+        OK (LAGraph_IncrementalCC_Insert (State, Ins + nhalf, Jns + nhalf,
+            nins - nhalf, msg)) ;
+
+        //----------------------------------------------------------------------
+        // compare with the CC of the full graph
+        //----------------------------------------------------------------------
+
+        OK (LAGraph_IncrementalCC_Component (&C, State, msg)) ;
+        OK (LG_check_cc (C, G, msg)) ;
+        OK (LAGr_ConnectedComponents (&C2, G, msg)) ;
+        int64_t ncomponents = 0 ;
+        for (int64_t i = 0 ; i < n ; i++)
+        {
+            uint64_t c = 0, c2 = 0 ;
+            GrB_Index rep ;
+            OK (GrB_Vector_extractElement (&c, C, i)) ;
+            OK (GrB_Vector_extractElement (&c2, C2, i)) ;
+            TEST_CHECK (c == c2) ;
+            OK (LAGraph_IncrementalCC_Find (&rep, State, i, msg)) ;
+            TEST_CHECK (rep == c) ;
+            if (c == i) ncomponents++ ;
+        }
+        printf ("# of components: %g\n", (double) ncomponents) ;
+        TEST_CHECK (ncomponents == State->ncomponents) ;
+        OK (GrB_free (&C)) ;
+
+        //----------------------------------------------------------------------
+        // recompute from scratch with G0, as if the edges were deleted
+        //----------------------------------------------------------------------
+
+        OK (LAGraph_IncrementalCC_Recompute (State, G0, msg)) ;
+        OK (LAGraph_IncrementalCC_Component (&C, State, msg)) ;
+        OK (LG_check_cc (C, G0, msg)) ;
+
+        //----------------------------------------------------------------------
+        // error handling
+        //----------------------------------------------------------------------
+
+        GrB_Index bad [1] = { n } ;
+        int result = LAGraph_IncrementalCC_Insert (State, bad, bad, 1, msg) ;
+        TEST_CHECK (result == GrB_INVALID_INDEX) ;
+        result = LAGraph_IncrementalCC_Insert (State, NULL, NULL, 1, msg) ;
+        TEST_CHECK (result == GrB_NULL_POINTER) ;
+        GrB_Index rep ;
+        result = LAGraph_IncrementalCC_Find (&rep, State, n, msg) ;
+        TEST_CHECK (result == GrB_INVALID_INDEX) ;
+        result = LAGraph_IncrementalCC_Find (NULL, State, 0, msg) ;
+        TEST_CHECK (result == GrB_NULL_POINTER) ;
+        result = LAGraph_IncrementalCC_Component (NULL, State, msg) ;
+        TEST_CHECK (result == GrB_NULL_POINTER) ;
+        result = LAGraph_IncrementalCC_New (NULL, G, msg) ;
+        TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+        //----------------------------------------------------------------------
+        // free everything
+        //----------------------------------------------------------------------
+
+        OK (LAGraph_IncrementalCC_Free (&State, msg)) ;
+        TEST_CHECK (State == NULL) ;
+        OK (LAGraph_IncrementalCC_Free (&State, msg)) ;
+        OK (GrB_free (&C)) ;
+        OK (GrB_free (&C2)) ;
+        OK (LAGraph_Free ((void **) &I, msg)) ;
+        OK (LAGraph_Free ((void **) &J, msg)) ;
+        OK (LAGraph_Free ((void **) &I0, msg)) ;
+        OK (LAGraph_Free ((void **) &J0, msg)) ;
+        OK (LAGraph_Free ((void **) &Ins, msg)) ;
+        OK (LAGraph_Free ((void **) &Jns, msg)) ;
+        OK (LAGraph_Free ((void **) &X0, msg)) ;
+        OK (LAGraph_Delete (&G0, msg)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// TEST_LIST: the list of tasks for this entire test
+//------------------------------------------------------------------------------
+
+TEST_LIST =
+{
+    {"IncrementalCC", test_IncrementalCC},
+    {NULL, NULL}
+} ;
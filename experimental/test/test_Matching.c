@@ -0,0 +1,193 @@
+//------------------------------------------------------------------------------
+// LAGraph/experimental/test/test_Matching
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2021 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+// See additional acknowledgments in the LICENSE file,
+// or contact permission@sei.cmu.edu for the full terms.
+
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+#include <LG_Xtest.h>
+
+//------------------------------------------------------------------------------
+// test cases
+//------------------------------------------------------------------------------
+
+const char *files [ ] =
+{
+    "A.mtx",
+    "jagmesh7.mtx",
+    "bcsstk13.mtx",
+    "karate.mtx",
+    "ldbc-cdlp-undirected-example.mtx",
+    "ldbc-cdlp-directed-example.mtx",
+    "ldbc-undirected-example-bool.mtx",
+    "ldbc-undirected-example-unweighted.mtx",
+    "ldbc-undirected-example.mtx",
+    "ldbc-wcc-example.mtx",
+    "LFAT5.mtx",
+    "LFAT5_two.mtx",
+    "cryg2500.mtx",
+    "msf2.mtx",
+    "olm1000.mtx",
+    "west0067.mtx",
+    ""
+} ;
+
+#define LEN 512
+char filename [LEN+1] ;
+
+char msg [LAGRAPH_MSG_LEN] ;
+GrB_Vector mate = NULL ;
+GrB_Matrix A = NULL ;
+LAGraph_Graph G = NULL ;
+
+//------------------------------------------------------------------------------
+// test_Matching: test the maximal and weighted matchings
+//------------------------------------------------------------------------------
+
+void test_Matching (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    for (int k = 0 ; ; k++)
+    {
+
+        // load the matrix as A
+        const char *aname = files [k] ;
+        if (strlen (aname) == 0) break;
+        TEST_CASE (aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+        TEST_MSG ("Loading of valued matrix failed") ;
+        printf ("\nMatrix: %s\n", aname) ;
+
+        // construct a directed graph G with adjacency matrix A
+        OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+        TEST_CHECK (A == NULL) ;
+
+        // make the adjacency matrix symmetric, with symmetric values
+        OK (LAGraph_Cached_IsSymmetricStructure (G, msg)) ;
+        if (G->is_symmetric_structure == LAGraph_FALSE)
+        {
+            OK (LAGraph_Cached_AT (G, msg)) ;
+            OK (GrB_eWiseAdd (G->A, NULL, NULL, GrB_MAX_FP64, G->A, G->AT,
+                NULL)) ;
+            OK (LAGraph_DeleteCached (G, msg)) ;
+        }
+        G->kind = LAGraph_ADJACENCY_UNDIRECTED ;
+
+        GrB_Index n, nmatched ;
+        OK (GrB_Matrix_nrows (&n, G->A)) ;
+
+        // maximal matching, for several seeds
+        for (int64_t seed = 0 ; seed <= 4*n ; seed += n)
+        {
+            OK (LAGraph_Matching (&mate, &nmatched, G, LAGraph_Matching_Luby,
+                seed, msg)) ;
+            printf ("Luby: %g matched edges\n", (double) nmatched) ;
+            OK (LG_check_matching (mate, nmatched, G->A, false, msg)) ;
+            OK (GrB_free (&mate)) ;
+        }
+
+        // approximate maximum weight matching
+        OK (LAGraph_Matching (&mate, &nmatched, G,
+            LAGraph_Matching_LocallyDominant, 0, msg)) ;
+        printf ("locally dominant: %g matched edges\n", (double) nmatched) ;
+        OK (LG_check_matching (mate, nmatched, G->A, true, msg)) ;
+        OK (GrB_free (&mate)) ;
+
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_Matching_errors: test error handling
+//------------------------------------------------------------------------------
+
+void test_Matching_errors (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "west0067.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+    TEST_CHECK (A == NULL) ;
+    GrB_Index nmatched ;
+
+    // G->A is not known to be symmetric
+    int result = LAGraph_Matching (&mate, &nmatched, G,
+        LAGraph_Matching_Luby, 0, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == -105) ;
+    TEST_CHECK (mate == NULL) ;
+
+    // G->A has a symmetric structure, but its values are not symmetric
+    OK (LAGraph_Cached_AT (G, msg)) ;
+    OK (GrB_eWiseAdd (G->A, NULL, NULL, GrB_ONEB_FP64, G->A, G->AT, NULL)) ;
+    OK (LAGraph_DeleteCached (G, msg)) ;
+    OK (GrB_apply (G->A, NULL, NULL, GrB_ROWINDEX_INT64, G->A, 1, NULL)) ;
+    G->is_symmetric_structure = LAGraph_TRUE ;
+    result = LAGraph_Matching (&mate, &nmatched, G,
+        LAGraph_Matching_LocallyDominant, 0, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == -106 || result == GrB_SUCCESS) ;
+    OK (GrB_free (&mate)) ;
+
+    // the weights of the lower triangular part are negative, so each edge
+    // is kept only in the upper triangular part, and some nodes have no edge
+    // left to select
+    GrB_Index n ;
+    OK (GrB_Matrix_nrows (&n, G->A)) ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+    OK (GrB_select (A, NULL, NULL, GrB_TRIL, G->A, -1, NULL)) ;
+    OK (GrB_assign (G->A, A, NULL, (double) -1, GrB_ALL, n, GrB_ALL, n,
+        GrB_DESC_S)) ;
+    OK (GrB_free (&A)) ;
+    result = LAGraph_Matching (&mate, &nmatched, G,
+        LAGraph_Matching_LocallyDominant, 0, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == -106) ;
+    TEST_CHECK (mate == NULL) ;
+
+    // invalid method
+    result = LAGraph_Matching (&mate, &nmatched, G,
+        (LAGraph_Matching_Method) 42, 0, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    TEST_CHECK (mate == NULL) ;
+
+    // mate is NULL
+    result = LAGraph_Matching (NULL, &nmatched, G,
+        LAGraph_Matching_Luby, 0, msg) ;
+    printf ("result: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//-----------------------------------------------------------------------------
+// TEST_LIST: the list of tasks for this entire test
+//-----------------------------------------------------------------------------
+
+TEST_LIST =
+{
+    { "Matching", test_Matching },
+    { "Matching_errors", test_Matching_errors },
+    { NULL, NULL }
+} ;
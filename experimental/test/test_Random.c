@@ -16,9 +16,10 @@
 
 #include <LAGraphX.h>
 #include <LAGraph_test.h>
+#include "LG_internal.h"
 
 char msg [LAGRAPH_MSG_LEN] ;
-GrB_Vector Seed = NULL ;
+GrB_Vector Seed = NULL, Seed2 = NULL ;
 
 //------------------------------------------------------------------------------
 // test_Random
@@ -72,12 +73,94 @@ void test_Random (void)
     LAGraph_Finalize (msg) ;
 }
 
+//------------------------------------------------------------------------------
+// test_Random_Counter: check the values of the generator
+//------------------------------------------------------------------------------
+
+// The random value of each entry depends only on the seed, the index of the
+// entry, and the number of calls to LAGraph_Random_Next, not on the sparsity
+// of the Seed vector or the number of threads.
+
+void test_Random_Counter (void)
+{
+    LAGraph_Init (msg) ;
+    OK (LAGraph_Random_Init (msg)) ;
+
+    GrB_Index n = 10000 ;
+    uint64_t seed = 42 ;
+    for (int nthreads = 1 ; nthreads <= 4 ; nthreads *= 2)
+    {
+        OK (LAGraph_SetNumThreads (1, nthreads, msg)) ;
+
+        // a dense seed vector, and a sparse one with every third entry
+        OK (GrB_Vector_new (&Seed, GrB_UINT64, n)) ;
+        OK (GrB_assign (Seed, NULL, NULL, (uint64_t) 0, GrB_ALL, n, NULL)) ;
+        OK (GrB_Vector_new (&Seed2, GrB_UINT64, n)) ;
+        for (GrB_Index i = 0 ; i < n ; i += 3)
+        {
+            OK (GrB_Vector_setElement_UINT64 (Seed2, 0, i)) ;
+        }
+        OK (LAGraph_Random_Seed (Seed, seed, msg)) ;
+        OK (LAGraph_Random_Seed (Seed2, seed, msg)) ;
+
+        for (int round = 0 ; round < 3 ; round++)
+        {
+            GrB_Index nvals ;
+            OK (GrB_Vector_nvals (&nvals, Seed)) ;
+            TEST_CHECK (nvals == n) ;
+            OK (GrB_Vector_nvals (&nvals, Seed2)) ;
+            TEST_CHECK (nvals == (n + 2) / 3) ;
+            for (GrB_Index i = 0 ; i < n ; i++)
+            {
+                uint64_t x, y ;
+                OK (GrB_Vector_extractElement (&x, Seed, i)) ;
+                TEST_CHECK (x == LG_Random64 (seed, i, round)) ;
+                if (i % 3 == 0)
+                {
+                    OK (GrB_Vector_extractElement (&y, Seed2, i)) ;
+                    TEST_CHECK (x == y) ;
+                }
+            }
+            OK (LAGraph_Random_Next (Seed, msg)) ;
+            OK (LAGraph_Random_Next (Seed2, msg)) ;
+        }
+
+        // the values of a dense vector are all distinct
+        GrB_Index nvals = n ;
+        uint64_t *X = NULL ;
+        OK (LAGraph_Malloc ((void **) &X, n, sizeof (uint64_t), msg)) ;
+        OK (GrB_Vector_extractTuples (NULL, X, &nvals, Seed)) ;
+        TEST_CHECK (nvals == n) ;
+        OK (LG_msort1 ((int64_t *) X, n, msg)) ;
+        for (GrB_Index k = 1 ; k < n ; k++)
+        {
+            TEST_CHECK (X [k-1] != X [k]) ;
+        }
+        OK (LAGraph_Free ((void **) &X, msg)) ;
+
+        OK (GrB_Vector_free (&Seed)) ;
+        OK (GrB_Vector_free (&Seed2)) ;
+    }
+
+    // LG_Random15 and LG_Random60 stay in range
+    uint64_t state = 1 ;
+    for (int k = 0 ; k < 1000 ; k++)
+    {
+        TEST_CHECK (LG_Random15 (&state) <= LG_RANDOM15_MAX) ;
+        TEST_CHECK (LG_Random60 (&state) <= LG_RANDOM60_MAX) ;
+    }
+
+    OK (LAGraph_Random_Finalize (msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
 //------------------------------------------------------------------------------
 // Test list
 //------------------------------------------------------------------------------
 
 TEST_LIST = {
     {"Random", test_Random},
+    {"Random_Counter", test_Random_Counter},
     {NULL, NULL}
 };
 
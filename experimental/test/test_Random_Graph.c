@@ -0,0 +1,172 @@
+//------------------------------------------------------------------------------
+// LAGraph/experimental/test/test_Random_Graph.c: test synthetic graph generators
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2021 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+// See additional acknowledgments in the LICENSE file,
+// or contact permission@sei.cmu.edu for the full terms.
+
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL, G2 = NULL ;
+GrB_Matrix T = NULL ;
+
+//------------------------------------------------------------------------------
+// generate: construct a graph with one of the generators
+//------------------------------------------------------------------------------
+
+#define KRONECKER 0
+#define GNM 1
+#define CHUNGLU 2
+
+int generate (LAGraph_Graph *G, int method, int scale, GrB_Index nedges,
+    bool symmetric, uint64_t seed)
+{
+    GrB_Index n = ((GrB_Index) 1) << scale ;
+    switch (method)
+    {
+        case KRONECKER :
+            return (LAGraph_Random_Kronecker (G, scale, nedges, 0.57, 0.19,
+                0.19, symmetric, seed, msg)) ;
+        case GNM :
+            return (LAGraph_Random_GNM (G, n, nedges, symmetric, seed, msg)) ;
+        default :
+            return (LAGraph_Random_ChungLu (G, n, nedges, 2.5, symmetric,
+                seed, msg)) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// test_Random_Graph
+//------------------------------------------------------------------------------
+
+void test_Random_Graph (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    int scale = 10 ;
+    GrB_Index n = ((GrB_Index) 1) << scale ;
+    GrB_Index nedges = 16 * n ;
+
+    for (int method = KRONECKER ; method <= CHUNGLU ; method++)
+    {
+        for (int sym = 0 ; sym <= 1 ; sym++)
+        {
+            bool symmetric = (bool) sym ;
+            printf ("\nmethod %d, symmetric %d\n", method, sym) ;
+
+            // the graph is the same for any number of threads
+            OK (LAGraph_SetNumThreads (1, 1, msg)) ;
+            OK (generate (&G, method, scale, nedges, symmetric, 42)) ;
+            OK (LAGraph_CheckGraph (G, msg)) ;
+            OK (LAGraph_SetNumThreads (1, 4, msg)) ;
+            OK (generate (&G2, method, scale, nedges, symmetric, 42)) ;
+            bool ok = false ;
+            OK (LAGraph_Matrix_IsEqual (&ok, G->A, G2->A, msg)) ;
+            TEST_CHECK (ok) ;
+            OK (LAGraph_Delete (&G2, msg)) ;
+
+            // but it depends on the seed
+            OK (generate (&G2, method, scale, nedges, symmetric, 99)) ;
+            OK (LAGraph_Matrix_IsEqual (&ok, G->A, G2->A, msg)) ;
+            TEST_CHECK (!ok) ;
+            OK (LAGraph_Delete (&G2, msg)) ;
+
+            // check the size of the graph
+            GrB_Index nrows, nvals ;
+            OK (GrB_Matrix_nrows (&nrows, G->A)) ;
+            TEST_CHECK (nrows == n) ;
+            OK (GrB_Matrix_nvals (&nvals, G->A)) ;
+            printf ("nvals: %g\n", (double) nvals) ;
+            TEST_CHECK (nvals > 0) ;
+            TEST_CHECK (nvals <= (symmetric ? 2 : 1) * nedges) ;
+
+            // check the kind, and that A is symmetric if requested
+            TEST_CHECK (G->kind == (symmetric ? LAGraph_ADJACENCY_UNDIRECTED
+                : LAGraph_ADJACENCY_DIRECTED)) ;
+            if (symmetric)
+            {
+                OK (GrB_Matrix_new (&T, GrB_BOOL, n, n)) ;
+                OK (GrB_transpose (T, NULL, NULL, G->A, NULL)) ;
+                OK (LAGraph_Matrix_IsEqual (&ok, G->A, T, msg)) ;
+                TEST_CHECK (ok) ;
+                OK (GrB_free (&T)) ;
+            }
+
+            // there are no self edges
+            TEST_CHECK (G->nself_edges == 0) ;
+            G->nself_edges = LAGRAPH_UNKNOWN ;
+            OK (LAGraph_Cached_NSelfEdges (G, msg)) ;
+            TEST_CHECK (G->nself_edges == 0) ;
+
+            OK (LAGraph_Delete (&G, msg)) ;
+        }
+    }
+
+    // with a = 1, all edges are self edges of one node, and G is empty
+    OK (LAGraph_Random_Kronecker (&G, 8, 1000, 1, 0, 0, false, 1, msg)) ;
+    GrB_Index nvals ;
+    OK (GrB_Matrix_nvals (&nvals, G->A)) ;
+    TEST_CHECK (nvals == 0) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+
+    // no edges
+    OK (LAGraph_Random_GNM (&G, 10, 0, true, 1, msg)) ;
+    OK (GrB_Matrix_nvals (&nvals, G->A)) ;
+    TEST_CHECK (nvals == 0) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_Random_Graph_errors
+//------------------------------------------------------------------------------
+
+void test_Random_Graph_errors (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    int result = LAGraph_Random_Kronecker (NULL, 4, 10, 0.57, 0.19, 0.19,
+        false, 1, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGraph_Random_Kronecker (&G, 61, 10, 0.57, 0.19, 0.19,
+        false, 1, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    TEST_CHECK (G == NULL) ;
+    result = LAGraph_Random_Kronecker (&G, 4, 10, 0.6, 0.3, 0.3,
+        false, 1, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    TEST_CHECK (G == NULL) ;
+
+    result = LAGraph_Random_GNM (NULL, 10, 10, false, 1, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGraph_Random_GNM (&G, 0, 10, false, 1, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    TEST_CHECK (G == NULL) ;
+
+    result = LAGraph_Random_ChungLu (NULL, 10, 10, 2.5, false, 1, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGraph_Random_ChungLu (&G, 10, 10, 1.0, false, 1, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+    TEST_CHECK (G == NULL) ;
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// Test list
+//------------------------------------------------------------------------------
+
+TEST_LIST = {
+    {"Random_Graph", test_Random_Graph},
+    {"Random_Graph_errors", test_Random_Graph_errors},
+    {NULL, NULL}
+};
@@ -88,14 +88,95 @@ void test_SquareClustering (void)
     }
     // OK (GrB_free (&soln)) ;
 
+    // compare with the blocked method
+    GrB_Vector c2 = NULL ;
+    OK (LAGraph_SquareClustering_Blocked (&c2, G, msg)) ;
+    bool ok = false ;
+    OK (LAGraph_Vector_IsEqual (&ok, c, c2, msg)) ;
+    TEST_CHECK (ok) ;
+    OK (GrB_free (&c2)) ;
+
     OK (GrB_free (&c)) ;
     OK (LAGraph_Delete (&G, msg)) ;
 
     LAGraph_Finalize (msg) ;
 };
 
+//------------------------------------------------------------------------------
+// test_SquareClustering_Blocked: compare both methods on larger graphs
+//------------------------------------------------------------------------------
+
+#define LEN 512
+char filename [LEN+1] ;
+
+const char *files [ ] =
+{
+    "karate.mtx",
+    "A.mtx",
+    "jagmesh7.mtx",
+    "ldbc-undirected-example.mtx",
+    "bcsstk13.mtx",
+    "",
+} ;
+
+void test_SquareClustering_Blocked (void)
+{
+    LAGraph_Init (msg) ;
+
+    GrB_Matrix A = NULL ;
+    LAGraph_Graph G = NULL ;
+
+    for (int k = 0 ; ; k++)
+    {
+        const char *aname = files [k] ;
+        if (strlen (aname) == 0) break ;
+        TEST_CASE (aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+        OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+        OK (LAGraph_DeleteSelfEdges (G, msg)) ;
+        OK (LAGraph_Cached_OutDegree (G, msg)) ;
+
+        GrB_Vector c = NULL, c2 = NULL ;
+        OK (LAGraph_SquareClustering (&c, G, msg)) ;
+        for (int nthreads = 1 ; nthreads <= 4 ; nthreads *= 2)
+        {
+            OK (LAGraph_SetNumThreads (1, nthreads, msg)) ;
+            OK (LAGraph_SquareClustering_Blocked (&c2, G, msg)) ;
+            bool ok = false ;
+            OK (LAGraph_Vector_IsEqual (&ok, c, c2, msg)) ;
+            TEST_CHECK (ok) ;
+            OK (GrB_free (&c2)) ;
+        }
+
+        // G->A is unchanged
+        OK (LAGraph_CheckGraph (G, msg)) ;
+
+        OK (GrB_free (&c)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    // G->A must be symmetric
+    OK (GrB_Matrix_new (&A, GrB_BOOL, 3, 3)) ;
+    OK (GrB_Matrix_setElement (A, true, 0, 1)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+    GrB_Vector c = NULL ;
+    int result = LAGraph_SquareClustering_Blocked (&c, G, msg) ;
+    TEST_CHECK (result == LAGRAPH_SYMMETRIC_STRUCTURE_REQUIRED) ;
+    TEST_CHECK (c == NULL) ;
+    result = LAGraph_SquareClustering_Blocked (NULL, G, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+
+    LAGraph_Finalize (msg) ;
+}
+
 TEST_LIST = {
     {"SquareClustering", test_SquareClustering},
+    {"SquareClustering_Blocked", test_SquareClustering_Blocked},
     // {"SquareClustering_errors", test_errors},
     {NULL, NULL}
 };
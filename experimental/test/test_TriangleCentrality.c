@@ -113,6 +113,7 @@ void test_TriangleCentrality (void)
         G->kind = LAGraph_ADJACENCY_DIRECTED ;
         OK (LAGraph_VertexCentrality_Triangle (&c, &ntri, 0, G, msg)) ;
         TEST_CHECK (ntri == ntriangles) ;
+        OK (GrB_free (&c)) ;
 
         OK (LAGraph_Delete (&G, msg)) ;
     }
@@ -120,6 +121,124 @@ void test_TriangleCentrality (void)
     LAGraph_Finalize (msg) ;
 }
 
+//------------------------------------------------------------------------------
+// check_subset: check c(i) against c3(i) for each node i in vertices
+//------------------------------------------------------------------------------
+
+void check_subset (GrB_Vector c, GrB_Vector c3, const GrB_Index *vertices,
+    GrB_Index nvertices)
+{
+    GrB_Index nvals ;
+    OK (GrB_Vector_nvals (&nvals, c)) ;
+    TEST_CHECK (nvals == nvertices) ;
+    for (GrB_Index k = 0 ; k < nvertices ; k++)
+    {
+        GrB_Index i = (vertices == NULL) ? k : vertices [k] ;
+        double x = 0, x3 = 0 ;
+        OK (GrB_Vector_extractElement (&x, c, i)) ;
+        int info = GrB_Vector_extractElement (&x3, c3, i) ;
+        TEST_CHECK (info == GrB_SUCCESS || info == GrB_NO_VALUE) ;
+        TEST_CHECK (fabs (x - x3) <= 1e-12 * (1 + fabs (x3))) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// test_TriangleCentrality_Subset
+//------------------------------------------------------------------------------
+
+void test_TriangleCentrality_Subset (void)
+{
+    LAGraph_Init (msg) ;
+
+    for (int k = 0 ; ; k++)
+    {
+
+        // load the matrix as A
+        const char *aname = files [k].name ;
+        uint64_t ntriangles = files [k].ntriangles ;
+        if (strlen (aname) == 0) break;
+        printf ("\n================================== %s: (subset)\n", aname) ;
+        TEST_CASE (aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+        TEST_MSG ("Loading of adjacency matrix failed") ;
+
+        // construct an undirected graph G with adjacency matrix A
+        OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+        TEST_CHECK (A == NULL) ;
+        OK (LAGraph_DeleteSelfEdges (G, msg)) ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, G->A)) ;
+
+        // compute the full triangle centrality with method 3
+        uint64_t ntri ;
+        GrB_Vector c3 = NULL, c = NULL ;
+        OK (LAGraph_VertexCentrality_Triangle (&c3, &ntri, 3, G, msg)) ;
+        TEST_CHECK (ntri == ntriangles) ;
+
+        // all nodes, support computed and freed
+        OK (LAGraph_VertexCentrality_TriangleSubset (&c, &ntri, NULL, G,
+            NULL, 0, msg)) ;
+        TEST_CHECK (ntri == ntriangles) ;
+        check_subset (c, c3, NULL, n) ;
+        OK (GrB_free (&c)) ;
+
+        // batches of nodes, with the support computed once and reused
+        GrB_Matrix Support = NULL ;
+        GrB_Index *vertices = NULL ;
+        OK (LAGraph_Malloc ((void **) &vertices, n, sizeof (GrB_Index), msg)) ;
+        for (int stride = 1 ; stride <= 7 ; stride += 3)
+        {
+            for (GrB_Index first = 0 ; first < stride ; first++)
+            {
+                GrB_Index nvertices = 0 ;
+                for (GrB_Index i = first ; i < n ; i += stride)
+                {
+                    // list the nodes in reverse order
+                    vertices [nvertices++] = n - 1 - i ;
+                }
+                OK (LAGraph_VertexCentrality_TriangleSubset (&c, &ntri,
+                    &Support, G, vertices, nvertices, msg)) ;
+                TEST_CHECK (Support != NULL) ;
+                TEST_CHECK (ntri == ntriangles) ;
+                check_subset (c, c3, vertices, nvertices) ;
+                OK (GrB_free (&c)) ;
+            }
+        }
+
+        // empty subset
+        OK (LAGraph_VertexCentrality_TriangleSubset (&c, &ntri, &Support, G,
+            vertices, 0, msg)) ;
+        TEST_CHECK (ntri == ntriangles) ;
+        check_subset (c, c3, vertices, 0) ;
+        OK (GrB_free (&c)) ;
+
+        // support with explicit zeros on the edges in no triangle
+        GrB_Matrix Z = NULL ;
+        OK (GrB_Matrix_new (&Z, GrB_FP64, n, n)) ;
+        OK (GrB_assign (Z, G->A, NULL, (double) 0, GrB_ALL, n, GrB_ALL, n,
+            GrB_DESC_S)) ;
+        OK (GrB_eWiseAdd (Support, NULL, NULL, GrB_PLUS_FP64, Support, Z,
+            NULL)) ;
+        OK (GrB_free (&Z)) ;
+        OK (LAGraph_VertexCentrality_TriangleSubset (&c, &ntri, &Support, G,
+            NULL, 0, msg)) ;
+        TEST_CHECK (ntri == ntriangles) ;
+        check_subset (c, c3, NULL, n) ;
+        OK (GrB_free (&c)) ;
+
+        OK (LAGraph_Free ((void **) &vertices, msg)) ;
+        OK (GrB_free (&Support)) ;
+        OK (GrB_free (&c3)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    LAGraph_Finalize (msg) ;
+}
+
 //------------------------------------------------------------------------------
 // test_errors
 //------------------------------------------------------------------------------
@@ -170,6 +289,36 @@ void test_errors (void)
     TEST_CHECK (result == -1005) ;
     TEST_CHECK (c == NULL) ;
 
+    // the subset method has the same requirements
+    result = LAGraph_VertexCentrality_TriangleSubset (&c, &ntri, NULL, G,
+        NULL, 0, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == -1005) ;
+    TEST_CHECK (c == NULL) ;
+
+    G->kind = LAGraph_ADJACENCY_UNDIRECTED ;
+    result = LAGraph_VertexCentrality_TriangleSubset (NULL, &ntri, NULL, G,
+        NULL, 0, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    // node out of range
+    GrB_Index bad = 34 ;
+    result = LAGraph_VertexCentrality_TriangleSubset (&c, &ntri, NULL, G,
+        &bad, 1, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_INVALID_INDEX) ;
+    TEST_CHECK (c == NULL) ;
+
+    // support of the wrong size
+    GrB_Matrix Support = NULL ;
+    OK (GrB_Matrix_new (&Support, GrB_FP64, 3, 3)) ;
+    result = LAGraph_VertexCentrality_TriangleSubset (&c, &ntri, &Support, G,
+        NULL, 0, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_DIMENSION_MISMATCH) ;
+    TEST_CHECK (c == NULL) ;
+    OK (GrB_free (&Support)) ;
+
     OK (LAGraph_Delete (&G, msg)) ;
     LAGraph_Finalize (msg) ;
 }
@@ -179,6 +328,7 @@ void test_errors (void)
 
 TEST_LIST = {
     {"TriangleCentrality", test_TriangleCentrality},
+    {"TriangleCentrality_Subset", test_TriangleCentrality_Subset},
     {"TriangleCentrality_errors", test_errors},
     {NULL, NULL}
 };
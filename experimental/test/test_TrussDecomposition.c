@@ -0,0 +1,190 @@
+//----------------------------------------------------------------------------
+// LAGraph/experimental/test/test_TrussDecomposition.c: test truss numbers
+// ----------------------------------------------------------------------------
+
+// LAGraph, (c) 2021 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+// See additional acknowledgments in the LICENSE file,
+// or contact permission@sei.cmu.edu for the full terms.
+
+//-----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+
+#include "LAGraphX.h"
+#include "LAGraph_test.h"
+#include "LG_Xtest.h"
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL ;
+GrB_Matrix A = NULL ;
+GrB_Matrix T = NULL, Tk = NULL, C = NULL ;
+GrB_Matrix P1 = NULL, P2 = NULL ;
+#define LEN 512
+char filename [LEN+1] ;
+
+const char *files [ ] =
+{
+    "A.mtx",
+    "jagmesh7.mtx",
+//  "bcsstk13.mtx",
+    "karate.mtx",
+    "ldbc-cdlp-undirected-example.mtx",
+    "ldbc-undirected-example-bool.mtx",
+    "ldbc-undirected-example-unweighted.mtx",
+    "ldbc-undirected-example.mtx",
+    "ldbc-wcc-example.mtx",
+    "",
+} ;
+
+//****************************************************************************
+void test_TrussDecomposition (void)
+{
+    LAGraph_Init (msg) ;
+
+    for (int id = 0 ; ; id++)
+    {
+
+        // load the matrix as A
+        const char *aname = files [id] ;
+        if (strlen (aname) == 0) break;
+        printf ("\n================================== %s:\n", aname) ;
+        TEST_CASE (aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        TEST_MSG ("Loading of adjacency matrix failed") ;
+        fclose (f) ;
+
+        // construct an undirected graph G with adjacency matrix A
+        OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+        TEST_CHECK (A == NULL) ;
+
+        // remove self-edges
+        OK (LAGraph_Cached_NSelfEdges (G, msg)) ;
+        if (G->nself_edges != 0)
+        {
+            OK (LAGraph_DeleteSelfEdges (G, msg)) ;
+            TEST_CHECK (G->nself_edges == 0) ;
+        }
+
+        // compute the truss number of each edge
+        int64_t kmax ;
+        OK (LAGraph_TrussDecomposition (&T, &kmax, G, msg)) ;
+        printf ("truss decomposition: kmax %g\n", (double) kmax) ;
+
+        // T has the pattern of A
+        GrB_Index n, nvals, nvals_T ;
+        OK (GrB_Matrix_nrows (&n, G->A)) ;
+        OK (GrB_Matrix_nvals (&nvals, G->A)) ;
+        OK (GrB_Matrix_nvals (&nvals_T, T)) ;
+        TEST_CHECK (nvals == nvals_T) ;
+
+        // the entries of T >= k are the k-truss
+        for (uint32_t k = 3 ; k <= kmax ; k++)
+        {
+            OK (GrB_Matrix_new (&Tk, GrB_UINT32, n, n)) ;
+            OK (GrB_select (Tk, NULL, NULL, GrB_VALUEGE_UINT32, T, k, NULL)) ;
+            OK (LG_check_ktruss (&C, G, k, msg)) ;
+            OK (LAGraph_Matrix_Structure (&P1, Tk, msg)) ;
+            OK (LAGraph_Matrix_Structure (&P2, C, msg)) ;
+            bool ok = false ;
+            OK (LAGraph_Matrix_IsEqual (&ok, P1, P2, msg)) ;
+            TEST_CHECK (ok) ;
+            OK (GrB_Matrix_nvals (&nvals, C)) ;
+            TEST_CHECK ((nvals == 0) == (k == kmax)) ;
+            OK (GrB_free (&Tk)) ;
+            OK (GrB_free (&C)) ;
+            OK (GrB_free (&P1)) ;
+            OK (GrB_free (&P2)) ;
+        }
+
+        // compare with LAGraph_AllKTruss
+        int64_t *ntris, *nedges, *nsteps, kmax2 ;
+        GrB_Matrix *Cset ;
+        GrB_Index n4 = (n > 4) ? n : 4 ;
+        OK (LAGraph_Calloc ((void **) &Cset  , n4, sizeof (GrB_Matrix), msg)) ;
+        OK (LAGraph_Malloc ((void **) &ntris , n4, sizeof (int64_t), msg)) ;
+        OK (LAGraph_Malloc ((void **) &nedges, n4, sizeof (int64_t), msg)) ;
+        OK (LAGraph_Malloc ((void **) &nsteps, n4, sizeof (int64_t), msg)) ;
+        OK (LAGraph_AllKTruss (Cset, &kmax2, ntris, nedges, nsteps, G, msg)) ;
+        TEST_CHECK (kmax == kmax2) ;
+        for (int64_t k = 3 ; k <= kmax2 ; k++)
+        {
+            OK (GrB_free (&(Cset [k]))) ;
+        }
+        LAGraph_Free ((void **) &Cset, NULL) ;
+        LAGraph_Free ((void **) &ntris, NULL) ;
+        LAGraph_Free ((void **) &nedges, NULL) ;
+        LAGraph_Free ((void **) &nsteps, NULL) ;
+
+        OK (GrB_free (&T)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_TrussDecomposition_errors
+//------------------------------------------------------------------------------
+
+void test_TrussDecomposition_errors (void)
+{
+    LAGraph_Init (msg) ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "karate.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    TEST_MSG ("Loading of adjacency matrix failed") ;
+    fclose (f) ;
+
+    // construct an undirected graph G with adjacency matrix A
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+    TEST_CHECK (A == NULL) ;
+
+    OK (LAGraph_Cached_NSelfEdges (G, msg)) ;
+
+    int64_t kmax ;
+
+    // T is NULL
+    int result = LAGraph_TrussDecomposition (NULL, &kmax, G, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    // G is invalid
+    result = LAGraph_TrussDecomposition (&T, &kmax, NULL, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    TEST_CHECK (T == NULL) ;
+
+    // G may have self edges
+    G->nself_edges = LAGRAPH_UNKNOWN ;
+    result = LAGraph_TrussDecomposition (&T, &kmax, G, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == -1004) ;
+    TEST_CHECK (T == NULL) ;
+
+    // G is undirected
+    G->nself_edges = 0 ;
+    G->kind = LAGraph_ADJACENCY_DIRECTED ;
+    G->is_symmetric_structure = LAGraph_FALSE ;
+    result = LAGraph_TrussDecomposition (&T, &kmax, G, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == -1005) ;
+    TEST_CHECK (T == NULL) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    LAGraph_Finalize (msg) ;
+}
+
+//****************************************************************************
+
+TEST_LIST = {
+    {"TrussDecomposition", test_TrussDecomposition},
+    {"TrussDecomposition_errors", test_TrussDecomposition_errors},
+    {NULL, NULL}
+};
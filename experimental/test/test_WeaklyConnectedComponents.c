@@ -0,0 +1,147 @@
+//------------------------------------------------------------------------------
+// LAGraph/experimental/test/test_WeaklyConnectedComponents.c: test WCC
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2021 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+// See additional acknowledgments in the LICENSE file,
+// or contact permission@sei.cmu.edu for the full terms.
+
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include <LAGraphX.h>
+#include <LAGraph_test.h>
+
+char msg [LAGRAPH_MSG_LEN] ;
+LAGraph_Graph G = NULL, S = NULL ;
+GrB_Matrix A = NULL, AS = NULL ;
+GrB_Vector C = NULL, C2 = NULL ;
+#define LEN 512
+char filename [LEN+1] ;
+
+const char *files [ ] =
+{
+    "west0067.mtx",
+    "ldbc-directed-example.mtx",
+    "ldbc-cdlp-directed-example.mtx",
+    "cryg2500.mtx",
+    "olm1000.mtx",
+    "msf1.mtx",
+    "karate.mtx",
+    "LFAT5_two.mtx",
+    ""
+} ;
+
+//------------------------------------------------------------------------------
+// check_same: check if two component vectors are identical
+//------------------------------------------------------------------------------
+
+static void check_same (GrB_Vector C1, GrB_Vector C2, GrB_Index n)
+{
+    for (int64_t i = 0 ; i < n ; i++)
+    {
+        uint64_t c1 = 0, c2 = 0 ;
+        OK (GrB_Vector_extractElement (&c1, C1, i)) ;
+        OK (GrB_Vector_extractElement (&c2, C2, i)) ;
+        TEST_CHECK (c1 == c2) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// test_wcc: compare WCC with the CC of A+A'
+//------------------------------------------------------------------------------
+
+void test_wcc (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    for (int k = 0 ; ; k++)
+    {
+
+        // load the adjacency matrix as A
+        const char *aname = files [k] ;
+        if (strlen (aname) == 0) break ;
+        printf ("\nMatrix: %s\n", aname) ;
+        TEST_CASE (aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, A)) ;
+
+        // S = structure of A+A', as an undirected graph
+        OK (GrB_Matrix_new (&AS, GrB_BOOL, n, n)) ;
+        OK (GrB_eWiseAdd (AS, NULL, NULL, GrB_ONEB_BOOL, A, A, GrB_DESC_T1)) ;
+        OK (LAGraph_New (&S, &AS, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+        OK (LAGr_ConnectedComponents (&C2, S, msg)) ;
+
+        // create the directed graph G
+        OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+        TEST_CHECK (A == NULL) ;
+
+        // WCC with G->AT not cached: uses the push step with A
+        OK (LAGraph_WeaklyConnectedComponents (&C, G, msg)) ;
+        OK (LG_check_cc (C, S, msg)) ;
+        check_same (C, C2, n) ;
+        OK (GrB_free (&C)) ;
+
+        // WCC with G->AT cached
+        OK (LAGraph_Cached_AT (G, msg)) ;
+        OK (LAGraph_WeaklyConnectedComponents (&C, G, msg)) ;
+        OK (LG_check_cc (C, S, msg)) ;
+        check_same (C, C2, n) ;
+        OK (GrB_free (&C)) ;
+
+        // WCC with a symmetric structure: uses LAGr_ConnectedComponents
+        OK (LAGraph_Cached_IsSymmetricStructure (G, msg)) ;
+        if (G->is_symmetric_structure == LAGraph_TRUE)
+        {
+            printf ("structure is symmetric\n") ;
+            OK (LAGraph_WeaklyConnectedComponents (&C, G, msg)) ;
+            check_same (C, C2, n) ;
+            OK (GrB_free (&C)) ;
+        }
+
+        OK (GrB_free (&C2)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+        OK (LAGraph_Delete (&S, msg)) ;
+    }
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_wcc_errors
+//------------------------------------------------------------------------------
+
+void test_wcc_errors (void)
+{
+    OK (LAGraph_Init (msg)) ;
+    int result = LAGraph_WeaklyConnectedComponents (NULL, NULL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    FILE *f = fopen (LG_DATA_DIR "west0067.mtx", "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+    result = LAGraph_WeaklyConnectedComponents (NULL, G, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// TEST_LIST: the list of tasks for this entire test
+//------------------------------------------------------------------------------
+
+TEST_LIST =
+{
+    {"wcc", test_wcc},
+    {"wcc_errors", test_wcc_errors},
+    {NULL, NULL}
+} ;
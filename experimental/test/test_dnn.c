@@ -162,6 +162,51 @@ void test_dnn (void)
     OK (LAGraph_Vector_IsEqual (&isequal, TrueCategories, Categories, NULL)) ;
     TEST_CHECK (isequal) ;
 
+    //--------------------------------------------------------------------------
+    // solve it again with the GraphBLAS method, and check the result
+    //--------------------------------------------------------------------------
+
+    // The fused method is used only if all matrices are GrB_FP32, so a
+    // GrB_FP64 bias matrix forces the use of the generic method.
+    GrB_Matrix Bias64 = NULL, Bias0 = Bias [0] ;
+    OK (GrB_Matrix_new (&Bias64, GrB_FP64, nneurons, nneurons)) ;
+    OK (GrB_assign (Bias64, NULL, NULL, Bias0, GrB_ALL, nneurons, GrB_ALL,
+        nneurons, NULL)) ;
+    Bias [0] = Bias64 ;
+    GrB_free (&Y) ;
+    OK (LAGraph_dnn (&Y, W, Bias, nlayers, Y0)) ;
+    Bias [0] = Bias0 ;
+    GrB_free (&Bias64) ;
+    OK (GrB_reduce (C, NULL, NULL, GrB_PLUS_FP32, Y, NULL));
+    OK (GrB_Vector_clear (Categories)) ;
+    OK (GrB_apply (Categories, NULL, NULL, GrB_ONEB_BOOL, C, (bool) true,
+        NULL)) ;
+    OK (LAGraph_Vector_IsEqual (&isequal, TrueCategories, Categories, NULL)) ;
+    TEST_CHECK (isequal) ;
+
+    //--------------------------------------------------------------------------
+    // inputs that are not sparse CSR are used by the fused method unchanged
+    //--------------------------------------------------------------------------
+
+    #if LAGRAPH_SUITESPARSE
+    OK (GxB_set (W [0], GxB_FORMAT, GxB_BY_COL)) ;
+    OK (GxB_set (Y0, GxB_SPARSITY_CONTROL, GxB_BITMAP)) ;
+    GrB_free (&Y) ;
+    OK (LAGraph_dnn (&Y, W, Bias, nlayers, Y0)) ;
+    GxB_Format_Value fmt ;
+    int sparsity ;
+    OK (GxB_get (W [0], GxB_FORMAT, &fmt)) ;
+    TEST_CHECK (fmt == GxB_BY_COL) ;
+    OK (GxB_get (Y0, GxB_SPARSITY_STATUS, &sparsity)) ;
+    TEST_CHECK (sparsity == GxB_BITMAP) ;
+    OK (GrB_reduce (C, NULL, NULL, GrB_PLUS_FP32, Y, NULL));
+    OK (GrB_Vector_clear (Categories)) ;
+    OK (GrB_apply (Categories, NULL, NULL, GrB_ONEB_BOOL, C, (bool) true,
+        NULL)) ;
+    OK (LAGraph_Vector_IsEqual (&isequal, TrueCategories, Categories, NULL)) ;
+    TEST_CHECK (isequal) ;
+    #endif
+
     //--------------------------------------------------------------------------
     // free everything and finish the test
     //--------------------------------------------------------------------------
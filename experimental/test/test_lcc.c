@@ -183,6 +183,54 @@ void test_lcc (void)
         OK (LAGraph_Vector_Print (c, pr, stdout, msg)) ;
         OK (GrB_free (&c)) ;
 
+        // compare with LAGraph_LocalClusteringCoefficient, which ignores the
+        // values of A
+        OK (LAGraph_lcc (&c, G->A, symmetric, true, t, msg)) ;
+        if (G->nself_edges != 0)
+        {
+            OK (LAGraph_DeleteSelfEdges (G, msg)) ;
+        }
+        if (symmetric)
+        {
+            OK (LAGraph_Cached_IsSymmetricStructure (G, msg)) ;
+            TEST_CHECK (G->is_symmetric_structure == LAGraph_TRUE) ;
+        }
+        GrB_Vector c2 = NULL ;
+        OK (LAGraph_LocalClusteringCoefficient (&c2, G, NULL, msg)) ;
+        GrB_Index nvals1, nvals2 ;
+        OK (GrB_Vector_nvals (&nvals1, c)) ;
+        OK (GrB_Vector_nvals (&nvals2, c2)) ;
+        TEST_CHECK (nvals1 == nvals2) ;
+        OK (GrB_eWiseAdd (c, NULL, NULL, GrB_MINUS_FP64, c, c2, NULL)) ;
+        OK (GrB_apply (c, NULL, NULL, GrB_ABS_FP64, c, NULL)) ;
+        double err = 0 ;
+        OK (GrB_reduce (&err, NULL, GrB_MAX_MONOID_FP64, c, NULL)) ;
+        printf ("err vs LAGraph_LocalClusteringCoefficient: %g\n", err) ;
+        TEST_CHECK (err < 1e-12) ;
+        OK (GrB_free (&c)) ;
+
+        if (symmetric)
+        {
+            // again, with the per-node triangle counts given on input
+            GrB_Matrix X = NULL ;
+            GrB_Vector ntri = NULL ;
+            OK (GrB_Matrix_new (&X, GrB_INT64, n, n)) ;
+            OK (GrB_mxm (X, G->A, NULL, LAGraph_plus_one_int64, G->A, G->A,
+                GrB_DESC_S)) ;
+            OK (GrB_Vector_new (&ntri, GrB_INT64, n)) ;
+            OK (GrB_reduce (ntri, NULL, NULL, GrB_PLUS_MONOID_INT64, X, NULL)) ;
+            OK (GrB_apply (ntri, NULL, NULL, GrB_DIV_INT64, ntri, (int64_t) 2,
+                NULL)) ;
+            OK (LAGraph_LocalClusteringCoefficient (&c, G, ntri, msg)) ;
+            bool ok = false ;
+            OK (LAGraph_Vector_IsEqual (&ok, c, c2, msg)) ;
+            TEST_CHECK (ok) ;
+            OK (GrB_free (&c)) ;
+            OK (GrB_free (&X)) ;
+            OK (GrB_free (&ntri)) ;
+        }
+        OK (GrB_free (&c2)) ;
+
         OK (LAGraph_Delete (&G, msg)) ;
     }
 
@@ -217,6 +265,19 @@ void test_errors (void)
     printf ("\nresult: %d\n", result) ;
     TEST_CHECK (result == GrB_NULL_POINTER) ;
 
+    // lcc is NULL
+    result = LAGraph_LocalClusteringCoefficient (NULL, G, NULL, msg) ;
+    printf ("\nresult: %d\n", result) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    // G has self edges
+    G->nself_edges = 1 ;
+    result = LAGraph_LocalClusteringCoefficient (&c, G, NULL, msg) ;
+    printf ("\nresult: %d %s\n", result, msg) ;
+    TEST_CHECK (result == LAGRAPH_NO_SELF_EDGES_ALLOWED) ;
+    TEST_CHECK (c == NULL) ;
+    G->nself_edges = 0 ;
+
     #if LAGRAPH_SUITESPARSE
     // G->A is held by column
     OK (GxB_set (G->A, GxB_FORMAT, GxB_BY_COL)) ;
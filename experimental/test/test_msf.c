@@ -11,20 +11,19 @@
 
 //------------------------------------------------------------------------------
 
-// todo: write a simple msf method, as LG_check_msf, and compare its results
-// with LAGraph_msf
-
 #include <stdio.h>
 #include <acutest.h>
 
 #include <LAGraphX.h>
 #include <LAGraph_test.h>
+#include <LG_Xtest.h>
 
 char msg [LAGRAPH_MSG_LEN] ;
 LAGraph_Graph G = NULL ;
 GrB_Matrix A = NULL ;
 GrB_Matrix S = NULL ;
 GrB_Matrix C = NULL ;
+GrB_Matrix R = NULL ;
 #define LEN 512
 char filename [LEN+1] ;
 
@@ -50,6 +49,23 @@ const matrix_info files [ ] =
     { 0, "" },
 } ;
 
+//------------------------------------------------------------------------------
+// check_forest: compare the weight of the forest C with Kruskal's algorithm
+//------------------------------------------------------------------------------
+
+void check_forest (GrB_Matrix C, GrB_Matrix R, double tol)
+{
+    double w = 0, wgood = 0 ;
+    GrB_Index nedges = 0, nedges_good = 0 ;
+    OK (GrB_reduce (&w, NULL, GrB_PLUS_MONOID_FP64, C, NULL)) ;
+    OK (GrB_Matrix_nvals (&nedges, C)) ;
+    OK (LG_check_msf (&wgood, &nedges_good, R, msg)) ;
+    printf ("forest weight %g (%g edges), Kruskal: %g (%g edges)\n",
+        w, (double) nedges, wgood, (double) nedges_good) ;
+    TEST_CHECK (nedges == nedges_good) ;
+    TEST_CHECK (fabs (w - wgood) <= tol * fabs (wgood)) ;
+}
+
 //****************************************************************************
 void test_msf (void)
 {
@@ -84,37 +100,236 @@ void test_msf (void)
 
         bool sanitize = (!symmetric) ;
 
-        // compute the min spanning forest
-        C = NULL ;
-        int result = LAGraph_msf (&C, G->A, sanitize, msg) ;
-        printf ("result: %d\n", result) ;
-        LAGraph_PrintLevel pr = (n <= 100) ? LAGraph_COMPLETE : LAGraph_SHORT ;
+        // compute the forest with each method; A.mtx has unit weights, and
+        // both methods break ties in the same way
+        for (int m = 0 ; m <= LAGraph_msf_FilterKruskal ; m++)
+        {
+            // compute the min spanning forest
+            C = NULL ;
+            LAGraph_msf_Method method = m ;
+            int result = (m == LAGraph_msf_AutoMethod) ?
+                LAGraph_msf (&C, G->A, sanitize, msg) :
+                LAGraph_msf_ByMethod (&C, G->A, sanitize, &method, msg) ;
+            printf ("method %d, result: %d\n", m, result) ;
+            TEST_CHECK (result == GrB_SUCCESS) ;
+            TEST_CHECK (method == m) ;
+            LAGraph_PrintLevel pr = (n <= 100) ? LAGraph_COMPLETE
+                                               : LAGraph_SHORT ;
+
+            // check result C for A.mtx
+            if (strcmp (aname, "A.mtx") == 0)
+            {
+                GrB_Matrix Cgood = NULL ;
+                OK (GrB_Matrix_new (&Cgood, GrB_UINT64, n, n)) ;
+                OK (GrB_Matrix_setElement (Cgood, 1, 1, 0)) ;
+                OK (GrB_Matrix_setElement (Cgood, 1, 2, 0)) ;
+                OK (GrB_Matrix_setElement (Cgood, 1, 3, 1)) ;
+                OK (GrB_Matrix_setElement (Cgood, 1, 4, 1)) ;
+                OK (GrB_Matrix_setElement (Cgood, 1, 5, 1)) ;
+                OK (GrB_Matrix_setElement (Cgood, 1, 6, 0)) ;
+                OK (GrB_wait (Cgood, GrB_MATERIALIZE)) ;
+                printf ("\nmsf (known result):\n") ;
+                OK (LAGraph_Matrix_Print (Cgood, pr, stdout, msg)) ;
+                bool ok = false ;
+                OK (LAGraph_Matrix_IsEqual (&ok, C, Cgood, msg)) ;
+                TEST_CHECK (ok) ;
+                OK (GrB_free (&Cgood)) ;
+            }
+
+            printf ("\nmsf:\n") ;
+            OK (LAGraph_Matrix_Print (C, pr, stdout, msg)) ;
+
+            // compare with Kruskal's algorithm
+            if (sanitize)
+            {
+                OK (GrB_Matrix_new (&R, GrB_UINT64, n, n)) ;
+                OK (GrB_eWiseAdd (R, NULL, NULL, GrB_PLUS_UINT64, G->A, G->A,
+                    GrB_DESC_T1)) ;
+            }
+            else
+            {
+                OK (GrB_Matrix_dup (&R, G->A)) ;
+            }
+            check_forest (C, R, 0) ;
+
+            OK (GrB_free (&R)) ;
+            OK (GrB_free (&C)) ;
+        }
+
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_msf_types: test msf with weights of other types
+//------------------------------------------------------------------------------
+
+// The weights are constructed from the pattern of each symmetric matrix, and
+// exceed the 32-bit range or are negative.
+
+const char *weighted_files [ ] =
+{
+    "A.mtx",
+    "jagmesh7.mtx",
+    "bcsstk13.mtx",
+    "karate.mtx",
+    "ldbc-undirected-example.mtx",
+    ""
+} ;
 
-        // check result C for A.mtx
-        if (strcmp (aname, "A.mtx") == 0)
+void test_msf_types (void)
+{
+    LAGraph_Init (msg) ;
+
+    GrB_Type types [3] = { GrB_FP64, GrB_FP32, GrB_INT64 } ;
+    const char *typenames [3] = { "double", "float", "int64_t" } ;
+
+    for (int k = 0 ; ; k++)
+    {
+
+        // load the matrix as A
+        const char *aname = weighted_files [k] ;
+        if (strlen (aname) == 0) break;
+        TEST_CASE (aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+        GrB_Index n, nvals ;
+        OK (GrB_Matrix_nrows (&n, A)) ;
+        OK (GrB_Matrix_nvals (&nvals, A)) ;
+
+        // get the pattern of A
+        GrB_Index *I = NULL, *J = NULL ;
+        double *X = NULL ;
+        OK (LAGraph_Malloc ((void **) &I, nvals, sizeof (GrB_Index), msg)) ;
+        OK (LAGraph_Malloc ((void **) &J, nvals, sizeof (GrB_Index), msg)) ;
+        OK (LAGraph_Malloc ((void **) &X, nvals, sizeof (double), msg)) ;
+        OK (GrB_Matrix_extractTuples_FP64 (I, J, X, &nvals, A)) ;
+        OK (GrB_free (&A)) ;
+
+        for (int t = 0 ; t < 3 ; t++)
         {
-            GrB_Matrix Cgood = NULL ;
-            OK (GrB_Matrix_new (&Cgood, GrB_UINT64, n, n)) ;
-            OK (GrB_Matrix_setElement (Cgood, 1, 1, 0)) ;
-            OK (GrB_Matrix_setElement (Cgood, 1, 2, 0)) ;
-            OK (GrB_Matrix_setElement (Cgood, 1, 3, 1)) ;
-            OK (GrB_Matrix_setElement (Cgood, 1, 4, 1)) ;
-            OK (GrB_Matrix_setElement (Cgood, 1, 5, 1)) ;
-            OK (GrB_Matrix_setElement (Cgood, 1, 6, 0)) ;
-            OK (GrB_wait (Cgood, GrB_MATERIALIZE)) ;
-            printf ("\nmsf (known result):\n") ;
-            OK (LAGraph_Matrix_Print (Cgood, pr, stdout, msg)) ;
-            bool ok = false ;
-            OK (LAGraph_Matrix_IsEqual (&ok, C, Cgood, msg)) ;
-            TEST_CHECK (ok) ;
+            printf ("\n%s with %s weights:\n", aname, typenames [t]) ;
+
+            // construct symmetric weights of the given type
+            for (GrB_Index p = 0 ; p < nvals ; p++)
+            {
+                GrB_Index i = I [p], j = J [p] ;
+                switch (t)
+                {
+                    case 0 :    // large weights with fractional parts
+                        X [p] = 1e12 * (1 + (i+j) % 7) + 0.5 * ((i*j) % 11) ;
+                        break ;
+                    case 1 :    // small weights, some negative
+                        X [p] = 0.25 * ((i+j) % 13) - 1.5 ;
+                        break ;
+                    default :   // large negative weights
+                        X [p] = -3e9 * ((i*j) % 17) + (double) (i+j) ;
+                        break ;
+                }
+            }
+            OK (GrB_Matrix_new (&S, GrB_FP64, n, n)) ;
+            OK (GrB_Matrix_build_FP64 (S, I, J, X, nvals, GrB_PLUS_FP64)) ;
+            OK (GrB_Matrix_new (&R, types [t], n, n)) ;
+            OK (GrB_assign (R, NULL, NULL, S, GrB_ALL, n, GrB_ALL, n, NULL)) ;
+            OK (GrB_free (&S)) ;
+
+            for (int m = 0 ; m <= LAGraph_msf_FilterKruskal ; m++)
+            {
+                // compute the min spanning forest
+                LAGraph_msf_Method method = m ;
+                OK (LAGraph_msf_ByMethod (&C, R, false, &method, msg)) ;
+                if (m == LAGraph_msf_AutoMethod)
+                {
+                    // the selected method is returned
+                    TEST_CHECK (method == LAGraph_msf_Boruvka ||
+                                method == LAGraph_msf_FilterKruskal) ;
+                }
+                else
+                {
+                    TEST_CHECK (method == m) ;
+                }
+
+                // C has the same type as the weights
+                char ctype [LAGRAPH_MAX_NAME_LEN] ;
+                OK (LAGraph_Matrix_TypeName (ctype, C, msg)) ;
+                TEST_CHECK (strcmp (ctype, typenames [t]) == 0) ;
+
+                // compare with Kruskal's algorithm
+                check_forest (C, R, (t == 1) ? 1e-5 : 1e-12) ;
+                OK (GrB_free (&C)) ;
+            }
+            OK (GrB_free (&R)) ;
         }
 
-        printf ("\nmsf:\n") ;
-        OK (LAGraph_Matrix_Print (C, pr, stdout, msg)) ;
+        OK (LAGraph_Free ((void **) &I, msg)) ;
+        OK (LAGraph_Free ((void **) &J, msg)) ;
+        OK (LAGraph_Free ((void **) &X, msg)) ;
+    }
+
+    LAGraph_Finalize (msg) ;
+}
+
+//------------------------------------------------------------------------------
+// test_msf_large: test Filter-Kruskal on a graph larger than its base case
+//------------------------------------------------------------------------------
+
+// The graph has more than LG_BASECASE edges, so Filter-Kruskal partitions,
+// filters, and recurses before switching to Kruskal's method.  The weights
+// have many ties.
+
+void test_msf_large (void)
+{
+    LAGraph_Init (msg) ;
+
+    GrB_Index n = 20000, nvals ;
+    OK (LAGraph_Random_GNM (&G, n, 120000, true, 42, msg)) ;
+    OK (GrB_Matrix_nvals (&nvals, G->A)) ;
+    // more edges than LG_BASECASE, with an average degree of 16 or less
+    TEST_CHECK (nvals / 2 > 65536) ;
+    TEST_CHECK (nvals <= 16 * n) ;
+
+    // R(i,j) = R(j,i) = 1 + ((i*j) % 1009) + ((i+j) % 7)
+    GrB_Index *I = NULL, *J = NULL ;
+    uint64_t *X = NULL ;
+    OK (LAGraph_Malloc ((void **) &I, nvals, sizeof (GrB_Index), msg)) ;
+    OK (LAGraph_Malloc ((void **) &J, nvals, sizeof (GrB_Index), msg)) ;
+    OK (LAGraph_Malloc ((void **) &X, nvals, sizeof (uint64_t), msg)) ;
+    OK (GrB_Matrix_extractTuples_BOOL (I, J, NULL, &nvals, G->A)) ;
+    for (GrB_Index p = 0 ; p < nvals ; p++)
+    {
+        X [p] = 1 + ((I [p] * J [p]) % 1009) + ((I [p] + J [p]) % 7) ;
+    }
+    OK (GrB_Matrix_new (&R, GrB_UINT64, n, n)) ;
+    OK (GrB_Matrix_build_UINT64 (R, I, J, X, nvals, GrB_PLUS_UINT64)) ;
+    OK (LAGraph_Free ((void **) &I, msg)) ;
+    OK (LAGraph_Free ((void **) &J, msg)) ;
+    OK (LAGraph_Free ((void **) &X, msg)) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+
+    // the forest found by each method has the same total weight
+    double w [3] ;
+    for (int m = 0 ; m <= LAGraph_msf_FilterKruskal ; m++)
+    {
+        LAGraph_msf_Method method = m ;
+        OK (LAGraph_msf_ByMethod (&C, R, false, &method, msg)) ;
+        if (m == LAGraph_msf_AutoMethod)
+        {
+            // the graph is sparse
+            TEST_CHECK (method == LAGraph_msf_FilterKruskal) ;
+        }
+        OK (GrB_reduce (&(w [m]), NULL, GrB_PLUS_MONOID_FP64, C, NULL)) ;
+        check_forest (C, R, 0) ;
         OK (GrB_free (&C)) ;
-        OK (LAGraph_Delete (&G, msg)) ;
     }
+    TEST_CHECK (w [LAGraph_msf_FilterKruskal] == w [LAGraph_msf_Boruvka]) ;
+    TEST_CHECK (w [LAGraph_msf_AutoMethod] == w [LAGraph_msf_Boruvka]) ;
 
+    OK (GrB_free (&R)) ;
     LAGraph_Finalize (msg) ;
 }
 
@@ -135,6 +350,11 @@ void test_errors (void)
     result = LAGraph_msf (&C, A, true, msg) ;
     TEST_CHECK (result == GrB_DIMENSION_MISMATCH) ;
 
+    // invalid method
+    LAGraph_msf_Method method = 42 ;
+    result = LAGraph_msf_ByMethod (&C, A, true, &method, msg) ;
+    TEST_CHECK (result == GrB_INVALID_VALUE) ;
+
     OK (GrB_free (&A)) ;
     LAGraph_Finalize (msg) ;
 }
@@ -143,6 +363,8 @@ void test_errors (void)
 
 TEST_LIST = {
     {"msf", test_msf},
+    {"msf_types", test_msf_types},
+    {"msf_large", test_msf_large},
     {"msf_errors", test_errors},
     {NULL, NULL}
 };
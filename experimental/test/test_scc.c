@@ -11,14 +11,12 @@
 
 //------------------------------------------------------------------------------
 
-// todo: write a simple scc method, as LG_check_scc, and compare its results
-// with LAGraph_scc
-
 #include <stdio.h>
 #include <acutest.h>
 
 #include <LAGraphX.h>
 #include <LAGraph_test.h>
+#include <LG_Xtest.h>
 
 char msg [LAGRAPH_MSG_LEN] ;
 LAGraph_Graph G = NULL ;
@@ -140,13 +138,81 @@ void test_scc (void)
 
         printf ("\nscc:\n") ;
         OK (LAGraph_Vector_Print (c, pr, stdout, msg)) ;
+
+        // compare with Tarjan's algorithm
+        OK (LG_check_scc (c, G, msg)) ;
+        OK (GrB_free (&c)) ;
+
+        #if LAGRAPH_SUITESPARSE
+        // the input matrix may be held by column
+        GrB_Matrix A2 = NULL ;
+        OK (GrB_Matrix_dup (&A2, G->A)) ;
+        OK (GxB_set (A2, GxB_FORMAT, GxB_BY_COL)) ;
+        OK (LAGraph_scc (&c, A2, msg)) ;
+        OK (LG_check_scc (c, G, msg)) ;
         OK (GrB_free (&c)) ;
+        OK (GrB_free (&A2)) ;
+        #endif
+
         OK (LAGraph_Delete (&G, msg)) ;
     }
 
     LAGraph_Finalize (msg) ;
 }
 
+//------------------------------------------------------------------------------
+// test_scc_reentrant: compute SCCs of several matrices at the same time
+//------------------------------------------------------------------------------
+
+#define NCONCURRENT 4
+
+void test_scc_reentrant (void)
+{
+    LAGraph_Init (msg) ;
+
+    const char *names [NCONCURRENT] =
+    {
+        "west0067.mtx", "cryg2500.mtx", "olm1000.mtx", "cover.mtx"
+    } ;
+    LAGraph_Graph Gs [NCONCURRENT] ;
+    GrB_Vector cs [NCONCURRENT] ;
+    int results [NCONCURRENT] ;
+    char msgs [NCONCURRENT][LAGRAPH_MSG_LEN] ;
+
+    for (int k = 0 ; k < NCONCURRENT ; k++)
+    {
+        snprintf (filename, LEN, LG_DATA_DIR "%s", names [k]) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+        OK (LAGraph_New (&Gs [k], &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+        cs [k] = NULL ;
+    }
+
+    // each call has its own state, so the calls may run concurrently
+    #pragma omp parallel for num_threads(NCONCURRENT) schedule(static,1)
+    for (int k = 0 ; k < NCONCURRENT ; k++)
+    {
+        results [k] = LAGraph_scc (&cs [k], Gs [k]->A, msgs [k]) ;
+    }
+
+    for (int k = 0 ; k < NCONCURRENT ; k++)
+    {
+        printf ("%s: result %d\n", names [k], results [k]) ;
+        #if LAGRAPH_SUITESPARSE
+        TEST_CHECK (results [k] == GrB_SUCCESS) ;
+        OK (LG_check_scc (cs [k], Gs [k], msg)) ;
+        #else
+        TEST_CHECK (results [k] == GrB_NOT_IMPLEMENTED) ;
+        #endif
+        OK (GrB_free (&cs [k])) ;
+        OK (LAGraph_Delete (&Gs [k], msg)) ;
+    }
+
+    LAGraph_Finalize (msg) ;
+}
+
 //------------------------------------------------------------------------------
 // test_errors
 //------------------------------------------------------------------------------
@@ -177,6 +243,7 @@ void test_errors (void)
 
 TEST_LIST = {
     {"scc", test_scc},
+    {"scc_reentrant", test_scc_reentrant},
     {"scc_errors", test_errors},
     {NULL, NULL}
 };
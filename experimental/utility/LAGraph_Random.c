@@ -11,7 +11,20 @@
 
 //------------------------------------------------------------------------------
 
-// A very simple thread-safe parallel pseudo-random nuumber generator.
+// A simple thread-safe parallel pseudo-random number generator, based on
+// SplitMix64 (see LG_Random64 in LG_internal.h).  The random value of each
+// entry is computed from the entry itself (its index, or its prior value), so
+// no state is shared between entries and any entry can be computed in
+// parallel with any other.  LAGraph_Random_Seed sets Seed(i) to
+// LG_Random64 (seed, i, 0), and LAGraph_Random_Next advances the counter of
+// each entry, so that after k calls Seed(i) is LG_Random64 (seed, i, k).  The
+// value of entry i in round k can thus also be computed directly, without
+// the Seed vector.
+
+// The two operators are defined with their source code if SuiteSparse:GraphBLAS
+// v8 or later is used, so that its JIT can inline them.  If the Seed vector is
+// full and of type GrB_UINT64, it is filled directly in parallel instead, and
+// no operator is used at all.
 
 // FUTURE: add LAGraph_Random_Init to LAGraph_Init,
 // and added LAGraph_Random_Finalize to LAGraph_Finalize.
@@ -19,41 +32,154 @@
 #include "LG_internal.h"
 #include "LAGraphX.h"
 
+#if LAGRAPH_SUITESPARSE
+#if GxB_IMPLEMENTATION >= GxB_VERSION (8,0,0)
+#define LG_RAND_JIT 1
+#endif
+#endif
+
 //------------------------------------------------------------------------------
-// LG_RAND macros
+// global operators
 //------------------------------------------------------------------------------
 
-// Generate the next seed
-#define LG_RAND_NEXT(seed) ((seed) * 1103515245 + 12345)
+// These operators can be shared by all threads in a user application, and
+// thus are safely declared as global objects.
 
-// extract a random 15-bit value from a seed (no longer used)
-// #define LG_RAND_15_MAX 32767 
-// #define LG_RAND_15(seed) (((seed)/65536) % (LG_RAND_15_MAX + 1))
+GrB_UnaryOp LG_rand_seed_op = NULL ;
+GrB_UnaryOp LG_rand_next_op = NULL ;
 
 //------------------------------------------------------------------------------
-// global operator
+// LG_rand_seed_f:  unary operator to construct the first seed
 //------------------------------------------------------------------------------
 
-// This operator can be shared by all threads in a user application, and thus
-// is safely declared as a global object.
+// z = f(x), where x = seed + (i+1)*LG_RANDOM_GAMMA for the entry i, so that
+// z = LG_Random64 (seed, i, 0).
 
-GrB_UnaryOp LG_rand_next_op = NULL ;
+void LG_rand_seed_f (void *z, const void *x)
+{
+    uint64_t seed = (*((uint64_t *) x)) ;
+    (*((uint64_t *) z)) = LG_rand_mix (LG_rand_mix (seed)) ;
+}
+
+#define LG_RAND_SEED_F_DEFN                                                 \
+"void LG_rand_seed_f (uint64_t *z, const uint64_t *x)                   \n" \
+"{                                                                      \n" \
+"    uint64_t t = (*x) ;                                                \n" \
+"    for (int k = 0 ; k < 2 ; k++)                                      \n" \
+"    {                                                                  \n" \
+"        t = (t ^ (t >> 30)) * 0xBF58476D1CE4E5B9ULL ;                  \n" \
+"        t = (t ^ (t >> 27)) * 0x94D049BB133111EBULL ;                  \n" \
+"        t = (t ^ (t >> 31)) ;                                          \n" \
+"    }                                                                  \n" \
+"    (*z) = t ;                                                         \n" \
+"}"
 
 //------------------------------------------------------------------------------
 // LG_rand_next_f:  unary operator to construct the next seed
 //------------------------------------------------------------------------------
 
-// z = f(x), where x is the old seed and z is the new seed.
+// z = f(x), where x = LG_Random64 (seed, i, k) is the old seed and
+// z = LG_Random64 (seed, i, k+1) is the new one.  The mix of x is undone to
+// recover key + k*LG_RANDOM_GAMMA, which is then advanced by one step.
 
 void LG_rand_next_f (void *z, const void *x)
 {
     uint64_t seed = (*((uint64_t *) x)) ;
-    seed = LG_RAND_NEXT (seed) ;
-    seed = LG_RAND_NEXT (seed) ;
-    seed = LG_RAND_NEXT (seed) ;
-    seed = LG_RAND_NEXT (seed) ;
-    seed = LG_RAND_NEXT (seed) ;
-    (*((uint64_t *) z)) = seed ;
+    (*((uint64_t *) z)) = LG_Random64_Next (seed) ;
+}
+
+#define LG_RAND_NEXT_F_DEFN                                                 \
+"void LG_rand_next_f (uint64_t *z, const uint64_t *x)                   \n" \
+"{                                                                      \n" \
+"    uint64_t t = (*x) ;                                                \n" \
+"    t = (t ^ (t >> 31) ^ (t >> 62)) * 0x319642B2D24D8EC3ULL ;          \n" \
+"    t = (t ^ (t >> 27) ^ (t >> 54)) * 0x96DE1B173F119089ULL ;          \n" \
+"    t = (t ^ (t >> 30) ^ (t >> 60)) + 0x9E3779B97F4A7C15ULL ;          \n" \
+"    t = (t ^ (t >> 30)) * 0xBF58476D1CE4E5B9ULL ;                      \n" \
+"    t = (t ^ (t >> 27)) * 0x94D049BB133111EBULL ;                      \n" \
+"    (*z) = (t ^ (t >> 31)) ;                                           \n" \
+"}"
+
+//------------------------------------------------------------------------------
+// LG_rand_full: fill or advance a full GrB_UINT64 Seed vector in parallel
+//------------------------------------------------------------------------------
+
+// If Seed is full and of type GrB_UINT64, it is unpacked and its values are
+// computed directly, in parallel, with a loop that the compiler can vectorize.
+// If first is true, Seed(i) = LG_Random64 (seed, i, 0); otherwise
+// Seed(i) = LG_Random64_Next (Seed(i)), which advances its counter.
+// If Seed is not a full GrB_UINT64 vector, it is not modified and done is
+// returned as false.
+
+#undef  LG_FREE_WORK
+#define LG_FREE_WORK LAGraph_Free ((void **) &Sx, NULL) ;
+
+static int LG_rand_full
+(
+    GrB_Vector Seed,
+    uint64_t seed,
+    bool first,
+    bool *done,
+    char *msg
+)
+{
+    uint64_t *Sx = NULL ;
+    (*done) = false ;
+
+    #if LAGRAPH_SUITESPARSE
+    {
+        GrB_Type type ;
+        GrB_Index n, nvals, Sx_size = 0 ;
+        GRB_TRY (GxB_Vector_type (&type, Seed)) ;
+        GRB_TRY (GrB_Vector_size (&n, Seed)) ;
+        GRB_TRY (GrB_Vector_nvals (&nvals, Seed)) ;
+        if (type != GrB_UINT64 || nvals != n || n == 0)
+        {
+            // Seed is not a full uint64 vector; use the unary operators
+            return (GrB_SUCCESS) ;
+        }
+
+        // this takes O(1) time and space
+        bool iso = false ;
+        GRB_TRY (GxB_Vector_unpack_Full (Seed, (void **) &Sx, &Sx_size, &iso,
+            NULL)) ;
+        if (iso && first)
+        {
+            // the seeds of all entries will differ
+            LAGraph_Free ((void **) &Sx, NULL) ;
+            LG_TRY (LAGraph_Malloc ((void **) &Sx, n, sizeof (uint64_t), msg)) ;
+            Sx_size = n * sizeof (uint64_t) ;
+            iso = false ;
+        }
+
+        int nthreads = LG_nthreads_outer * LG_nthreads_inner ;
+        int64_t ns = iso ? 1 : ((int64_t) n) ;
+        nthreads = (int) LAGRAPH_MIN (nthreads, 1 + ns / 65536) ;
+        if (first)
+        {
+            #pragma omp parallel for simd num_threads(nthreads) schedule(static)
+            for (int64_t i = 0 ; i < ns ; i++)
+            {
+                Sx [i] = LG_Random64 (seed, i, 0) ;
+            }
+        }
+        else
+        {
+            #pragma omp parallel for simd num_threads(nthreads) schedule(static)
+            for (int64_t i = 0 ; i < ns ; i++)
+            {
+                Sx [i] = LG_Random64_Next (Sx [i]) ;
+            }
+        }
+
+        // this takes O(1) time and space, and Sx is owned by Seed again
+        GRB_TRY (GxB_Vector_pack_Full (Seed, (void **) &Sx, Sx_size, iso,
+            NULL)) ;
+        (*done) = true ;
+    }
+    #endif
+
+    return (GrB_SUCCESS) ;
 }
 
 //------------------------------------------------------------------------------
@@ -63,15 +189,28 @@ void LG_rand_next_f (void *z, const void *x)
 #undef  LG_FREE_WORK
 #define LG_FREE_WORK                                        \
 {                                                           \
+    GrB_UnaryOp_free (&LG_rand_seed_op) ;                   \
     GrB_UnaryOp_free (&LG_rand_next_op) ;                   \
 }
 
 int LAGraph_Random_Init (char *msg)
 {
     LG_CLEAR_MSG ;
+    LG_rand_seed_op = NULL ;
     LG_rand_next_op = NULL ;
+    #if defined ( LG_RAND_JIT )
+    GRB_TRY (GxB_UnaryOp_new (&LG_rand_seed_op, LG_rand_seed_f,
+        GrB_UINT64, GrB_UINT64,
+        "LG_rand_seed_f", LG_RAND_SEED_F_DEFN)) ;
+    GRB_TRY (GxB_UnaryOp_new (&LG_rand_next_op, LG_rand_next_f,
+        GrB_UINT64, GrB_UINT64,
+        "LG_rand_next_f", LG_RAND_NEXT_F_DEFN)) ;
+    #else
+    GRB_TRY (GrB_UnaryOp_new (&LG_rand_seed_op, LG_rand_seed_f,
+        GrB_UINT64, GrB_UINT64)) ;
     GRB_TRY (GrB_UnaryOp_new (&LG_rand_next_op, LG_rand_next_f,
         GrB_UINT64, GrB_UINT64)) ;
+    #endif
     return (GrB_SUCCESS) ;
 }
 
@@ -116,23 +255,28 @@ int LAGraph_Random_Seed     // construct a random seed vector
     GrB_Vector T = NULL ;
     LG_ASSERT (Seed != NULL, GrB_NULL_POINTER) ;
 
-    // T = 1:n but only for entries present in the Seed vector.  This
-    // requires a typecast from int64 to uint64.
-    GrB_Index n ;
-    GRB_TRY (GrB_Vector_size (&n, Seed)) ;
-    GRB_TRY (GrB_Vector_new (&T, GrB_UINT64, n)) ;
-    GRB_TRY (GrB_Vector_apply_IndexOp_INT64 (T, NULL, NULL,
-        GrB_ROWINDEX_INT64, Seed, 1, NULL)) ;
-
-    // Seed = T * INT32_MAX
-    GRB_TRY (GrB_apply (Seed, NULL, NULL, GrB_TIMES_UINT64, T,
-        (uint64_t) INT32_MAX, NULL)) ;
-
-    // Seed = Seed + seed
-    GRB_TRY (GrB_apply (Seed, NULL, NULL, GrB_PLUS_UINT64, Seed, seed, NULL)) ;
-
-    // Seed = next (Seed)
-    GRB_TRY (GrB_Vector_apply (Seed, NULL, NULL, LG_rand_next_op, Seed, NULL)) ;
+    bool done ;
+    LG_TRY (LG_rand_full (Seed, seed, true, &done, msg)) ;
+    if (!done)
+    {
+        // T = 1:n but only for entries present in the Seed vector.  This
+        // requires a typecast from int64 to uint64.
+        GrB_Index n ;
+        GRB_TRY (GrB_Vector_size (&n, Seed)) ;
+        GRB_TRY (GrB_Vector_new (&T, GrB_UINT64, n)) ;
+        GRB_TRY (GrB_Vector_apply_IndexOp_INT64 (T, NULL, NULL,
+            GrB_ROWINDEX_INT64, Seed, 1, NULL)) ;
+
+        // Seed = T * LG_RANDOM_GAMMA + seed, with uint64 wrap-around
+        GRB_TRY (GrB_apply (Seed, NULL, NULL, GrB_TIMES_UINT64, T,
+            (uint64_t) LG_RANDOM_GAMMA, NULL)) ;
+        GRB_TRY (GrB_apply (Seed, NULL, NULL, GrB_PLUS_UINT64, Seed, seed,
+            NULL)) ;
+
+        // Seed = mix (mix (Seed))
+        GRB_TRY (GrB_Vector_apply (Seed, NULL, NULL, LG_rand_seed_op, Seed,
+            NULL)) ;
+    }
 
     #if defined ( COVERAGE )
     if (random_hack)
@@ -166,8 +310,13 @@ int LAGraph_Random_Next     // advance to next random vector
     // check inputs
     LG_CLEAR_MSG ;
     LG_ASSERT (Seed != NULL, GrB_NULL_POINTER) ;
-    // Seed = next (Seed)
-    GRB_TRY (GrB_Vector_apply (Seed, NULL, NULL, LG_rand_next_op, Seed, NULL)) ;
+    bool done ;
+    LG_TRY (LG_rand_full (Seed, 0, false, &done, msg)) ;
+    if (!done)
+    {
+        // Seed = next (Seed)
+        GRB_TRY (GrB_Vector_apply (Seed, NULL, NULL, LG_rand_next_op, Seed,
+            NULL)) ;
+    }
     return (GrB_SUCCESS) ;
 }
-
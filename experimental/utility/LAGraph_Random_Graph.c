@@ -0,0 +1,456 @@
+//------------------------------------------------------------------------------
+// LAGraph_Random_Graph: synthetic R-MAT, G(n,m), and Chung-Lu graphs
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2021 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+// See additional acknowledgments in the LICENSE file,
+// or contact permission@sei.cmu.edu for the full terms.
+
+//------------------------------------------------------------------------------
+
+// Three generators of synthetic graphs, for benchmarks at scales where the
+// graphs are too large to read from a file:
+
+//  LAGraph_Random_Kronecker: an R-MAT / Graph500 Kronecker graph with
+//      n = 2^scale nodes.  Each edge recursively picks one of the four
+//      quadrants of the adjacency matrix with probabilities a, b, c, and
+//      1-a-b-c, at each of the scale levels.  The nodes are then relabeled
+//      with a random permutation, so that the node ids do not reveal the
+//      degrees.  Graph500 and the GAP "kron" graphs use a = 0.57 and
+//      b = c = 0.19, with 16*n edges.
+
+//  LAGraph_Random_GNM: an Erdos-Renyi graph, with nedges edges whose two
+//      endpoints are chosen uniformly at random.  The GAP "urand" graphs use
+//      16*n edges.
+
+//  LAGraph_Random_ChungLu: a Chung-Lu graph whose expected degrees follow a
+//      power law with exponent gamma: the weight of node i is
+//      (i+1)^(-1/(gamma-1)), and each endpoint of each edge is node i with a
+//      probability proportional to its weight.  The nodes are then relabeled
+//      with a random permutation, as for LAGraph_Random_Kronecker.
+
+// In all three, the endpoints of edge k depend only on the seed and k (they
+// are computed with LG_Random64 (seed, k, counter)), so the edges are
+// generated in parallel and the graph is the same for any number of threads.
+// The edges are sampled with replacement: duplicate edges are combined and
+// self edges are removed, so the graph has at most nedges edges (at most
+// 2*nedges entries in G->A if symmetric is true).  If symmetric is true, the
+// pattern of A+A' is used and G is undirected; otherwise G is directed.
+// G->A is GrB_BOOL with all values true, and G->nself_edges is zero.
+
+#include "LG_internal.h"
+#include "LAGraphX.h"
+
+// counter of LG_Random64 used for the random relabeling of the nodes, which
+// differs from the counters used for the edges
+#define LG_RELABEL_COUNTER 64
+
+// a random double in the range [0,1) for (seed, k, counter)
+static inline double LG_rand_unit (uint64_t seed, uint64_t k, uint64_t counter)
+{
+    return ((double) (LG_Random64 (seed, k, counter) >> 11)
+        * (1.0 / 9007199254740992.0)) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_random_relabel: apply a random permutation to the edge endpoints
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_WORK
+#define LG_FREE_WORK                            \
+{                                               \
+    LAGraph_Free ((void **) &Key, NULL) ;       \
+    LAGraph_Free ((void **) &Perm, NULL) ;      \
+}
+
+static int LG_random_relabel
+(
+    // input/output:
+    GrB_Index *I,           // size m; I [k] = Newid [I [k]] on output
+    GrB_Index *J,           // size m; J [k] = Newid [J [k]] on output
+    // input:
+    int64_t m,
+    int64_t n,
+    uint64_t seed,
+    int nthreads,
+    char *msg
+)
+{
+    int64_t *Key = NULL, *Perm = NULL ;
+    LG_TRY (LAGraph_Malloc ((void **) &Key, n, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Perm, n, sizeof (int64_t), msg)) ;
+
+    // sort the nodes by a random key, with ties broken by the node id
+    int64_t i ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (i = 0 ; i < n ; i++)
+    {
+        Key [i] = (int64_t) LG_Random64 (seed, i, LG_RELABEL_COUNTER) ;
+        Perm [i] = i ;
+    }
+    LG_TRY (LG_msort2 (Key, Perm, n, msg)) ;
+
+    // Key [Perm [p]] = p is the new id of node Perm [p]
+    int64_t *Newid = Key ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (i = 0 ; i < n ; i++)
+    {
+        Newid [Perm [i]] = i ;
+    }
+
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (k = 0 ; k < m ; k++)
+    {
+        I [k] = Newid [I [k]] ;
+        J [k] = Newid [J [k]] ;
+    }
+
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_random_graph_build: build G from a list of edges
+//------------------------------------------------------------------------------
+
+// The edge list (I,J) is freed on output, whether or not an error occurs.
+
+#undef  LG_FREE_WORK
+#define LG_FREE_WORK                            \
+{                                               \
+    LAGraph_Free ((void **) I, NULL) ;          \
+    LAGraph_Free ((void **) J, NULL) ;          \
+    LAGraph_Free ((void **) &X, NULL) ;         \
+    GrB_free (&A) ;                             \
+}
+
+static int LG_random_graph_build
+(
+    // output:
+    LAGraph_Graph *G,
+    // input:
+    GrB_Index **I,          // size m, freed on output
+    GrB_Index **J,          // size m, freed on output
+    GrB_Index n,
+    GrB_Index m,
+    bool symmetric,
+    int nthreads,
+    char *msg
+)
+{
+    GrB_Matrix A = NULL ;
+    bool *X = NULL ;
+
+    //--------------------------------------------------------------------------
+    // A = sparse (I,J,true), combining duplicates
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_Matrix_new (&A, GrB_BOOL, n, n)) ;
+    #if LAGRAPH_SUITESPARSE
+    {
+        // build an iso matrix, with no array of values
+        GrB_Scalar one = NULL ;
+        GRB_TRY (GrB_Scalar_new (&one, GrB_BOOL)) ;
+        GrB_Info info = GrB_Scalar_setElement_BOOL (one, true) ;
+        if (info == GrB_SUCCESS)
+        {
+            info = GxB_Matrix_build_Scalar (A, *I, *J, one, m) ;
+        }
+        GrB_free (&one) ;
+        GRB_TRY (info) ;
+    }
+    #else
+    {
+        LG_TRY (LAGraph_Malloc ((void **) &X, LAGRAPH_MAX (m, 1),
+            sizeof (bool), msg)) ;
+        int64_t k ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < (int64_t) m ; k++)
+        {
+            X [k] = true ;
+        }
+        GRB_TRY (GrB_Matrix_build_BOOL (A, *I, *J, X, m, GrB_LOR)) ;
+        LAGraph_Free ((void **) &X, NULL) ;
+    }
+    #endif
+    LAGraph_Free ((void **) I, NULL) ;
+    LAGraph_Free ((void **) J, NULL) ;
+
+    //--------------------------------------------------------------------------
+    // remove self edges, and symmetrize if requested
+    //--------------------------------------------------------------------------
+
+    GRB_TRY (GrB_select (A, NULL, NULL, GrB_OFFDIAG, A, (int64_t) 0, NULL)) ;
+    if (symmetric)
+    {
+        // A = A | A'
+        GRB_TRY (GrB_eWiseAdd (A, NULL, NULL, GrB_LOR, A, A, GrB_DESC_T1)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // construct the graph
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_New (G, &A, symmetric ? LAGraph_ADJACENCY_UNDIRECTED :
+        LAGraph_ADJACENCY_DIRECTED, msg)) ;
+    (*G)->nself_edges = 0 ;
+
+    LG_FREE_WORK ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Random_Kronecker: R-MAT / Graph500 Kronecker graph
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_WORK
+#define LG_FREE_WORK                            \
+{                                               \
+    LAGraph_Free ((void **) &I, NULL) ;         \
+    LAGraph_Free ((void **) &J, NULL) ;         \
+}
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL                             \
+{                                               \
+    LG_FREE_WORK ;                              \
+    LAGraph_Delete (G, NULL) ;                  \
+}
+
+int LAGraph_Random_Kronecker
+(
+    // output:
+    LAGraph_Graph *G,       // the graph, with n = 2^scale nodes
+    // input:
+    int scale,              // log2 of the # of nodes, in the range 0 to 60
+    GrB_Index nedges,       // # of edges to generate
+    double a,               // probability of the top-left quadrant
+    double b,               // probability of the top-right quadrant
+    double c,               // probability of the bottom-left quadrant
+    bool symmetric,         // if true, G is undirected
+    uint64_t seed,          // random number seed
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Index *I = NULL, *J = NULL ;
+    LG_ASSERT (G != NULL, GrB_NULL_POINTER) ;
+    (*G) = NULL ;
+    LG_ASSERT_MSG (scale >= 0 && scale <= 60, GrB_INVALID_VALUE,
+        "scale must be in the range 0 to 60") ;
+    LG_ASSERT_MSG (a >= 0 && b >= 0 && c >= 0 && a + b + c <= 1,
+        GrB_INVALID_VALUE, "invalid quadrant probabilities") ;
+
+    int64_t n = ((int64_t) 1) << scale ;
+    int64_t m = (int64_t) nedges ;
+    int nthreads = LG_nthreads_outer * LG_nthreads_inner ;
+    nthreads = (int) LAGRAPH_MIN (nthreads, 1 + m / 4096) ;
+
+    //--------------------------------------------------------------------------
+    // generate the edges
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_Malloc ((void **) &I, LAGRAPH_MAX (m, 1),
+        sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &J, LAGRAPH_MAX (m, 1),
+        sizeof (GrB_Index), msg)) ;
+
+    const double ab = a + b, abc = a + b + c ;
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (k = 0 ; k < m ; k++)
+    {
+        GrB_Index i = 0, j = 0 ;
+        for (int level = 0 ; level < scale ; level++)
+        {
+            // pick the quadrant (ibit,jbit) at this level
+            double r = LG_rand_unit (seed, k, level) ;
+            GrB_Index ibit = (r >= ab) ;
+            GrB_Index jbit = (r >= a && r < ab) || (r >= abc) ;
+            i = (i << 1) | ibit ;
+            j = (j << 1) | jbit ;
+        }
+        I [k] = i ;
+        J [k] = j ;
+    }
+
+    LG_TRY (LG_random_relabel (I, J, m, n, seed, nthreads, msg)) ;
+
+    //--------------------------------------------------------------------------
+    // build the graph
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LG_random_graph_build (G, &I, &J, n, m, symmetric, nthreads, msg));
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Random_GNM: Erdos-Renyi graph with uniform random edges
+//------------------------------------------------------------------------------
+
+int LAGraph_Random_GNM
+(
+    // output:
+    LAGraph_Graph *G,       // the graph, with n nodes
+    // input:
+    GrB_Index n,            // # of nodes
+    GrB_Index nedges,       // # of edges to generate
+    bool symmetric,         // if true, G is undirected
+    uint64_t seed,          // random number seed
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Index *I = NULL, *J = NULL ;
+    LG_ASSERT (G != NULL, GrB_NULL_POINTER) ;
+    (*G) = NULL ;
+    LG_ASSERT_MSG (n > 0, GrB_INVALID_VALUE, "n must be > 0") ;
+
+    int64_t m = (int64_t) nedges ;
+    int nthreads = LG_nthreads_outer * LG_nthreads_inner ;
+    nthreads = (int) LAGRAPH_MIN (nthreads, 1 + m / 4096) ;
+
+    //--------------------------------------------------------------------------
+    // generate the edges
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_Malloc ((void **) &I, LAGRAPH_MAX (m, 1),
+        sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &J, LAGRAPH_MAX (m, 1),
+        sizeof (GrB_Index), msg)) ;
+
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (k = 0 ; k < m ; k++)
+    {
+        I [k] = LG_Random64 (seed, k, 0) % n ;
+        J [k] = LG_Random64 (seed, k, 1) % n ;
+    }
+
+    //--------------------------------------------------------------------------
+    // build the graph
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LG_random_graph_build (G, &I, &J, n, m, symmetric, nthreads, msg));
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Random_ChungLu: power-law graph with given expected degrees
+//------------------------------------------------------------------------------
+
+#undef  LG_FREE_WORK
+#define LG_FREE_WORK                            \
+{                                               \
+    LAGraph_Free ((void **) &I, NULL) ;         \
+    LAGraph_Free ((void **) &J, NULL) ;         \
+    LAGraph_Free ((void **) &W, NULL) ;         \
+}
+
+// return the node i with W [i-1] <= x < W [i], where W is the cumulative sum
+// of the weights
+static inline GrB_Index LG_rand_sample (const double *W, int64_t n, double x)
+{
+    int64_t lo = 0, hi = n - 1 ;
+    while (lo < hi)
+    {
+        int64_t mid = (lo + hi) / 2 ;
+        if (W [mid] > x)
+        {
+            hi = mid ;
+        }
+        else
+        {
+            lo = mid + 1 ;
+        }
+    }
+    return ((GrB_Index) lo) ;
+}
+
+int LAGraph_Random_ChungLu
+(
+    // output:
+    LAGraph_Graph *G,       // the graph, with n nodes
+    // input:
+    GrB_Index n,            // # of nodes
+    GrB_Index nedges,       // # of edges to generate
+    double gamma,           // power-law exponent of the degrees; > 1
+    bool symmetric,         // if true, G is undirected
+    uint64_t seed,          // random number seed
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    GrB_Index *I = NULL, *J = NULL ;
+    double *W = NULL ;
+    LG_ASSERT (G != NULL, GrB_NULL_POINTER) ;
+    (*G) = NULL ;
+    LG_ASSERT_MSG (n > 0, GrB_INVALID_VALUE, "n must be > 0") ;
+    LG_ASSERT_MSG (gamma > 1, GrB_INVALID_VALUE, "gamma must be > 1") ;
+
+    int64_t m = (int64_t) nedges ;
+    int nthreads = LG_nthreads_outer * LG_nthreads_inner ;
+    nthreads = (int) LAGRAPH_MIN (nthreads, 1 + m / 4096) ;
+
+    //--------------------------------------------------------------------------
+    // W = cumulative sum of the node weights
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_Malloc ((void **) &W, n, sizeof (double), msg)) ;
+    const double alpha = -1.0 / (gamma - 1.0) ;
+    int64_t i ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (i = 0 ; i < (int64_t) n ; i++)
+    {
+        W [i] = pow ((double) (i+1), alpha) ;
+    }
+    for (i = 1 ; i < (int64_t) n ; i++)
+    {
+        W [i] += W [i-1] ;
+    }
+    const double wtotal = W [n-1] ;
+
+    //--------------------------------------------------------------------------
+    // generate the edges
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_Malloc ((void **) &I, LAGRAPH_MAX (m, 1),
+        sizeof (GrB_Index), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &J, LAGRAPH_MAX (m, 1),
+        sizeof (GrB_Index), msg)) ;
+
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (k = 0 ; k < m ; k++)
+    {
+        I [k] = LG_rand_sample (W, n, wtotal * LG_rand_unit (seed, k, 0)) ;
+        J [k] = LG_rand_sample (W, n, wtotal * LG_rand_unit (seed, k, 1)) ;
+    }
+    LAGraph_Free ((void **) &W, NULL) ;
+
+    LG_TRY (LG_random_relabel (I, J, m, n, seed, nthreads, msg)) ;
+
+    //--------------------------------------------------------------------------
+    // build the graph
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LG_random_graph_build (G, &I, &J, n, m, symmetric, nthreads, msg));
+    return (GrB_SUCCESS) ;
+}
@@ -458,6 +458,175 @@ int LAGraph_Free            // free a block of memory and set p to NULL
     char *msg
 ) ;
 
+//------------------------------------------------------------------------------
+// LAGraph_Pool: a thread-caching memory pool
+//------------------------------------------------------------------------------
+
+/** LAGraph_Pool_malloc, LAGraph_Pool_calloc, LAGraph_Pool_realloc, and
+ * LAGraph_Pool_free: a memory pool that can be passed to LAGr_Init in place
+ * of malloc, calloc, realloc, and free.  Blocks of up to 1MB are rounded up to
+ * one of LAGRAPH_POOL_NCLASSES power-of-two size classes (32 bytes to 1MB),
+ * and freed blocks are kept in a per-thread cache for reuse by the next
+ * allocation of the same class.  The caches of all threads together hold at
+ * most LAGRAPH_POOL_MAX_CACHED bytes.  On Linux, blocks of 2MB or more are
+ * mapped directly and backed by transparent huge pages when possible.  For
+ * example:
+ *
+ *      LAGr_Init (GrB_NONBLOCKING, LAGraph_Pool_malloc, LAGraph_Pool_calloc,
+ *          LAGraph_Pool_realloc, LAGraph_Pool_free, msg) ;
+ */
+
+#define LAGRAPH_POOL_NCLASSES 16
+#define LAGRAPH_POOL_MAX_CACHED (16 << 20)
+
+LAGRAPH_PUBLIC void *LAGraph_Pool_malloc  (size_t size) ;
+LAGRAPH_PUBLIC void *LAGraph_Pool_calloc  (size_t nitems, size_t itemsize) ;
+LAGRAPH_PUBLIC void *LAGraph_Pool_realloc (void *p, size_t size) ;
+LAGRAPH_PUBLIC void  LAGraph_Pool_free    (void *p) ;
+
+/** LAGraph_PoolStats: statistics of the memory pool.  nallocs [k] for k <
+ * LAGRAPH_POOL_NCLASSES is the # of allocations of size class k, which holds
+ * blocks of up to 2^(k+5) bytes.  nallocs [LAGRAPH_POOL_NCLASSES] is the # of
+ * larger blocks allocated with malloc, and nallocs [LAGRAPH_POOL_NCLASSES+1]
+ * is the # of blocks mapped with huge pages.
+ */
+
+typedef struct
+{
+    int64_t bytes_live ;    // # of bytes currently allocated by the user
+    int64_t bytes_peak ;    // max value of bytes_live so far
+    int64_t bytes_cached ;  // # of bytes in free blocks held in the caches
+    int64_t nallocs [LAGRAPH_POOL_NCLASSES+2] ; // # of allocations by class
+}
+LAGraph_PoolStats ;
+
+/** LAGraph_Pool_Stats: return the statistics of the memory pool.  The counts
+ * include all allocations done with the pool since the program started.
+ *
+ * @param[out] stats    statistics of the pool.
+ * @param[in,out] msg   any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if stats is NULL.
+ */
+
+LAGRAPH_PUBLIC
+int LAGraph_Pool_Stats
+(
+    // output:
+    LAGraph_PoolStats *stats,
+    char *msg
+) ;
+
+/** LAGraph_Pool_Trim: frees all blocks held in the caches of the memory pool,
+ * returning them to the C library, and frees the caches themselves.  It must not be called while other threads
+ * are allocating or freeing memory with the pool.  It is called by
+ * LAGraph_Finalize.
+ *
+ * @param[in,out] msg   any error messages.
+ *
+ * @retval GrB_SUCCESS in all cases.
+ */
+
+LAGRAPH_PUBLIC
+int LAGraph_Pool_Trim (char *msg) ;
+
+//------------------------------------------------------------------------------
+// LAGraph_MemoryStats: memory accounting
+//------------------------------------------------------------------------------
+
+/** LAGraph_MemoryTracking: enables or disables memory accounting.  It must be
+ * called before LAGraph_Init or LAGr_Init to take effect.  If enabled,
+ * LAGr_Init wraps the memory management functions it is given (or malloc,
+ * etc, for LAGraph_Init), and all memory allocated by LAGraph and GraphBLAS
+ * is counted.  Each LAGr_* algorithm also records the most memory it has
+ * allocated during one call, which can be queried with
+ * LAGraph_MemoryStats_Algorithm.  Accounting is disabled by default.
+ *
+ * @param[in] enable    if true, enable memory accounting.
+ * @param[in,out] msg   any error messages.
+ *
+ * @retval GrB_SUCCESS in all cases.
+ */
+
+LAGRAPH_PUBLIC
+int LAGraph_MemoryTracking
+(
+    // input:
+    bool enable,
+    char *msg
+) ;
+
+/** LAGraph_MemoryInfo: memory counts returned by LAGraph_MemoryStats.  Sizes
+ * are the # of bytes requested, not including any overhead of the allocator.
+ */
+
+typedef struct
+{
+    int64_t bytes_current ; // # of bytes currently allocated
+    int64_t bytes_peak ;    // max of bytes_current since the last reset
+    int64_t nallocs ;       // # of malloc and calloc calls
+    int64_t nfrees ;        // # of free calls
+    int64_t nreallocs ;     // # of realloc calls
+}
+LAGraph_MemoryInfo ;
+
+/** LAGraph_MemoryStats: returns the memory counts of LAGraph and GraphBLAS.
+ * All counts are zero if memory tracking was not enabled before LAGr_Init.
+ *
+ * @param[out] info     memory counts.
+ * @param[in,out] msg   any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if info is NULL.
+ */
+
+LAGRAPH_PUBLIC
+int LAGraph_MemoryStats
+(
+    // output:
+    LAGraph_MemoryInfo *info,
+    char *msg
+) ;
+
+/** LAGraph_MemoryStats_Algorithm: returns the memory high-water mark of an
+ * algorithm: the most memory allocated by any one call, above the memory
+ * allocated when the call started.  The algorithms currently recorded are
+ * LAGr_BreadthFirstSearch, LAGr_Betweenness, LAGr_ConnectedComponents,
+ * LAGr_PageRank, LAGr_SingleSourceShortestPath, and LAGr_TriangleCount.  If
+ * the algorithm has not been called, peak and ncalls are returned as zero.
+ *
+ * @param[out] peak         max # of bytes allocated by one call.
+ * @param[out] ncalls       # of calls recorded.
+ * @param[in] algorithm     name of the algorithm, such as "LAGr_PageRank".
+ * @param[in,out] msg       any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if any input or output is NULL.
+ */
+
+LAGRAPH_PUBLIC
+int LAGraph_MemoryStats_Algorithm
+(
+    // output:
+    int64_t *peak,
+    int64_t *ncalls,
+    // input:
+    const char *algorithm,
+    char *msg
+) ;
+
+/** LAGraph_MemoryStats_Reset: sets the peak to the current # of bytes
+ * allocated, and clears the call counts and the per-algorithm records.
+ *
+ * @param[in,out] msg   any error messages.
+ *
+ * @retval GrB_SUCCESS in all cases.
+ */
+
+LAGRAPH_PUBLIC
+int LAGraph_MemoryStats_Reset (char *msg) ;
+
 //==============================================================================
 // LAGraph data structures
 //==============================================================================
@@ -667,6 +836,18 @@ struct LAGraph_Graph_struct
 
     //@}
 
+    /** @name Memory Budget */
+    //@{
+
+    int64_t memory_budget ; ///< max # of bytes for G->A and its cached
+            ///< properties, or LAGRAPH_UNKNOWN (the default) if there is no
+            ///< budget.  If the budget is exceeded, LAGraph_Cached_AT,
+            ///< LAGraph_Cached_OutDegree, and LAGraph_Cached_InDegree free
+            ///< other cached properties, G->AT first, to stay within it.  See
+            ///< LAGraph_Graph_EnforceBudget.
+
+    //@}
+
     // FUTURE: possible future cached properties:
     // Some algorithms may want to know if the graph has any edge weights
     // exactly equal to zero.  In some cases, this can be inferred from the
@@ -893,6 +1074,273 @@ int LAGraph_Delete
     char *msg
 ) ;
 
+//------------------------------------------------------------------------------
+// LAGraph_Workspace: reusable workspace for algorithms
+//------------------------------------------------------------------------------
+
+/** LAGraph_Workspace: an opaque object that holds the work vectors of the
+ * algorithms that accept it (LAGr_BreadthFirstSearch_Workspace,
+ * LAGr_SingleSourceShortestPath_Workspace, and LAGr_PageRank_Workspace), so
+ * that many calls on graphs with the same number of nodes reuse the same
+ * vectors instead of creating and freeing them on each call.  With
+ * SuiteSparse:GraphBLAS, a dense work vector (such as the scores of
+ * PageRank) keeps its storage and is overwritten in place when reused, so a
+ * warm workspace allocates no memory for its entries.  A sparse work vector
+ * is cleared when reused, which frees its entries; only the vector object is
+ * saved.  Vectors returned as results are removed from the workspace.  The
+ * vectors are freed by LAGraph_Workspace_Free.  A workspace may be passed to
+ * any number of algorithms, one at a time, but not to two algorithms running
+ * at the same time in different user threads.  The results returned by the
+ * algorithms are owned by the caller.
+ */
+
+typedef struct LAGraph_Workspace_struct *LAGraph_Workspace ;
+
+/** LAGraph_Workspace_New: creates an empty workspace for graphs with n nodes.
+ *
+ * @param[out] W        the new workspace.
+ * @param[in] n         number of nodes of the graphs it will be used with.
+ * @param[in,out] msg   any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if W is NULL.
+ * @retval GrB_OUT_OF_MEMORY if out of memory.
+ */
+
+LAGRAPH_PUBLIC
+int LAGraph_Workspace_New
+(
+    // output:
+    LAGraph_Workspace *W,
+    // input:
+    GrB_Index n,
+    char *msg
+) ;
+
+/** LAGraph_Workspace_Free: frees a workspace and all the vectors it holds.
+ *
+ * @param[in,out] W     the workspace to free; NULL on output.
+ * @param[in,out] msg   any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+
+LAGRAPH_PUBLIC
+int LAGraph_Workspace_Free
+(
+    // input/output:
+    LAGraph_Workspace *W,
+    char *msg
+) ;
+
+//------------------------------------------------------------------------------
+// LAGraph_Stats: statistics of one run of an algorithm
+//------------------------------------------------------------------------------
+
+/** LAGraph_Stats: an object that holds the statistics of one run of an
+ * algorithm: its total time, the time of each phase, its memory high-water
+ * mark (if LAGraph_MemoryTracking is enabled), and, for each iteration (or
+ * BFS level), its time, the size of the frontier, the # of edges examined,
+ * the push/pull direction, and the convergence residual.  Values an algorithm
+ * does not compute are left unknown.
+ *
+ * Statistics are collected by making the object the current stats object of
+ * the calling thread with LAGraph_Stats_SetCurrent, or by attaching it to a
+ * workspace with LAGraph_Workspace_SetStats and passing the workspace to an
+ * algorithm (which takes precedence).  The algorithms that currently fill it
+ * are LAGr_BreadthFirstSearch, LAGr_SingleSourceShortestPath, and
+ * LAGr_PageRank (with or without a workspace), and LAGraph_cdlp and
+ * LAGraph_lcc.  Each run replaces the statistics of the previous one.  If an
+ * algorithm that fills it calls another one, the inner run is part of the
+ * outer one.  The object is not freed by LAGraph_Workspace_Free.
+ */
+
+typedef struct LAGraph_Stats_struct *LAGraph_Stats ;
+
+/** LAGraph_Stats_New: creates an empty stats object.
+ *
+ * @param[out] S        the new stats object.
+ * @param[in,out] msg   any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if S is NULL.
+ * @retval GrB_OUT_OF_MEMORY if out of memory.
+ */
+
+LAGRAPH_PUBLIC
+int LAGraph_Stats_New
+(
+    // output:
+    LAGraph_Stats *S,
+    char *msg
+) ;
+
+/** LAGraph_Stats_Free: frees a stats object.
+ *
+ * @param[in,out] S     the stats object to free; NULL on output.
+ * @param[in,out] msg   any error messages.
+ *
+ * @retval GrB_SUCCESS in all cases.
+ */
+
+LAGRAPH_PUBLIC
+int LAGraph_Stats_Free
+(
+    // input/output:
+    LAGraph_Stats *S,
+    char *msg
+) ;
+
+/** LAGraph_Workspace_SetStats: attaches a stats object to a workspace, so that
+ * algorithms given the workspace fill it in.  S may be NULL, to stop
+ * collecting statistics.
+ *
+ * @param[in,out] W     the workspace.
+ * @param[in] S         the stats object, or NULL.
+ * @param[in,out] msg   any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if W is NULL.
+ */
+
+LAGRAPH_PUBLIC
+int LAGraph_Workspace_SetStats
+(
+    // input/output:
+    LAGraph_Workspace W,
+    // input:
+    LAGraph_Stats S,
+    char *msg
+) ;
+
+/** LAGraph_Stats_SetCurrent: sets the current stats object of the calling
+ * thread, so that algorithms called by this thread fill it in, unless they
+ * are given a workspace with its own stats object.  S may be NULL, to stop
+ * collecting statistics.  Each user thread has its own current stats object,
+ * which is NULL by default.  LAGraph_Stats_Free clears it if it is the object
+ * being freed.
+ *
+ * @param[in] S         the stats object, or NULL.
+ * @param[in,out] msg   any error messages.
+ *
+ * @retval GrB_SUCCESS in all cases.
+ */
+
+LAGRAPH_PUBLIC
+int LAGraph_Stats_SetCurrent
+(
+    // input:
+    LAGraph_Stats S,
+    char *msg
+) ;
+
+/** LAGraph_Stats_JSON: prints the statistics as a JSON object, with the keys
+ * "algorithm", "time", "bytes_peak", "phases" (an object mapping each phase
+ * name to its time), and "iterations" (an array of objects with the keys
+ * "time", "frontier", "edges", "direction", and "residual").  Times are in
+ * seconds.  Unknown values are printed as null.
+ *
+ * @param[in] f         file to write to, already open.
+ * @param[in] S         the stats object.
+ * @param[in,out] msg   any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if f or S are NULL.
+ * @retval LAGRAPH_IO_ERROR if the file could not be written to.
+ */
+
+LAGRAPH_PUBLIC
+int LAGraph_Stats_JSON
+(
+    // input:
+    FILE *f,
+    const LAGraph_Stats S,
+    char *msg
+) ;
+
+//------------------------------------------------------------------------------
+// LAGraph_Tracing: a timeline of LAGraph and GraphBLAS calls
+//------------------------------------------------------------------------------
+
+/** LAGraph_Tracing: enables or disables tracing.  While tracing is enabled,
+ * each call to an LAGr_* algorithm, and each LAGraph and GraphBLAS call made
+ * inside LAGraph, is recorded as an event with its calling thread, start
+ * time, duration, status, and the # of threads LAGraph was set to use.  The
+ * events are written out by LAGraph_Trace_ChromeJSON or LAGraph_Trace_CSV.
+ * Disabling tracing keeps the events recorded so far.  Tracing is disabled by
+ * default, and then costs only a test of a global flag for each call.
+ *
+ * @param[in] enable    true to enable tracing, false to disable it.
+ * @param[in,out] msg   any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ */
+
+LAGRAPH_PUBLIC
+int LAGraph_Tracing
+(
+    // input:
+    bool enable,
+    char *msg
+) ;
+
+/** LAGraph_Trace_Clear: discards all events recorded so far.  It is called by
+ * LAGraph_Finalize.  It must not be called while other user threads are
+ * calling LAGraph.
+ *
+ * @param[in,out] msg   any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ */
+
+LAGRAPH_PUBLIC
+int LAGraph_Trace_Clear (char *msg) ;
+
+/** LAGraph_Trace_ChromeJSON: writes the events recorded so far in the Chrome
+ * trace event format, which can be viewed in chrome://tracing or
+ * ui.perfetto.dev.  Nested calls are shown as nested spans on the timeline of
+ * each thread.  It must not be called while other user threads are calling
+ * LAGraph.
+ *
+ * @param[in] f         file to write to, already open.
+ * @param[in,out] msg   any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if f is NULL.
+ * @retval LAGRAPH_IO_ERROR if the file could not be written to.
+ */
+
+LAGRAPH_PUBLIC
+int LAGraph_Trace_ChromeJSON
+(
+    // input:
+    FILE *f,
+    char *msg
+) ;
+
+/** LAGraph_Trace_CSV: writes the events recorded so far as a CSV table, with
+ * one line per event and the columns tid, category, name, start_us,
+ * duration_us, status, nthreads, file, line, and call.  Times are in
+ * microseconds since tracing was first enabled.  It must not be called while
+ * other user threads are calling LAGraph.
+ *
+ * @param[in] f         file to write to, already open.
+ * @param[in,out] msg   any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if f is NULL.
+ * @retval LAGRAPH_IO_ERROR if the file could not be written to.
+ */
+
+LAGRAPH_PUBLIC
+int LAGraph_Trace_CSV
+(
+    // input:
+    FILE *f,
+    char *msg
+) ;
+
 //------------------------------------------------------------------------------
 // LAGraph_DeleteCached: free any internal cached properties of a graph
 //------------------------------------------------------------------------------
@@ -918,6 +1366,75 @@ int LAGraph_DeleteCached
     char *msg
 ) ;
 
+//------------------------------------------------------------------------------
+// LAGraph_Graph_MemoryUsage: memory used by a graph and its cached properties
+//------------------------------------------------------------------------------
+
+/** LAGraph_GraphMemory: the # of bytes used by each component of a graph, as
+ * returned by LAGraph_Graph_MemoryUsage.  A component that is not present
+ * uses zero bytes.
+ */
+
+typedef struct
+{
+    size_t A ;          ///< G->A
+    size_t AT ;         ///< G->AT
+    size_t out_degree ; ///< G->out_degree
+    size_t in_degree ;  ///< G->in_degree
+    size_t emin ;       ///< G->emin
+    size_t emax ;       ///< G->emax
+    size_t total ;      ///< all of the above, and the graph struct itself
+}
+LAGraph_GraphMemory ;
+
+/** LAGraph_Graph_MemoryUsage: returns the memory used by G->A and each of the
+ * cached properties of G.  With SuiteSparse:GraphBLAS, the sizes are exact;
+ * otherwise, they are estimated from the number of entries of each object.
+ *
+ * @param[out] usage    the # of bytes used by each component of G.
+ * @param[in] G         graph to query.
+ * @param[in,out] msg   any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if usage or G are NULL.
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+
+LAGRAPH_PUBLIC
+int LAGraph_Graph_MemoryUsage
+(
+    // output:
+    LAGraph_GraphMemory *usage,
+    // input:
+    const LAGraph_Graph G,
+    char *msg
+) ;
+
+/** LAGraph_Graph_EnforceBudget: if the memory used by G exceeds
+ * G->memory_budget, cached properties are freed until it fits: G->AT first,
+ * then G->in_degree, then G->out_degree.  G->A, G->emin, and G->emax are
+ * never freed.  Nothing is done if G->memory_budget is LAGRAPH_UNKNOWN.  The
+ * budget is also enforced by LAGraph_Cached_AT, LAGraph_Cached_OutDegree, and
+ * LAGraph_Cached_InDegree, which never free the property they have just
+ * computed.  An algorithm that requires several cached properties should be
+ * given a graph whose budget can hold all of them.
+ *
+ * @param[in,out] G     graph to trim.
+ * @param[in,out] msg   any error messages.
+ *
+ * @retval GrB_SUCCESS if successful.
+ * @retval GrB_NULL_POINTER if G is NULL.
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+
+LAGRAPH_PUBLIC
+int LAGraph_Graph_EnforceBudget
+(
+    // input/output:
+    LAGraph_Graph G,
+    char *msg
+) ;
+
 //------------------------------------------------------------------------------
 // LAGraph_Cached_AT: construct G->AT for a graph
 //------------------------------------------------------------------------------
@@ -2072,6 +2589,48 @@ int LAGr_SortByDegree
     char *msg
 ) ;
 
+//------------------------------------------------------------------------------
+// LAGr_SortByDegreeBuckets: sort a graph by degree, and return degree buckets
+//------------------------------------------------------------------------------
+
+/** LAGr_SortByDegreeBuckets computes the same permutation P as
+ * LAGr_SortByDegree, and also returns the boundaries of its degree buckets.
+ * Bucket b is P [Bucket [b] ... Bucket [b+1]-1], for b = 0 to nbuckets-1,
+ * where nbuckets is one more than the maximum degree.  If ascending is true,
+ * bucket b holds all nodes of degree b; otherwise it holds all nodes of degree
+ * nbuckets-1-b.  Within each bucket, nodes are in ascending order.  The
+ * outputs &P and &Bucket must be freed by LAGraph_Free.
+ *
+ * @param[out] P        permutation of the integers 0..n-1.
+ * @param[out] Bucket   bucket boundaries, of size nbuckets+1.  If NULL, the
+ *                      bucket boundaries are not returned.
+ * @param[out] nbuckets number of buckets.  Ignored if NULL.
+ * @param[in] G         graph of n nodes.
+ * @param[in] byout     if true, sort by out-degree, else sort by in-degree.
+ * @param[in] ascending if true, sort in ascending order, else descending.
+ * @param[in,out] msg   any error messages.
+ *
+ * @retval GrB_NULL_POINTER if P or G are NULL.
+ * @retval LAGRAPH_NOT_CACHED if G->in_degree or G->out_degree is not computed
+ *      (whichever one is required).
+ * @retval LAGRAPH_INVALID_GRAPH if G is invalid (LAGraph_CheckGraph failed).
+ * @returns any GraphBLAS errors that may have been encountered.
+ */
+
+LAGRAPH_PUBLIC
+int LAGr_SortByDegreeBuckets
+(
+    // output:
+    int64_t **P,            // permutation vector of size n
+    int64_t **Bucket,       // bucket boundaries of size nbuckets+1, or NULL
+    int64_t *nbuckets,      // # of buckets (maximum degree + 1), or NULL
+    // input:
+    const LAGraph_Graph G,  // graph of n nodes
+    bool byout,             // if true, sort G->out_degree, else G->in_degree
+    bool ascending,         // sort in ascending or descending order
+    char *msg
+) ;
+
 //------------------------------------------------------------------------------
 // LAGr_SampleDegree: sample the degree median and mean
 //------------------------------------------------------------------------------
@@ -2157,6 +2716,26 @@ int LAGr_BreadthFirstSearch
     char *msg
 ) ;
 
+/** LAGr_BreadthFirstSearch_Workspace: identical to LAGr_BreadthFirstSearch,
+ * except that its work vectors are taken from the workspace W, if W is not
+ * NULL.  W must have been created for graphs with the same number of nodes as
+ * G (otherwise GrB_DIMENSION_MISMATCH is returned).  The level and parent
+ * vectors are not taken from W.
+ */
+
+LAGRAPH_PUBLIC
+int LAGr_BreadthFirstSearch_Workspace
+(
+    // output:
+    GrB_Vector *level,
+    GrB_Vector *parent,
+    // input:
+    const LAGraph_Graph G,
+    GrB_Index src,
+    LAGraph_Workspace W,    // optional workspace; may be NULL
+    char *msg
+) ;
+
 //------------------------------------------------------------------------------
 // LAGr_ConnectedComponents: connected components of an undirected graph
 //------------------------------------------------------------------------------
@@ -2235,6 +2814,26 @@ int LAGr_SingleSourceShortestPath
     char *msg
 ) ;
 
+/** LAGr_SingleSourceShortestPath_Workspace: identical to
+ * LAGr_SingleSourceShortestPath, except that its work vectors are taken from
+ * the workspace W, if W is not NULL.  W must have been created for graphs with
+ * the same number of nodes as G (otherwise GrB_DIMENSION_MISMATCH is
+ * returned).  The path_length vector is not taken from W.
+ */
+
+LAGRAPH_PUBLIC
+int LAGr_SingleSourceShortestPath_Workspace
+(
+    // output:
+    GrB_Vector *path_length,
+    // input:
+    const LAGraph_Graph G,
+    GrB_Index src,
+    GrB_Scalar Delta,           // delta value for delta stepping
+    LAGraph_Workspace W,        // optional workspace; may be NULL
+    char *msg
+) ;
+
 //------------------------------------------------------------------------------
 // LAGr_Betweenness: betweeness centrality metric
 //------------------------------------------------------------------------------
@@ -2314,6 +2913,28 @@ int LAGr_PageRank
     char *msg
 ) ;
 
+/** LAGr_PageRank_Workspace: identical to LAGr_PageRank, except that its work
+ * vectors are taken from the workspace W, if W is not NULL.  W must have been
+ * created for graphs with the same number of nodes as G (otherwise
+ * GrB_DIMENSION_MISMATCH is returned).  The centrality vector is not taken
+ * from W.
+ */
+
+LAGRAPH_PUBLIC
+int LAGr_PageRank_Workspace
+(
+    // output:
+    GrB_Vector *centrality,
+    int *iters,
+    // input:
+    const LAGraph_Graph G,
+    float damping,
+    float tol,
+    int itermax,
+    LAGraph_Workspace W,    // optional workspace; may be NULL
+    char *msg
+) ;
+
 //------------------------------------------------------------------------------
 // LAGr_PageRankGAP: GAP-style PageRank of a graph (for GAP benchmarking only)
 //------------------------------------------------------------------------------
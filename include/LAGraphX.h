@@ -77,6 +77,59 @@ GrB_Info LAGraph_Random_Matrix    // random matrix of any built-in type
     char *msg
 ) ;
 
+//------------------------------------------------------------------------------
+// synthetic graph generators
+//------------------------------------------------------------------------------
+
+// Each generator samples nedges edges in parallel, with a result that depends
+// only on the seed, not on the number of threads.  Duplicate edges are
+// combined, self edges are removed, and G is undirected (with the pattern of
+// A+A') if symmetric is true.  G->A is GrB_BOOL.
+
+LAGRAPH_PUBLIC
+int LAGraph_Random_Kronecker    // R-MAT / Graph500 Kronecker graph
+(
+    // output:
+    LAGraph_Graph *G,       // the graph, with n = 2^scale nodes
+    // input:
+    int scale,              // log2 of the # of nodes, in the range 0 to 60
+    GrB_Index nedges,       // # of edges to generate
+    double a,               // probability of the top-left quadrant
+    double b,               // probability of the top-right quadrant
+    double c,               // probability of the bottom-left quadrant
+                            // (Graph500: a = 0.57, b = c = 0.19)
+    bool symmetric,         // if true, G is undirected
+    uint64_t seed,          // random number seed
+    char *msg
+) ;
+
+LAGRAPH_PUBLIC
+int LAGraph_Random_GNM          // Erdos-Renyi graph
+(
+    // output:
+    LAGraph_Graph *G,       // the graph, with n nodes
+    // input:
+    GrB_Index n,            // # of nodes
+    GrB_Index nedges,       // # of edges to generate
+    bool symmetric,         // if true, G is undirected
+    uint64_t seed,          // random number seed
+    char *msg
+) ;
+
+LAGRAPH_PUBLIC
+int LAGraph_Random_ChungLu      // Chung-Lu power-law graph
+(
+    // output:
+    LAGraph_Graph *G,       // the graph, with n nodes
+    // input:
+    GrB_Index n,            // # of nodes
+    GrB_Index nedges,       // # of edges to generate
+    double gamma,           // power-law exponent of the degrees; > 1
+    bool symmetric,         // if true, G is undirected
+    uint64_t seed,          // random number seed
+    char *msg
+) ;
+
 //****************************************************************************
 // binary file I/O
 //****************************************************************************
@@ -313,6 +366,36 @@ int LAGraph_KTruss      // compute the k-truss of a graph
     char *msg
 ) ;
 
+//****************************************************************************
+/**
+ * Given a symmetric graph A with no-self edges, LAGraph_TrussDecomposition
+ * finds the truss number of each edge: the largest k such that the edge is in
+ * the k-truss of A.  The k-truss is the subgraph of edges with T(i,j) >= k.
+ * The support of each edge is computed once, and then updated incrementally
+ * as edges are peeled, so all k-trusses are found in about the time of one
+ * triangle count.
+ *
+ * @param[out]  T       truss numbers, of type GrB_UINT32, with the pattern
+ *                      of A.  Edges in no triangle have a truss number of 2.
+ * @param[out]  kmax    smallest k where k-truss is empty
+ * @param[in]   G       input graph, A, not modified.  Must be undirected
+ *                      or directed with symmetric structure, no self edges.
+ *
+ * @retval GrB_SUCCESS      if completed successfully
+ * @retval GrB_NULL_POINTER if T or kmax is NULL
+ * @return Any GraphBLAS errors that may have been encountered
+ */
+LAGRAPH_PUBLIC
+int LAGraph_TrussDecomposition
+(
+    // outputs:
+    GrB_Matrix *T,      // T(i,j) is the truss number of the edge (i,j)
+    int64_t *kmax,      // smallest k where the k-truss is empty
+    // input:
+    LAGraph_Graph G,    // input graph
+    char *msg
+) ;
+
 //****************************************************************************
 // Connected components
 //****************************************************************************
@@ -336,6 +419,185 @@ int LAGraph_cc_lacc (
     char *msg
 ) ;
 
+/**
+ * Determine the weakly connected components of a directed graph, without
+ * constructing A+A'.  G->AT is used if it is cached; otherwise the transpose
+ * of A is accessed with a push step (vxm) on G->A.  If the graph is undirected
+ * or has a symmetric structure, LAGr_ConnectedComponents is used instead.
+ *
+ * @param[out] component component(i)=r if node i is in the weakly connected
+ *                       component whose representative is r, the smallest
+ *                       node index in that component
+ * @param[in]  G         the graph (directed or undirected), not modified
+ *
+ * @retval GrB_SUCCESS         if completed successfully
+ * @retval GrB_NULL_POINTER    if component is NULL
+ * @retval GrB_NOT_IMPLEMENTED if G is unsymmetric and SuiteSparse:GraphBLAS
+ *                             is not in use
+ */
+LAGRAPH_PUBLIC
+int LAGraph_WeaklyConnectedComponents
+(
+    // output:
+    GrB_Vector *component,
+    // input:
+    const LAGraph_Graph G,
+    char *msg
+) ;
+
+//------------------------------------------------------------------------------
+// incremental connected components
+//------------------------------------------------------------------------------
+
+// LAGraph_IncrementalCC: the connected components of an undirected graph that
+// changes by edge insertions only.  The parent vector computed by
+// LAGr_ConnectedComponents is held as a union-find forest.  Batches of edge
+// insertions are merged into the forest in parallel, with a lock-free union
+// (the root with the larger index is linked to the root with the smaller
+// index) and path halving.  The representative of each component is thus
+// always its node with the smallest index, just as for
+// LAGr_ConnectedComponents.  If edges are deleted from the graph, the state
+// becomes stale and must be recomputed with LAGraph_IncrementalCC_Recompute.
+
+struct LAGraph_IncrementalCC_struct
+{
+    GrB_Index n ;           // # of nodes in the graph
+    uint64_t *parent ;      // size n, parent [i] is the parent of node i in
+                            // the union-find forest; parent [r] = r for the
+                            // representative node r of each component
+    int64_t ncomponents ;   // # of connected components
+} ;
+
+typedef struct LAGraph_IncrementalCC_struct *LAGraph_IncrementalCC ;
+
+/**
+ * Create the incremental connected components of a graph.
+ *
+ * @param[out]  State   the incremental state, created on output
+ * @param[in]   G       input graph; G->A must have a symmetric structure
+ *
+ * @retval GrB_SUCCESS      if completed successfully
+ * @retval GrB_NULL_POINTER if State is NULL
+ * @retval LAGRAPH_SYMMETRIC_STRUCTURE_REQUIRED if G->A is not known to be
+ *                          symmetric
+ */
+LAGRAPH_PUBLIC
+int LAGraph_IncrementalCC_New
+(
+    // output:
+    LAGraph_IncrementalCC *State,
+    // input:
+    LAGraph_Graph G,
+    char *msg
+) ;
+
+/**
+ * Recompute the incremental connected components from scratch, typically
+ * after edges have been deleted from the graph.  The graph must have the same
+ * number of nodes as when the State was created.
+ *
+ * @param[in,out]   State   the incremental state, modified on output
+ * @param[in]       G       input graph; G->A must have a symmetric structure
+ *
+ * @retval GrB_SUCCESS       if completed successfully
+ * @retval GrB_NULL_POINTER  if State is NULL
+ * @retval GrB_DIMENSION_MISMATCH if G has a different number of nodes
+ */
+LAGRAPH_PUBLIC
+int LAGraph_IncrementalCC_Recompute
+(
+    // input/output:
+    LAGraph_IncrementalCC State,
+    // input:
+    LAGraph_Graph G,
+    char *msg
+) ;
+
+/**
+ * Insert a batch of edges (I [k], J [k]) for k = 0 to nedges-1.  Since the
+ * graph is undirected, only one of the two entries of each edge needs to be
+ * given.  Duplicate edges, self-edges, and edges already present are allowed.
+ *
+ * @param[in,out]   State   the incremental state, modified on output
+ * @param[in]       I       size nedges, the first node of each edge
+ * @param[in]       J       size nedges, the second node of each edge
+ * @param[in]       nedges  # of edges to insert
+ *
+ * @retval GrB_SUCCESS       if completed successfully
+ * @retval GrB_NULL_POINTER  if State, I, or J are NULL
+ * @retval GrB_INVALID_INDEX if any node is out of range
+ */
+LAGRAPH_PUBLIC
+int LAGraph_IncrementalCC_Insert
+(
+    // input/output:
+    LAGraph_IncrementalCC State,
+    // input:
+    const GrB_Index *I,
+    const GrB_Index *J,
+    GrB_Index nedges,
+    char *msg
+) ;
+
+/**
+ * Find the representative of the component containing a node.
+ *
+ * @param[out]  rep     the representative node of the component of node i
+ * @param[in]   State   the incremental state (its forest may be compressed)
+ * @param[in]   i       the node to query
+ *
+ * @retval GrB_SUCCESS       if completed successfully
+ * @retval GrB_NULL_POINTER  if rep or State are NULL
+ * @retval GrB_INVALID_INDEX if i is out of range
+ */
+LAGRAPH_PUBLIC
+int LAGraph_IncrementalCC_Find
+(
+    // output:
+    GrB_Index *rep,
+    // input:
+    LAGraph_IncrementalCC State,
+    GrB_Index i,
+    char *msg
+) ;
+
+/**
+ * Return the component vector, in the same form as LAGr_ConnectedComponents.
+ * The forest in the State is flattened so that every node points directly to
+ * its representative.
+ *
+ * @param[out]  component   component(i)=r if node i is in component r, as a
+ *                          GrB_UINT64 vector
+ * @param[in]   State       the incremental state (its forest is flattened)
+ *
+ * @retval GrB_SUCCESS       if completed successfully
+ * @retval GrB_NULL_POINTER  if component or State are NULL
+ */
+LAGRAPH_PUBLIC
+int LAGraph_IncrementalCC_Component
+(
+    // output:
+    GrB_Vector *component,
+    // input:
+    LAGraph_IncrementalCC State,
+    char *msg
+) ;
+
+/**
+ * Free the incremental connected components state.
+ *
+ * @param[in,out]   State   the state to free; set to NULL on output
+ *
+ * @retval GrB_SUCCESS      in all cases
+ */
+LAGRAPH_PUBLIC
+int LAGraph_IncrementalCC_Free
+(
+    // input/output:
+    LAGraph_IncrementalCC *State,
+    char *msg
+) ;
+
 //****************************************************************************
 // Bellman Ford variants
 //****************************************************************************
@@ -626,7 +888,10 @@ GrB_Info LAGraph_BF_pure_c_double
  * @param[in]   sanitize     if true, verify that A is binary
  * @param[in]   itermax      max number of iterations (0 computes nothing)
  * @param[out]  t            array of two doubles allocated by caller:
- *                           [0]=sanitize time, [1]=cdlp time in seconds
+ *                           [0]=sanitize time, [1]=cdlp time in seconds.
+ *                           These are also recorded in the current stats
+ *                           object, if any (see LAGraph_Stats_SetCurrent),
+ *                           with the time of each iteration.
  *
  * @retval GrB_SUCCESS        if completed successfully
  * @retval GrB_NULL_POINTER   If t or CDLP_handle is NULL
@@ -677,15 +942,17 @@ GrB_Info LAGraph_dnn
 
 //****************************************************************************
 /**
- * Compute all-pairs shortest paths using Floyd-Warshall method
+ * Compute all-pairs shortest paths using a blocked Floyd-Warshall method.
+ * D(i,j) is the length of the shortest path from i to j, and is not present
+ * if j is not reachable from i.  D(i,i) < 0 if i is on a negative cycle.
  *
  * @param[in]   G       input graph, with edge weights
  * @param[out]  D       output graph, created on output
- * @param[out]  D_type  type of scalar stored in D (see source for explanation)
+ * @param[out]  D_type  type of scalar stored in D (see source for explanation):
+ *                      GrB_FP32, GrB_INT64, or GrB_FP64.
  *
  * @retval GrB_SUCCESS         if completed successfully
- * @retval GrB_NOT_IMPLEMENTED vanilla version has not been implemented yet
- * @retval GrB_NULL_POINTER    If D or D_type is NULL
+ * @retval GrB_NULL_POINTER    If G, D or D_type is NULL
  * @retval GrB_INVALID_VALUE   If G is not square
  */
 LAGRAPH_PUBLIC
@@ -705,7 +972,9 @@ GrB_Info LAGraph_FW
  * @param[in]   symmetric    denote whether the matrix is symmetric
  * @param[in]   sanitize     if true, verify that A is binary
  * @param[out]  t            array of two doubles
- *                           [0]=sanitize time, [1]=lcc time in seconds
+ *                           [0]=sanitize time, [1]=lcc time in seconds.
+ *                           These are also recorded in the current stats
+ *                           object, if any (see LAGraph_Stats_SetCurrent).
  *
  * @retval GrB_SUCCESS        if completed successfully
  * @retval GrB_NOT_IMPLEMENTED vanilla version has not been implemented yet
@@ -724,6 +993,38 @@ int LAGraph_lcc            // compute lcc for all nodes in A
     char *msg
 ) ;
 
+//****************************************************************************
+/**
+ * Compute the local clustering coefficient for all nodes in a graph, the same
+ * metric as LAGraph_lcc.  The values of G->A are ignored, so no sanitized copy
+ * of the matrix is needed.
+ *
+ * @param[out]    lcc   output vector of type GrB_FP64; lcc(v) is not present
+ *                      if v has fewer than two neighbors or no triangles
+ * @param[in,out] G     graph; G->out_degree and G->nself_edges are computed
+ *                      if not already cached.  G->AT is used if cached and
+ *                      G->A is not symmetric.
+ * @param[in]     ntri  optional: ntri(v) = # of edges between the neighbors
+ *                      of v (the # of triangles containing v, if G is
+ *                      undirected).  If NULL, it is computed.
+ *
+ * @retval GrB_SUCCESS        if completed successfully
+ * @retval GrB_NULL_POINTER   if lcc is NULL
+ * @retval LAGRAPH_NO_SELF_EDGES_ALLOWED if G has self edges
+ */
+LAGRAPH_PUBLIC
+int LAGraph_LocalClusteringCoefficient
+(
+    // output:
+    GrB_Vector *lcc,            // lcc (v) for each node v, of type GrB_FP64
+    // input/output:
+    LAGraph_Graph G,            // out_degree and nself_edges may be computed
+    // input:
+    const GrB_Vector ntri,      // optional: edges between neighbors of each
+                                // node; NULL to compute it
+    char *msg
+) ;
+
 //****************************************************************************
 
 LAGRAPH_PUBLIC
@@ -735,6 +1036,35 @@ int LAGraph_msf
     char *msg
 ) ;
 
+// LAGraph_msf_ByMethod: minimum spanning forest, with a choice of method.
+// Boruvka's method works on the matrix with GraphBLAS operations, in
+// O(log n) rounds.  The Filter-Kruskal method extracts the edges, partitions
+// them around a sampled pivot weight, and sorts them in parallel with
+// LG_msort3; it is fastest for sparse graphs and for graphs with few distinct
+// weights.  With LAGraph_msf_AutoMethod (or method == NULL), the method is
+// selected from the average degree and a sample of the weights, and the
+// selected method is returned in *method.  LAGraph_msf uses the automatic
+// selection.  The total weight of the forest does not depend on the method,
+// but if the weights have ties, the edges of the forest may differ.
+
+typedef enum
+{
+    LAGraph_msf_AutoMethod = 0,     // select the method automatically
+    LAGraph_msf_Boruvka = 1,        // Boruvka's method
+    LAGraph_msf_FilterKruskal = 2   // the Filter-Kruskal method
+}
+LAGraph_msf_Method ;
+
+LAGRAPH_PUBLIC
+int LAGraph_msf_ByMethod
+(
+    GrB_Matrix *result, // output: an unsymmetrical matrix, the spanning forest
+    GrB_Matrix A,       // input matrix
+    bool sanitize,      // if true, ensure A is symmetric
+    LAGraph_msf_Method *method, // input/output: method to use (NULL: auto)
+    char *msg
+) ;
+
 //****************************************************************************
 
 LAGRAPH_PUBLIC
@@ -757,6 +1087,24 @@ int LAGraph_VertexCentrality_Triangle       // vertex triangle-centrality
     char *msg
 ) ;
 
+//****************************************************************************
+LAGRAPH_PUBLIC
+int LAGraph_VertexCentrality_TriangleSubset
+(
+    // outputs:
+    GrB_Vector *centrality,     // centrality(i): triangle centrality of i,
+                                // for each node i in the subset
+    uint64_t *ntriangles,       // # of triangles in the graph
+    // input/output:
+    GrB_Matrix *Support,        // optional per-edge triangle support; computed
+                                // and returned if (*Support) is NULL
+    // inputs:
+    LAGraph_Graph G,            // input graph
+    const GrB_Index *vertices,  // list of nodes; NULL for all nodes
+    GrB_Index nvertices,        // # of entries in vertices
+    char *msg
+) ;
+
 //****************************************************************************
 LAGRAPH_PUBLIC
 int LAGraph_MaximalIndependentSet       // maximal independent set
@@ -773,6 +1121,76 @@ int LAGraph_MaximalIndependentSet       // maximal independent set
     char *msg
 ) ;
 
+//****************************************************************************
+// LAGraph_Coloring: parallel greedy vertex coloring
+//****************************************************************************
+
+// LAGraph_Coloring colors the nodes of a symmetric graph G with no self
+// edges, so that no two adjacent nodes have the same color.  In each round,
+// the uncolored nodes with a higher priority than all of their uncolored
+// neighbors are colored, as in LAGraph_MaximalIndependentSet.  With
+// LAGraph_Coloring_JonesPlassmann, the priorities are random; with
+// LAGraph_Coloring_LargestDegreeFirst, nodes of higher degree are colored
+// first.  If minimize is false, the nodes colored in round r get the color r.
+// If true, each node gets the smallest color not used by its neighbors, which
+// uses fewer colors.  On output, color is a full GrB_INT64 vector with values
+// in the range 1 to ncolors.  G->out_degree must be present.
+
+typedef enum
+{
+    LAGraph_Coloring_JonesPlassmann = 0,        // random priorities
+    LAGraph_Coloring_LargestDegreeFirst = 1     // largest degree first
+}
+LAGraph_Coloring_Method ;
+
+LAGRAPH_PUBLIC
+int LAGraph_Coloring
+(
+    // outputs:
+    GrB_Vector *color,          // color(i) is the color of node i
+    int64_t *ncolors,           // # of colors used
+    // inputs:
+    LAGraph_Graph G,            // input graph
+    LAGraph_Coloring_Method method,     // how to prioritize the nodes
+    bool minimize,              // if true, use first-fit to reduce the colors
+    uint64_t seed,              // random number seed
+    char *msg
+) ;
+
+//****************************************************************************
+// LAGraph_Matching: maximal and approximate maximum-weight matching
+//****************************************************************************
+
+// LAGraph_Matching finds a maximal matching of a graph G with a symmetric
+// structure, by matching the locally dominant edges in each round: those that
+// are the heaviest remaining edge of both of their nodes.  With
+// LAGraph_Matching_Luby, the edge weights are random, which is Luby's
+// maximal independent set algorithm on the line graph of G (the line graph is
+// not constructed).  With LAGraph_Matching_LocallyDominant, the edge weights
+// are the entries of G->A, and the result is a 1/2-approximate maximum weight
+// matching; edges with weight <= 0 are not matched.  On output, mate(i) = j if
+// (i,j) is in the matching, and nmatched is the number of matched edges.
+
+typedef enum
+{
+    LAGraph_Matching_Luby = 0,              // random edge weights
+    LAGraph_Matching_LocallyDominant = 1    // the edge weights of G->A
+}
+LAGraph_Matching_Method ;
+
+LAGRAPH_PUBLIC
+int LAGraph_Matching
+(
+    // outputs:
+    GrB_Vector *mate,           // mate(i) = j if (i,j) is in the matching
+    GrB_Index *nmatched,        // # of edges in the matching
+    // inputs:
+    LAGraph_Graph G,            // input graph
+    LAGraph_Matching_Method method,     // how to weight the edges
+    uint64_t seed,              // random number seed
+    char *msg
+) ;
+
 LAGRAPH_PUBLIC
 int LG_CC_FastSV5           // SuiteSparse:GraphBLAS method, with GxB extensions
 (
@@ -798,6 +1216,34 @@ int LAGraph_KCore_All
     char *msg
 ) ;
 
+// LAGraph_KCore_All_ByMethod: k-core decomposition, with a choice of method.
+// LAGraph_KCore_Peel uses GraphBLAS operations, and skips the levels at which
+// no vertex is removed.  LAGraph_KCore_Bucket is a parallel bucket-based
+// peeling that requires SuiteSparse:GraphBLAS; it temporarily unpacks G->A.
+// With LAGraph_KCore_AutoMethod (or method == NULL), the bucket method is used
+// if available, and the method used is returned in *method.  LAGraph_KCore_All
+// uses the automatic selection.
+
+typedef enum
+{
+    LAGraph_KCore_AutoMethod = 0,   // select the method automatically
+    LAGraph_KCore_Peel = 1,         // level-by-level peeling with GraphBLAS
+    LAGraph_KCore_Bucket = 2        // parallel bucket-based peeling
+}
+LAGraph_KCore_Method ;
+
+LAGRAPH_PUBLIC
+int LAGraph_KCore_All_ByMethod
+(
+    // outputs:
+    GrB_Vector *decomp,     // kcore decomposition
+    uint64_t *kmax,
+    // inputs:
+    LAGraph_Graph G,            // input graph
+    LAGraph_KCore_Method *method,   // input/output: method to use (NULL: auto)
+    char *msg
+) ;
+
 LAGRAPH_PUBLIC
 int LAGraph_KCore
 (
@@ -836,6 +1282,28 @@ int LAGraph_FastGraphletTransform
     char *msg
 ) ;
 
+// LAGraph_FastGraphletTransform_Range: computes the graphlet counts for the
+// vertices vfirst:vlast-1 only, and for a subset of the 16 orbits.  Column v
+// of F_net holds the counts for vertex vfirst+v; F_net has no entries for
+// zero counts or for orbits that were not requested.  A large graph can be
+// processed one range of vertices at a time, to bound the memory used.  The
+// K4 counts (orbit 15 and the orbits that depend on it) require SuiteSparse.
+
+LAGRAPH_PUBLIC
+int LAGraph_FastGraphletTransform_Range
+(
+    // outputs:
+    GrB_Matrix *F_net,  // 16-by-(vlast-vfirst) matrix of graphlet counts
+    // inputs:
+    LAGraph_Graph G,
+    bool compute_d_15,  // if false, the K4 counts d_15 are taken as zero
+    const bool *orbits, // size 16; orbits [k] true to compute orbit k, or
+                        // NULL to compute all 16 orbits
+    GrB_Index vfirst,   // F_net is computed for vertices vfirst:vlast-1
+    GrB_Index vlast,
+    char *msg
+) ;
+
 LAGRAPH_PUBLIC
 int LAGraph_SquareClustering
 (
@@ -846,6 +1314,22 @@ int LAGraph_SquareClustering
     char *msg
 ) ;
 
+// LAGraph_SquareClustering_Blocked: the same result as
+// LAGraph_SquareClustering, but computed one row of A*A' at a time in a
+// per-thread hash table, over blocks of nodes with balanced work, so that
+// A*A' is never formed.  Suited to graphs with a heavy-tailed degree
+// distribution.  G->out_degree is not required.
+
+LAGRAPH_PUBLIC
+int LAGraph_SquareClustering_Blocked
+(
+    // outputs:
+    GrB_Vector *square_clustering,
+    // inputs:
+    LAGraph_Graph G,
+    char *msg
+) ;
+
 //------------------------------------------------------------------------------
 // a simple example of an algorithm
 //------------------------------------------------------------------------------
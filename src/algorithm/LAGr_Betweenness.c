@@ -75,10 +75,10 @@
 #include "LG_internal.h"
 
 //------------------------------------------------------------------------------
-// LAGr_Betweenness: vertex betweenness-centrality
+// betweenness: vertex betweenness-centrality
 //------------------------------------------------------------------------------
 
-int LAGr_Betweenness
+static int betweenness
 (
     // output:
     GrB_Vector *centrality,     // centrality(i): betweeness centrality of i
@@ -314,3 +314,27 @@ int LAGr_Betweenness
     LG_FREE_WORK ;
     return (GrB_SUCCESS) ;
 }
+
+//------------------------------------------------------------------------------
+// LAGr_Betweenness: betweenness centrality, recording the memory used
+//------------------------------------------------------------------------------
+
+int LAGr_Betweenness
+(
+    // output:
+    GrB_Vector *centrality,     // centrality(i): betweeness centrality of i
+    // input:
+    LAGraph_Graph G,            // input graph
+    const GrB_Index *sources,   // source vertices to compute shortest paths
+    int32_t ns,                 // number of source vertices
+    char *msg
+)
+{
+    LG_TRACE_BEGIN (t0) ;
+    LG_memory_region region ;
+    LG_Memory_Begin (&region) ;
+    int status = betweenness (centrality, G, sources, ns, msg) ;
+    LG_Memory_End (&region, "LAGr_Betweenness") ;
+    LG_TRACE_END (t0, LG_TRACE_ALGORITHM, "LAGr_Betweenness", status) ;
+    return (status) ;
+}
@@ -32,11 +32,36 @@ int LAGr_BreadthFirstSearch
     char *msg
 )
 {
+    return LAGr_BreadthFirstSearch_Workspace (level, parent, G, src, NULL,
+        msg) ;
+}
+
+// The workspace W is used only by the SuiteSparse method.
 
+int LAGr_BreadthFirstSearch_Workspace
+(
+    // output:
+    GrB_Vector *level,
+    GrB_Vector *parent,
+    // input:
+    const LAGraph_Graph G,
+    GrB_Index src,
+    LAGraph_Workspace W,
+    char *msg
+)
+{
+    LG_TRACE_BEGIN (t0) ;
+    LG_memory_region region ;
+    LG_Memory_Begin (&region) ;
+    LAGraph_Stats S = LG_Stats_Get (W) ;
+    LG_Stats_Begin (S, "LAGr_BreadthFirstSearch") ;
 #if LAGRAPH_SUITESPARSE
-    return LG_BreadthFirstSearch_SSGrB   (level, parent, G, src, msg) ;
+    int status = LG_BreadthFirstSearch_SSGrB   (level, parent, G, src, W, msg);
 #else
-    return LG_BreadthFirstSearch_vanilla (level, parent, G, src, msg) ;
+    int status = LG_BreadthFirstSearch_vanilla (level, parent, G, src, msg) ;
 #endif
+    LG_Stats_End (S) ;
+    LG_Memory_End (&region, "LAGr_BreadthFirstSearch") ;
+    LG_TRACE_END (t0, LG_TRACE_ALGORITHM, "LAGr_BreadthFirstSearch", status) ;
+    return (status) ;
 }
-
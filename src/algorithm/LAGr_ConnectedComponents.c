@@ -28,11 +28,16 @@ int LAGr_ConnectedComponents
     char *msg
 )
 {
-
+    LG_TRACE_BEGIN (t0) ;
+    LG_memory_region region ;
+    LG_Memory_Begin (&region) ;
     #if LAGRAPH_SUITESPARSE
-    return (LG_CC_FastSV6 (component, G, msg)) ;
+    int status = LG_CC_FastSV6 (component, G, msg) ;
     #else
-    return (LG_CC_Boruvka (component, G, msg)) ;
+    int status = LG_CC_Boruvka (component, G, msg) ;
     #endif
+    LG_Memory_End (&region, "LAGr_ConnectedComponents") ;
+    LG_TRACE_END (t0, LG_TRACE_ALGORITHM, "LAGr_ConnectedComponents", status) ;
+    return (status) ;
 }
 
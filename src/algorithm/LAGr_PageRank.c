@@ -26,25 +26,35 @@
 // then G->A is used instead of G->AT, however.  G->out_degree must be computed
 // so that it contains no explicit zeros; as done by LAGraph_Cached_OutDegree.
 
-#define LG_FREE_WORK                \
-{                                   \
-    GrB_free (&d1) ;                \
-    GrB_free (&d) ;                 \
-    GrB_free (&t) ;                 \
-    GrB_free (&w) ;                 \
-    GrB_free (&sink) ;              \
-    GrB_free (&rsink) ;             \
+// LAGr_PageRank_Workspace is the same, except that the work vectors are taken
+// from the workspace W (if not NULL) and returned to it.  t and r are swapped
+// in each iteration; the one that holds the result is detached from W and
+// returned, and the other stays in W.  The dense vectors t, r, and d1 keep
+// their storage from one call to the next.
+
+// If statistics are collected (by a stats object attached to W, or set with
+// LAGraph_Stats_SetCurrent), the time and residual of each iteration are
+// recorded.
+
+#define LG_FREE_WORK                        \
+{                                           \
+    LG_Workspace_Release (W, &d1) ;         \
+    LG_Workspace_Release (W, &d) ;          \
+    LG_Workspace_Release (W, &t) ;          \
+    LG_Workspace_Release (W, &w) ;          \
+    LG_Workspace_Release (W, &sink) ;       \
+    LG_Workspace_Release (W, &rsink) ;      \
 }
 
 #define LG_FREE_ALL                 \
 {                                   \
     LG_FREE_WORK ;                  \
-    GrB_free (&r) ;                 \
+    LG_Workspace_Release (W, &r) ;  \
 }
 
 #include "LG_internal.h"
 
-int LAGr_PageRank
+static int pagerank
 (
     // output:
     GrB_Vector *centrality, // centrality(i): pagerank of node i
@@ -54,6 +64,7 @@ int LAGr_PageRank
     float damping,          // damping factor (typically 0.85)
     float tol,              // stopping tolerance (typically 1e-4) ;
     int itermax,            // maximum number of iterations (typically 100)
+    LAGraph_Workspace W,    // optional workspace; may be NULL
     char *msg
 )
 {
@@ -88,19 +99,26 @@ int LAGr_PageRank
     // initializations
     //--------------------------------------------------------------------------
 
-    GrB_Index n ;
+    LAGraph_Stats S = LG_Stats_Get (W) ;
+    double t0 = LAGraph_WallClockTime ( ) ;
+
+    GrB_Index n, nedges = 0 ;
     (*centrality) = NULL ;
     GRB_TRY (GrB_Matrix_nrows (&n, AT)) ;
+    if (S != NULL)
+    {
+        // each iteration examines all edges
+        GRB_TRY (GrB_Matrix_nvals (&nedges, AT)) ;
+    }
 
     const float damping_over_n = damping / n ;
     const float scaled_damping = (1 - damping) / n ;
     float rdiff = 1 ;       // first iteration is always done
 
     // r = 1 / n
-    GRB_TRY (GrB_Vector_new (&t, GrB_FP32, n)) ;
-    GRB_TRY (GrB_Vector_new (&r, GrB_FP32, n)) ;
-    GRB_TRY (GrB_Vector_new (&w, GrB_FP32, n)) ;
-    GRB_TRY (GrB_assign (r, NULL, NULL, (float) (1.0 / n), GrB_ALL, n, NULL)) ;
+    LG_TRY (LG_Workspace_Dense (&t, W, GrB_FP32, n, 0, msg)) ;
+    LG_TRY (LG_Workspace_Dense (&r, W, GrB_FP32, n, 1.0 / n, msg)) ;
+    LG_TRY (LG_Workspace_Vector (&w, W, GrB_FP32, n, msg)) ;
 
     // find all sinks, where sink(i) = true if node i has d_out(i)=0, or with
     // d_out(i) not present.  LAGraph_Cached_OutDegree computes d_out =
@@ -112,29 +130,31 @@ int LAGr_PageRank
     if (nsinks > 0)
     {
         // sink<!struct(d_out)> = true
-        GRB_TRY (GrB_Vector_new (&sink, GrB_BOOL, n)) ;
+        LG_TRY (LG_Workspace_Vector (&sink, W, GrB_BOOL, n, msg)) ;
         GRB_TRY (GrB_assign (sink, d_out, NULL, (bool) true, GrB_ALL, n,
             GrB_DESC_SC)) ;
-        GRB_TRY (GrB_Vector_new (&rsink, GrB_FP32, n)) ;
+        LG_TRY (LG_Workspace_Vector (&rsink, W, GrB_FP32, n, msg)) ;
     }
 
     // prescale with damping factor, so it isn't done each iteration
     // d = d_out / damping ;
-    GRB_TRY (GrB_Vector_new (&d, GrB_FP32, n)) ;
+    LG_TRY (LG_Workspace_Vector (&d, W, GrB_FP32, n, msg)) ;
     GRB_TRY (GrB_apply (d, NULL, NULL, GrB_DIV_FP32, d_out, damping, NULL)) ;
 
     // d1 = 1 / damping
     float dmin = 1.0 / damping ;
-    GRB_TRY (GrB_Vector_new (&d1, GrB_FP32, n)) ;
-    GRB_TRY (GrB_assign (d1, NULL, NULL, dmin, GrB_ALL, n, NULL)) ;
+    LG_TRY (LG_Workspace_Dense (&d1, W, GrB_FP32, n, dmin, msg)) ;
     // d = max (d1, d)
     GRB_TRY (GrB_eWiseAdd (d, NULL, NULL, GrB_MAX_FP32, d1, d, NULL)) ;
-    GrB_free (&d1) ;
+    LG_Workspace_Release (W, &d1) ;
 
     //--------------------------------------------------------------------------
     // pagerank iterations
     //--------------------------------------------------------------------------
 
+    double tstart = LAGraph_WallClockTime ( ), titer = tstart ;
+    LG_Stats_Phase (S, "setup", tstart - t0) ;
+
     for ((*iters) = 0 ; rdiff > tol ; (*iters)++)
     {
         // check for convergence
@@ -158,8 +178,8 @@ int LAGr_PageRank
         GrB_Vector temp = t ; t = r ; r = temp ;
         // w = t ./ d
         GRB_TRY (GrB_eWiseMult (w, NULL, NULL, GrB_DIV_FP32, t, d, NULL)) ;
-        // r = teleport
-        GRB_TRY (GrB_assign (r, NULL, NULL, teleport, GrB_ALL, n, NULL)) ;
+        // r = teleport, overwriting the old values of r in place
+        LG_TRY (LG_Vector_Fill (r, GrB_FP32, n, teleport, msg)) ;
         // r += A'*w
         GRB_TRY (GrB_mxv (r, NULL, GrB_PLUS_FP32, LAGraph_plus_second_fp32,
             AT, w, NULL)) ;
@@ -169,14 +189,71 @@ int LAGr_PageRank
         GRB_TRY (GrB_apply (t, NULL, NULL, GrB_ABS_FP32, t, NULL)) ;
         // rdiff = sum (t)
         GRB_TRY (GrB_reduce (&rdiff, NULL, GrB_PLUS_MONOID_FP32, t, NULL)) ;
+        double tnow = LAGraph_WallClockTime ( ) ;
+        LG_TRY (LG_Stats_Iteration (S, tnow - titer, -1, (int64_t) nedges, -1,
+            rdiff, msg)) ;
+        titer = tnow ;
     }
+    LG_Stats_Phase (S, "iterations", LAGraph_WallClockTime ( ) - tstart) ;
 
     //--------------------------------------------------------------------------
     // free workspace and return result
     //--------------------------------------------------------------------------
 
+    LG_Workspace_Detach (W, r) ;
     (*centrality) = r ;
     LG_FREE_WORK ;
     return (GrB_SUCCESS) ;
 }
 
+//------------------------------------------------------------------------------
+// LAGr_PageRank_Workspace: pagerank with an optional workspace
+//------------------------------------------------------------------------------
+
+int LAGr_PageRank_Workspace
+(
+    // output:
+    GrB_Vector *centrality, // centrality(i): pagerank of node i
+    int *iters,             // number of iterations taken
+    // input:
+    const LAGraph_Graph G,  // input graph
+    float damping,          // damping factor (typically 0.85)
+    float tol,              // stopping tolerance (typically 1e-4) ;
+    int itermax,            // maximum number of iterations (typically 100)
+    LAGraph_Workspace W,    // optional workspace; may be NULL
+    char *msg
+)
+{
+    LG_TRACE_BEGIN (t0) ;
+    LG_memory_region region ;
+    LG_Memory_Begin (&region) ;
+    LAGraph_Stats S = LG_Stats_Get (W) ;
+    LG_Stats_Begin (S, "LAGr_PageRank") ;
+    int status = pagerank (centrality, iters, G, damping, tol, itermax, W,
+        msg) ;
+    LG_Stats_End (S) ;
+    LG_Memory_End (&region, "LAGr_PageRank") ;
+    LG_TRACE_END (t0, LG_TRACE_ALGORITHM, "LAGr_PageRank", status) ;
+    return (status) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGr_PageRank: pagerank with no workspace
+//------------------------------------------------------------------------------
+
+int LAGr_PageRank
+(
+    // output:
+    GrB_Vector *centrality, // centrality(i): pagerank of node i
+    int *iters,             // number of iterations taken
+    // input:
+    const LAGraph_Graph G,  // input graph
+    float damping,          // damping factor (typically 0.85)
+    float tol,              // stopping tolerance (typically 1e-4) ;
+    int itermax,            // maximum number of iterations (typically 100)
+    char *msg
+)
+{
+    return (LAGr_PageRank_Workspace (centrality, iters, G, damping, tol,
+        itermax, NULL, msg)) ;
+}
@@ -32,20 +32,29 @@
 // NOTE: this method gets stuck in an infinite loop when there are negative-
 // weight cycles in the graph.
 
+// LAGr_SingleSourceShortestPath_Workspace is the same, except that the work
+// vectors are taken from the workspace W (if not NULL) and returned to it, so
+// that repeated calls on the same graph do not allocate them again.  AL and AH
+// depend on Delta and G->A, and are always computed.
+
+// If statistics are collected (by a stats object attached to W, or set with
+// LAGraph_Stats_SetCurrent), the time of each bucket and the # of nodes it
+// settles are recorded.
+
 // FUTURE: a Basic algorithm that picks Delta automatically
 
-#define LG_FREE_WORK        \
-{                           \
-    GrB_free (&AL) ;        \
-    GrB_free (&AH) ;        \
-    GrB_free (&lBound) ;    \
-    GrB_free (&uBound) ;    \
-    GrB_free (&tmasked) ;   \
-    GrB_free (&tReq) ;      \
-    GrB_free (&tless) ;     \
-    GrB_free (&s) ;         \
-    GrB_free (&reach) ;     \
-    GrB_free (&Empty) ;     \
+#define LG_FREE_WORK                        \
+{                                           \
+    GrB_free (&AL) ;                        \
+    GrB_free (&AH) ;                        \
+    GrB_free (&lBound) ;                    \
+    GrB_free (&uBound) ;                    \
+    LG_Workspace_Release (W, &tmasked) ;    \
+    LG_Workspace_Release (W, &tReq) ;       \
+    LG_Workspace_Release (W, &tless) ;      \
+    LG_Workspace_Release (W, &s) ;          \
+    LG_Workspace_Release (W, &reach) ;      \
+    LG_Workspace_Release (W, &Empty) ;      \
 }
 
 #define LG_FREE_ALL         \
@@ -70,7 +79,7 @@
     }                                                                         \
 }
 
-int LAGr_SingleSourceShortestPath
+static int sssp
 (
     // output:
     GrB_Vector *path_length,    // path_length (i) is the length of the shortest
@@ -79,6 +88,7 @@ int LAGr_SingleSourceShortestPath
     const LAGraph_Graph G,      // input graph, not modified
     GrB_Index source,           // source vertex
     GrB_Scalar Delta,           // delta value for delta stepping
+    LAGraph_Workspace W,        // optional workspace; may be NULL
     char *msg
 )
 {
@@ -113,6 +123,9 @@ int LAGr_SingleSourceShortestPath
     GRB_TRY (GrB_Matrix_nrows (&n, A)) ;
     LG_ASSERT_MSG (source < n, GrB_INVALID_INDEX, "invalid source node") ;
 
+    LAGraph_Stats S = LG_Stats_Get (W) ;
+    double t0 = LAGraph_WallClockTime ( ) ;
+
     //--------------------------------------------------------------------------
     // initializations
     //--------------------------------------------------------------------------
@@ -126,12 +139,12 @@ int LAGr_SingleSourceShortestPath
     GRB_TRY (GrB_Scalar_new (&lBound, etype)) ;
     GRB_TRY (GrB_Scalar_new (&uBound, etype)) ;
     GRB_TRY (GrB_Vector_new (&t, etype, n)) ;
-    GRB_TRY (GrB_Vector_new (&tmasked, etype, n)) ;
-    GRB_TRY (GrB_Vector_new (&tReq, etype, n)) ;
-    GRB_TRY (GrB_Vector_new (&Empty, GrB_BOOL, n)) ;
-    GRB_TRY (GrB_Vector_new (&tless, GrB_BOOL, n)) ;
-    GRB_TRY (GrB_Vector_new (&s, GrB_BOOL, n)) ;
-    GRB_TRY (GrB_Vector_new (&reach, GrB_BOOL, n)) ;
+    LG_TRY (LG_Workspace_Vector (&tmasked, W, etype, n, msg)) ;
+    LG_TRY (LG_Workspace_Vector (&tReq, W, etype, n, msg)) ;
+    LG_TRY (LG_Workspace_Vector (&Empty, W, GrB_BOOL, n, msg)) ;
+    LG_TRY (LG_Workspace_Vector (&tless, W, GrB_BOOL, n, msg)) ;
+    LG_TRY (LG_Workspace_Vector (&s, W, GrB_BOOL, n, msg)) ;
+    LG_TRY (LG_Workspace_Vector (&reach, W, GrB_BOOL, n, msg)) ;
 
 #if LAGRAPH_SUITESPARSE
     // optional hints for SuiteSparse:GraphBLAS
@@ -290,6 +303,9 @@ int LAGr_SingleSourceShortestPath
     // while (t >= step*Delta) not empty
     //--------------------------------------------------------------------------
 
+    double tstart = LAGraph_WallClockTime ( ), tstep = tstart ;
+    LG_Stats_Phase (S, "setup", tstart - t0) ;
+
     for (int64_t step = 0 ; ; step++)
     {
 
@@ -403,6 +419,16 @@ int LAGr_SingleSourceShortestPath
         GRB_TRY (GrB_assign (reach, s, NULL, Empty, GrB_ALL, n, GrB_DESC_S)) ;
         GrB_Index nreach ;
         GRB_TRY (GrB_Vector_nvals (&nreach, reach)) ;
+        if (S != NULL)
+        {
+            // this bucket has settled the nodes in s
+            GrB_Index nsettled ;
+            GRB_TRY (GrB_Vector_nvals (&nsettled, s)) ;
+            double tnow = LAGraph_WallClockTime ( ) ;
+            LG_TRY (LG_Stats_Iteration (S, tnow - tstep, (int64_t) nsettled,
+                -1, -1, -1, msg)) ;
+            tstep = tnow ;
+        }
         if (nreach == 0) break ;
 
         GRB_TRY (GrB_Vector_clear (s)) ; // clear s for the next iteration
@@ -414,6 +440,54 @@ int LAGr_SingleSourceShortestPath
 
     (*path_length) = t ;
     LG_FREE_WORK ;
+    LG_Stats_Phase (S, "buckets", LAGraph_WallClockTime ( ) - tstart) ;
     return (GrB_SUCCESS) ;
 }
 
+//------------------------------------------------------------------------------
+// LAGr_SingleSourceShortestPath_Workspace: SSSP with an optional workspace
+//------------------------------------------------------------------------------
+
+int LAGr_SingleSourceShortestPath_Workspace
+(
+    // output:
+    GrB_Vector *path_length,
+    // input:
+    const LAGraph_Graph G,
+    GrB_Index source,
+    GrB_Scalar Delta,
+    LAGraph_Workspace W,        // optional workspace; may be NULL
+    char *msg
+)
+{
+    LG_TRACE_BEGIN (t0) ;
+    LG_memory_region region ;
+    LG_Memory_Begin (&region) ;
+    LAGraph_Stats S = LG_Stats_Get (W) ;
+    LG_Stats_Begin (S, "LAGr_SingleSourceShortestPath") ;
+    int status = sssp (path_length, G, source, Delta, W, msg) ;
+    LG_Stats_End (S) ;
+    LG_Memory_End (&region, "LAGr_SingleSourceShortestPath") ;
+    LG_TRACE_END (t0, LG_TRACE_ALGORITHM, "LAGr_SingleSourceShortestPath",
+        status) ;
+    return (status) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGr_SingleSourceShortestPath: SSSP with no workspace
+//------------------------------------------------------------------------------
+
+int LAGr_SingleSourceShortestPath
+(
+    // output:
+    GrB_Vector *path_length,
+    // input:
+    const LAGraph_Graph G,
+    GrB_Index source,
+    GrB_Scalar Delta,
+    char *msg
+)
+{
+    return (LAGr_SingleSourceShortestPath_Workspace (path_length, G, source,
+        Delta, NULL, msg)) ;
+}
@@ -97,7 +97,7 @@ static int tricount_prep
 }
 
 //------------------------------------------------------------------------------
-// LAGraph_tricount: count the number of triangles in a graph
+// tricount: count the number of triangles in a graph
 //------------------------------------------------------------------------------
 
 #undef  LG_FREE_ALL
@@ -110,7 +110,7 @@ static int tricount_prep
     LAGraph_Free ((void **) &P, NULL) ;     \
 }
 
-int LAGr_TriangleCount
+static int tricount
 (
     // output:
     uint64_t *ntriangles,
@@ -360,3 +360,27 @@ int LAGr_TriangleCount
     (*ntriangles) = (uint64_t) ntri ;
     return (GrB_SUCCESS) ;
 }
+
+//------------------------------------------------------------------------------
+// LAGr_TriangleCount: count the triangles, and record the memory used
+//------------------------------------------------------------------------------
+
+int LAGr_TriangleCount
+(
+    // output:
+    uint64_t *ntriangles,
+    // input:
+    const LAGraph_Graph G,
+    LAGr_TriangleCount_Method *p_method,
+    LAGr_TriangleCount_Presort *p_presort,
+    char *msg
+)
+{
+    LG_TRACE_BEGIN (t0) ;
+    LG_memory_region region ;
+    LG_Memory_Begin (&region) ;
+    int status = tricount (ntriangles, G, p_method, p_presort, msg) ;
+    LG_Memory_End (&region, "LAGr_TriangleCount") ;
+    LG_TRACE_END (t0, LG_TRACE_ALGORITHM, "LAGr_TriangleCount", status) ;
+    return (status) ;
+}
@@ -16,7 +16,16 @@
 // defaults to a push-only algorithm, which can be slower.  This is not
 // user-callable (see LAGr_BreadthFirstSearch instead).  G->AT and
 // G->out_degree are not computed if not present.
- 
+
+// If the workspace W is not NULL, the work vectors q and w are taken from it
+// and returned to it, rather than allocated and freed on each call.  The
+// results pi and v are also taken from W, and are detached from it when they
+// are returned to the caller (or returned to W on error).
+
+// If statistics are collected (see LG_Stats_Get), the size of the frontier,
+// the push/pull direction, and the time of each level are recorded, and the #
+// of edges examined by each push step.
+
 // References:
 //
 // Carl Yang, Aydin Buluc, and John D. Owens. 2018. Implementing Push-Pull
@@ -29,17 +38,17 @@
 
 // revised by Tim Davis (davis@tamu.edu), Texas A&M University
 
-#define LG_FREE_WORK        \
-{                           \
-    GrB_free (&w) ;         \
-    GrB_free (&q) ;         \
+#define LG_FREE_WORK                    \
+{                                       \
+    LG_Workspace_Release (W, &w) ;      \
+    LG_Workspace_Release (W, &q) ;      \
 }
 
-#define LG_FREE_ALL         \
-{                           \
-    LG_FREE_WORK ;          \
-    GrB_free (&pi) ;        \
-    GrB_free (&v) ;         \
+#define LG_FREE_ALL                     \
+{                                       \
+    LG_FREE_WORK ;                      \
+    LG_Workspace_Release (W, &pi) ;     \
+    LG_Workspace_Release (W, &v) ;      \
 }
 
 #include "LG_internal.h"
@@ -50,6 +59,7 @@ int LG_BreadthFirstSearch_SSGrB
     GrB_Vector *parent,
     const LAGraph_Graph G,
     GrB_Index src,
+    LAGraph_Workspace W,    // optional workspace for q and w; may be NULL
     char *msg
 )
 {
@@ -77,6 +87,9 @@ int LG_BreadthFirstSearch_SSGrB
 
     LG_TRY (LAGraph_CheckGraph (G, msg)) ;
 
+    LAGraph_Stats S = LG_Stats_Get (W) ;
+    double t = LAGraph_WallClockTime ( ) ;
+
     //--------------------------------------------------------------------------
     // get the problem size and cached properties
     //--------------------------------------------------------------------------
@@ -121,13 +134,13 @@ int LG_BreadthFirstSearch_SSGrB
             GxB_ANY_SECONDI_INT64 : GxB_ANY_SECONDI_INT32 ;
 
         // create the parent vector.  pi(i) is the parent id of node i
-        GRB_TRY (GrB_Vector_new (&pi, int_type, n)) ;
+        LG_TRY (LG_Workspace_Vector (&pi, W, int_type, n, msg)) ;
         GRB_TRY (GxB_set (pi, GxB_SPARSITY_CONTROL, GxB_BITMAP + GxB_FULL)) ;
         // pi (src) = src denotes the root of the BFS tree
         GRB_TRY (GrB_Vector_setElement (pi, src, src)) ;
 
         // create a sparse integer vector q, and set q(src) = src
-        GRB_TRY (GrB_Vector_new (&q, int_type, n)) ;
+        LG_TRY (LG_Workspace_Vector (&q, W, int_type, n, msg)) ;
         GRB_TRY (GrB_Vector_setElement (q, src, src)) ;
     }
     else
@@ -136,7 +149,7 @@ int LG_BreadthFirstSearch_SSGrB
         semiring = LAGraph_any_one_bool ;
 
         // create a sparse boolean vector q, and set q(src) = true
-        GRB_TRY (GrB_Vector_new (&q, GrB_BOOL, n)) ;
+        LG_TRY (LG_Workspace_Vector (&q, W, GrB_BOOL, n, msg)) ;
         GRB_TRY (GrB_Vector_setElement (q, true, src)) ;
     }
 
@@ -144,13 +157,13 @@ int LG_BreadthFirstSearch_SSGrB
     {
         // create the level vector. v(i) is the level of node i
         // v (src) = 0 denotes the source node
-        GRB_TRY (GrB_Vector_new (&v, int_type, n)) ;
+        LG_TRY (LG_Workspace_Vector (&v, W, int_type, n, msg)) ;
         GRB_TRY (GxB_set (v, GxB_SPARSITY_CONTROL, GxB_BITMAP + GxB_FULL)) ;
         GRB_TRY (GrB_Vector_setElement (v, 0, src)) ;
     }
 
     // workspace for computing work remaining
-    GRB_TRY (GrB_Vector_new (&w, GrB_INT64, n)) ;
+    LG_TRY (LG_Workspace_Vector (&w, W, GrB_INT64, n, msg)) ;
 
     GrB_Index nq = 1 ;          // number of nodes in the current level
     double alpha = 8.0 ;
@@ -171,6 +184,9 @@ int LG_BreadthFirstSearch_SSGrB
     // {!mask} is the set of unvisited nodes
     GrB_Vector mask = (compute_parent) ? pi : v ;
 
+    double tstart = LAGraph_WallClockTime ( ), tlevel = tstart ;
+    LG_Stats_Phase (S, "setup", tstart - t) ;
+
     for (int64_t nvisited = 1, k = 1 ; nvisited < n ; nvisited += nq, k++)
     {
 
@@ -178,6 +194,9 @@ int LG_BreadthFirstSearch_SSGrB
         // select push vs pull
         //----------------------------------------------------------------------
 
+        // edges: the # of edges examined by a push step, or -1 if not known
+        int64_t edges = -1 ;
+
         if (push_pull)
         {
             if (do_push)
@@ -215,6 +234,7 @@ int LG_BreadthFirstSearch_SSGrB
                     edges_unexplored -= edges_in_frontier ;
                     switch_to_pull = growing &&
                         (edges_in_frontier > (edges_unexplored / alpha)) ;
+                    edges = edges_in_frontier ;
                 }
                 if (switch_to_pull)
                 {
@@ -235,6 +255,32 @@ int LG_BreadthFirstSearch_SSGrB
             any_pull = any_pull || (!do_push) ;
         }
 
+        //----------------------------------------------------------------------
+        // count the edges to examine, if collecting statistics
+        //----------------------------------------------------------------------
+
+        // The push/pull heuristic above counts the edges of the frontier until
+        // the first pull step.  After that, the edges of a push step are
+        // counted only if statistics are being collected, and the time taken
+        // to count them is not included in the time of the level.
+
+        if (!do_push)
+        {
+            edges = -1 ;
+        }
+        else if (S != NULL && edges < 0 && Degree != NULL)
+        {
+            double tcount = LAGraph_WallClockTime ( ) ;
+            // edges = sum (Degree (q)), the # of edges examined by the push
+            GRB_TRY (GrB_assign (w, q, NULL, Degree, GrB_ALL, n,
+                GrB_DESC_RS)) ;
+            edges = 0 ;
+            GRB_TRY (GrB_reduce (&edges, NULL, GrB_PLUS_MONOID_INT64, w,
+                NULL)) ;
+            tlevel += LAGraph_WallClockTime ( ) - tcount ;
+        }
+        int direction = do_push ? LG_STATS_PUSH : LG_STATS_PULL ;
+
         //----------------------------------------------------------------------
         // q = kth level of the BFS
         //----------------------------------------------------------------------
@@ -262,6 +308,8 @@ int LG_BreadthFirstSearch_SSGrB
         GRB_TRY (GrB_Vector_nvals (&nq, q)) ;
         if (nq == 0)
         {
+            LG_TRY (LG_Stats_Iteration (S, LAGraph_WallClockTime ( ) - tlevel,
+                last_nq, edges, direction, -1, msg)) ;
             break ;
         }
 
@@ -280,15 +328,23 @@ int LG_BreadthFirstSearch_SSGrB
             // v{q} = k, the kth level of the BFS
             GRB_TRY (GrB_assign (v, q, NULL, k, GrB_ALL, n, GrB_DESC_S)) ;
         }
+
+        t = LAGraph_WallClockTime ( ) ;
+        LG_TRY (LG_Stats_Iteration (S, t - tlevel, last_nq, edges, direction,
+            -1, msg)) ;
+        tlevel = t ;
     }
 
     //--------------------------------------------------------------------------
     // free workspace and return result
     //--------------------------------------------------------------------------
 
+    LG_Workspace_Detach (W, pi) ;
+    LG_Workspace_Detach (W, v) ;
     if (compute_parent) (*parent) = pi ;
     if (compute_level ) (*level ) = v ;
     LG_FREE_WORK ;
+    LG_Stats_Phase (S, "traversal", LAGraph_WallClockTime ( ) - tstart) ;
     return (GrB_SUCCESS) ;
 #endif
 }
@@ -27,6 +27,7 @@ int LG_BreadthFirstSearch_SSGrB
     // input:
     const LAGraph_Graph G,
     GrB_Index      src,
+    LAGraph_Workspace W,
     char          *msg
 ) ;
 
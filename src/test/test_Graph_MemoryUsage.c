@@ -0,0 +1,126 @@
+//------------------------------------------------------------------------------
+// LAGraph/src/test/test_Graph_MemoryUsage.c: test graph memory usage and budget
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2021 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+// See additional acknowledgments in the LICENSE file,
+// or contact permission@sei.cmu.edu for the full terms.
+
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include "LAGraph_test.h"
+
+#define LEN 512
+char msg [LAGRAPH_MSG_LEN] ;
+char filename [LEN+1] ;
+LAGraph_Graph G = NULL ;
+GrB_Matrix A = NULL ;
+LAGraph_GraphMemory usage ;
+
+//------------------------------------------------------------------------------
+// test_Graph_MemoryUsage
+//------------------------------------------------------------------------------
+
+void test_Graph_MemoryUsage (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "west0067.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+    TEST_CHECK (G->memory_budget == LAGRAPH_UNKNOWN) ;
+
+    // only G->A is present
+    OK (LAGraph_Graph_MemoryUsage (&usage, G, msg)) ;
+    TEST_CHECK (usage.A > 0) ;
+    TEST_CHECK (usage.AT == 0) ;
+    TEST_CHECK (usage.out_degree == 0) ;
+    TEST_CHECK (usage.in_degree == 0) ;
+    TEST_CHECK (usage.total > usage.A) ;
+    size_t total_A = usage.total ;
+
+    // with all cached properties
+    OK (LAGraph_Cached_AT (G, msg)) ;
+    OK (LAGraph_Cached_OutDegree (G, msg)) ;
+    OK (LAGraph_Cached_InDegree (G, msg)) ;
+    OK (LAGraph_Cached_EMin (G, msg)) ;
+    OK (LAGraph_Cached_EMax (G, msg)) ;
+    OK (LAGraph_Graph_MemoryUsage (&usage, G, msg)) ;
+    printf ("\nA %g AT %g out_degree %g in_degree %g emin %g emax %g "
+        "total %g\n", (double) usage.A, (double) usage.AT,
+        (double) usage.out_degree, (double) usage.in_degree,
+        (double) usage.emin, (double) usage.emax, (double) usage.total) ;
+    TEST_CHECK (usage.AT > 0) ;
+    TEST_CHECK (usage.out_degree > 0) ;
+    TEST_CHECK (usage.in_degree > 0) ;
+    TEST_CHECK (usage.emin > 0) ;
+    TEST_CHECK (usage.emax > 0) ;
+    TEST_CHECK (usage.total == total_A + usage.AT + usage.out_degree
+        + usage.in_degree + usage.emin + usage.emax) ;
+
+    // no budget: nothing is freed
+    OK (LAGraph_Graph_EnforceBudget (G, msg)) ;
+    TEST_CHECK (G->AT != NULL) ;
+
+    // a budget without room for G->AT frees only G->AT
+    G->memory_budget = (int64_t) (usage.total - usage.AT / 2) ;
+    OK (LAGraph_Graph_EnforceBudget (G, msg)) ;
+    TEST_CHECK (G->AT == NULL) ;
+    TEST_CHECK (G->out_degree != NULL) ;
+    TEST_CHECK (G->in_degree != NULL) ;
+    OK (LAGraph_CheckGraph (G, msg)) ;
+
+    // a tiny budget: computing G->AT frees the degrees but keeps G->AT
+    G->memory_budget = 0 ;
+    OK (LAGraph_Cached_AT (G, msg)) ;
+    TEST_CHECK (G->AT != NULL) ;
+    TEST_CHECK (G->out_degree == NULL) ;
+    TEST_CHECK (G->in_degree == NULL) ;
+    TEST_CHECK (G->emin != NULL) ;
+    TEST_CHECK (G->emax != NULL) ;
+
+    // computing G->out_degree frees G->AT
+    OK (LAGraph_Cached_OutDegree (G, msg)) ;
+    TEST_CHECK (G->out_degree != NULL) ;
+    TEST_CHECK (G->AT == NULL) ;
+    OK (LAGraph_CheckGraph (G, msg)) ;
+
+    // G->A is never freed
+    OK (LAGraph_Graph_EnforceBudget (G, msg)) ;
+    TEST_CHECK (G->A != NULL) ;
+    TEST_CHECK (G->out_degree == NULL) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_Graph_MemoryUsage_errors
+//------------------------------------------------------------------------------
+
+void test_Graph_MemoryUsage_errors (void)
+{
+    OK (LAGraph_Init (msg)) ;
+    int result = LAGraph_Graph_MemoryUsage (&usage, NULL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGraph_Graph_EnforceBudget (NULL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// TEST_LIST: the list of tasks for this entire test
+//------------------------------------------------------------------------------
+
+TEST_LIST =
+{
+    {"Graph_MemoryUsage", test_Graph_MemoryUsage},
+    {"Graph_MemoryUsage_errors", test_Graph_MemoryUsage_errors},
+    {NULL, NULL}
+} ;
@@ -0,0 +1,141 @@
+//------------------------------------------------------------------------------
+// LAGraph/src/test/test_MemoryStats.c: test memory accounting
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2021 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+// See additional acknowledgments in the LICENSE file,
+// or contact permission@sei.cmu.edu for the full terms.
+
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include "LAGraph_test.h"
+
+#define LEN 512
+char msg [LAGRAPH_MSG_LEN] ;
+char filename [LEN+1] ;
+LAGraph_Graph G = NULL ;
+GrB_Matrix A = NULL ;
+GrB_Vector level = NULL, parent = NULL, centrality = NULL ;
+LAGraph_MemoryInfo info ;
+
+//------------------------------------------------------------------------------
+// test_MemoryStats: count the memory used by LAGraph and GraphBLAS
+//------------------------------------------------------------------------------
+
+void test_MemoryStats (void)
+{
+    OK (LAGraph_MemoryTracking (true, msg)) ;
+    OK (LAGraph_Init (msg)) ;
+
+    // LAGraph_Init allocates the global semirings
+    OK (LAGraph_MemoryStats (&info, msg)) ;
+    TEST_CHECK (info.bytes_current > 0) ;
+    TEST_CHECK (info.nallocs > 0) ;
+    int64_t bytes0 = info.bytes_current ;
+
+    // memory allocated by LAGraph_Malloc is counted
+    int64_t *x = NULL ;
+    OK (LAGraph_Malloc ((void **) &x, 1000, sizeof (int64_t), msg)) ;
+    OK (LAGraph_MemoryStats (&info, msg)) ;
+    TEST_CHECK (info.bytes_current == bytes0 + 8000) ;
+    OK (LAGraph_Realloc ((void **) &x, 2000, 1000, sizeof (int64_t), msg)) ;
+    OK (LAGraph_MemoryStats (&info, msg)) ;
+    TEST_CHECK (info.bytes_current == bytes0 + 16000) ;
+    TEST_CHECK (info.nreallocs > 0) ;
+    OK (LAGraph_Free ((void **) &x, msg)) ;
+    OK (LAGraph_MemoryStats (&info, msg)) ;
+    TEST_CHECK (info.bytes_current == bytes0) ;
+    TEST_CHECK (info.bytes_peak >= bytes0 + 16000) ;
+
+    // load a graph
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "karate.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+    OK (LAGraph_Cached_OutDegree (G, msg)) ;
+    OK (LAGraph_MemoryStats (&info, msg)) ;
+    int64_t bytes1 = info.bytes_current ;
+    TEST_CHECK (bytes1 > bytes0) ;
+    OK (LAGraph_MemoryStats_Reset (msg)) ;
+    OK (LAGraph_MemoryStats (&info, msg)) ;
+    TEST_CHECK (info.bytes_peak == bytes1) ;
+    TEST_CHECK (info.nallocs == 0) ;
+
+    // run some algorithms, and check their high-water marks
+    for (int src = 0 ; src < 4 ; src++)
+    {
+        OK (LAGr_BreadthFirstSearch (&level, &parent, G, src, msg)) ;
+        OK (GrB_free (&level)) ;
+        OK (GrB_free (&parent)) ;
+    }
+    int iters ;
+    OK (LAGr_PageRank (&centrality, &iters, G, 0.85, 1e-4, 100, msg)) ;
+    OK (GrB_free (&centrality)) ;
+
+    int64_t peak, ncalls ;
+    OK (LAGraph_MemoryStats_Algorithm (&peak, &ncalls,
+        "LAGr_BreadthFirstSearch", msg)) ;
+    printf ("\nBFS: peak %g bytes, %g calls\n", (double) peak,
+        (double) ncalls) ;
+    TEST_CHECK (peak > 0) ;
+    TEST_CHECK (ncalls == 4) ;
+    OK (LAGraph_MemoryStats_Algorithm (&peak, &ncalls, "LAGr_PageRank", msg)) ;
+    printf ("PageRank: peak %g bytes, %g calls\n", (double) peak,
+        (double) ncalls) ;
+    TEST_CHECK (peak > 0) ;
+    TEST_CHECK (ncalls == 1) ;
+    OK (LAGraph_MemoryStats (&info, msg)) ;
+    TEST_CHECK (info.bytes_peak >= bytes1 + peak) ;
+
+    // an algorithm that has not been called
+    OK (LAGraph_MemoryStats_Algorithm (&peak, &ncalls, "LAGr_Betweenness",
+        msg)) ;
+    TEST_CHECK (peak == 0) ;
+    TEST_CHECK (ncalls == 0) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    OK (LAGraph_Finalize (msg)) ;
+
+    // all memory is freed
+    OK (LAGraph_MemoryStats (&info, msg)) ;
+    TEST_CHECK (info.bytes_current == 0) ;
+}
+
+//------------------------------------------------------------------------------
+// test_MemoryStats_disabled: no accounting unless enabled
+//------------------------------------------------------------------------------
+
+void test_MemoryStats_disabled (void)
+{
+    OK (LAGraph_Init (msg)) ;
+    OK (LAGraph_MemoryStats (&info, msg)) ;
+    TEST_CHECK (info.bytes_current == 0) ;
+    TEST_CHECK (info.nallocs == 0) ;
+
+    int result = LAGraph_MemoryStats (NULL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    int64_t peak, ncalls ;
+    result = LAGraph_MemoryStats_Algorithm (NULL, &ncalls, "LAGr_PageRank",
+        msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGraph_MemoryStats_Algorithm (&peak, &ncalls, NULL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// TEST_LIST: the list of tasks for this entire test
+//------------------------------------------------------------------------------
+
+TEST_LIST =
+{
+    {"MemoryStats", test_MemoryStats},
+    {"MemoryStats_disabled", test_MemoryStats_disabled},
+    {NULL, NULL}
+} ;
@@ -0,0 +1,217 @@
+//------------------------------------------------------------------------------
+// LAGraph/src/test/test_Pool.c: test the thread-caching memory pool
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2021 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+// See additional acknowledgments in the LICENSE file,
+// or contact permission@sei.cmu.edu for the full terms.
+
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include "LAGraph_test.h"
+
+#define LEN 512
+char msg [LAGRAPH_MSG_LEN] ;
+char filename [LEN+1] ;
+LAGraph_Graph G = NULL ;
+GrB_Matrix A = NULL ;
+GrB_Vector level = NULL, parent = NULL ;
+LAGraph_PoolStats stats ;
+
+//------------------------------------------------------------------------------
+// test_Pool: allocate and free blocks directly
+//------------------------------------------------------------------------------
+
+void test_Pool (void)
+{
+    OK (LAGraph_Pool_Stats (&stats, msg)) ;
+    int64_t live0 = stats.bytes_live ;
+
+    size_t sizes [ ] = { 0, 1, 17, 32, 33, 1000, 4096, 100000, 1 << 20,
+        (1 << 20) + 1, 3 << 20 } ;
+    int nsizes = sizeof (sizes) / sizeof (size_t) ;
+    void *P [32] ;
+
+    // calloc returns zeroed memory, of all kinds
+    int64_t total = 0 ;
+    for (int k = 0 ; k < nsizes ; k++)
+    {
+        P [k] = LAGraph_Pool_calloc (sizes [k], 1) ;
+        TEST_CHECK (P [k] != NULL) ;
+        uint8_t *x = (uint8_t *) P [k] ;
+        for (size_t i = 0 ; i < sizes [k] ; i++)
+        {
+            TEST_CHECK (x [i] == 0) ;
+        }
+        memset (x, 0xFF, sizes [k]) ;
+        total += LAGRAPH_MAX (sizes [k], 1) ;
+    }
+    OK (LAGraph_Pool_Stats (&stats, msg)) ;
+    TEST_CHECK (stats.bytes_live == live0 + total) ;
+    TEST_CHECK (stats.bytes_peak >= stats.bytes_live) ;
+    TEST_CHECK (stats.nallocs [LAGRAPH_POOL_NCLASSES] > 0) ;
+    for (int k = 0 ; k < nsizes ; k++)
+    {
+        LAGraph_Pool_free (P [k]) ;
+    }
+    OK (LAGraph_Pool_Stats (&stats, msg)) ;
+    TEST_CHECK (stats.bytes_live == live0) ;
+    TEST_CHECK (stats.bytes_cached > 0) ;
+
+    // a freed block is reused by the next allocation of the same class
+    void *p = LAGraph_Pool_malloc (1000) ;
+    LAGraph_Pool_free (p) ;
+    void *p2 = LAGraph_Pool_malloc (900) ;
+    TEST_CHECK (p == p2) ;
+    LAGraph_Pool_free (p2) ;
+
+    // realloc preserves the contents, within a class and across classes
+    int64_t *x = LAGraph_Pool_malloc (10 * sizeof (int64_t)) ;
+    TEST_CHECK (x != NULL) ;
+    for (int64_t i = 0 ; i < 10 ; i++) x [i] = i ;
+    x = LAGraph_Pool_realloc (x, 12 * sizeof (int64_t)) ;
+    TEST_CHECK (x != NULL) ;
+    x = LAGraph_Pool_realloc (x, 1000000 * sizeof (int64_t)) ;
+    TEST_CHECK (x != NULL) ;
+    for (int64_t i = 10 ; i < 1000000 ; i++) x [i] = i ;
+    x = LAGraph_Pool_realloc (x, 100 * sizeof (int64_t)) ;
+    TEST_CHECK (x != NULL) ;
+    for (int64_t i = 0 ; i < 100 ; i++) TEST_CHECK (x [i] == i) ;
+    LAGraph_Pool_free (x) ;
+    x = LAGraph_Pool_realloc (NULL, 8) ;
+    TEST_CHECK (x != NULL) ;
+    LAGraph_Pool_free (x) ;
+    LAGraph_Pool_free (NULL) ;
+    OK (LAGraph_Pool_Stats (&stats, msg)) ;
+    TEST_CHECK (stats.bytes_live == live0) ;
+
+    // calloc fails on integer overflow
+    TEST_CHECK (LAGraph_Pool_calloc (SIZE_MAX, 2) == NULL) ;
+
+    // a size near SIZE_MAX fails, rather than wrapping around to a tiny block
+    TEST_CHECK (LAGraph_Pool_malloc (SIZE_MAX) == NULL) ;
+    TEST_CHECK (LAGraph_Pool_malloc (SIZE_MAX - 8) == NULL) ;
+    TEST_CHECK (LAGraph_Pool_calloc (SIZE_MAX - 8, 1) == NULL) ;
+    p = LAGraph_Pool_malloc (100) ;
+    TEST_CHECK (LAGraph_Pool_realloc (p, SIZE_MAX - 8) == NULL) ;
+    LAGraph_Pool_free (p) ;
+
+    // allocate and free blocks from many threads at once
+    #pragma omp parallel for num_threads(4) schedule(dynamic,1)
+    for (int t = 0 ; t < 64 ; t++)
+    {
+        void *Q [16] ;
+        for (int trial = 0 ; trial < 100 ; trial++)
+        {
+            for (int k = 0 ; k < 16 ; k++)
+            {
+                Q [k] = LAGraph_Pool_malloc ((size_t) (k + 1) * (t + 1) * 8) ;
+                if (Q [k] != NULL) memset (Q [k], t, 8) ;
+            }
+            for (int k = 0 ; k < 16 ; k++)
+            {
+                LAGraph_Pool_free (Q [k]) ;
+            }
+        }
+    }
+    OK (LAGraph_Pool_Stats (&stats, msg)) ;
+    TEST_CHECK (stats.bytes_live == live0) ;
+
+    TEST_CHECK (stats.bytes_cached <= LAGRAPH_POOL_MAX_CACHED) ;
+
+    // trim the caches
+    OK (LAGraph_Pool_Trim (msg)) ;
+    OK (LAGraph_Pool_Stats (&stats, msg)) ;
+    TEST_CHECK (stats.bytes_cached == 0) ;
+    TEST_CHECK (stats.bytes_live == live0) ;
+
+    // the caches are freed by LAGraph_Pool_Trim, and created again as needed
+    p = LAGraph_Pool_malloc (1000) ;
+    LAGraph_Pool_free (p) ;
+    OK (LAGraph_Pool_Stats (&stats, msg)) ;
+    TEST_CHECK (stats.bytes_cached == 1024) ;
+    p2 = LAGraph_Pool_malloc (1000) ;
+    TEST_CHECK (p == p2) ;
+    LAGraph_Pool_free (p2) ;
+
+    // the caches of all threads hold at most LAGRAPH_POOL_MAX_CACHED bytes:
+    // free 4MB of blocks of each of the 8 largest classes
+    int nblocks = 0 ;
+    void **B = LAGraph_Pool_malloc (4096 * sizeof (void *)) ;
+    TEST_CHECK (B != NULL) ;
+    for (size_t b = 8192 ; b <= (1 << 20) ; b *= 2)
+    {
+        for (size_t i = 0 ; i < (4 << 20) / b ; i++)
+        {
+            B [nblocks] = LAGraph_Pool_malloc (b) ;
+            TEST_CHECK (B [nblocks] != NULL) ;
+            nblocks++ ;
+        }
+    }
+    for (int i = 0 ; i < nblocks ; i++)
+    {
+        LAGraph_Pool_free (B [i]) ;
+    }
+    LAGraph_Pool_free (B) ;
+    OK (LAGraph_Pool_Stats (&stats, msg)) ;
+    TEST_CHECK (stats.bytes_cached > 0) ;
+    TEST_CHECK (stats.bytes_cached <= LAGRAPH_POOL_MAX_CACHED) ;
+    TEST_CHECK (stats.bytes_live == live0) ;
+    OK (LAGraph_Pool_Trim (msg)) ;
+
+    int result = LAGraph_Pool_Stats (NULL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+}
+
+//------------------------------------------------------------------------------
+// test_Pool_Init: use the pool for all of LAGraph and GraphBLAS
+//------------------------------------------------------------------------------
+
+void test_Pool_Init (void)
+{
+    OK (LAGr_Init (GrB_NONBLOCKING, LAGraph_Pool_malloc, LAGraph_Pool_calloc,
+        LAGraph_Pool_realloc, LAGraph_Pool_free, msg)) ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "karate.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+    for (int src = 0 ; src < 34 ; src++)
+    {
+        OK (LAGr_BreadthFirstSearch (&level, &parent, G, src, msg)) ;
+        OK (LG_check_bfs (level, parent, G, src, msg)) ;
+        OK (GrB_free (&level)) ;
+        OK (GrB_free (&parent)) ;
+    }
+    OK (LAGraph_Pool_Stats (&stats, msg)) ;
+    TEST_CHECK (stats.bytes_live > 0) ;
+    TEST_CHECK (stats.bytes_peak >= stats.bytes_live) ;
+    int64_t nsmall = 0 ;
+    for (int k = 0 ; k < LAGRAPH_POOL_NCLASSES ; k++)
+    {
+        nsmall += stats.nallocs [k] ;
+    }
+    TEST_CHECK (nsmall > 0) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+
+    // LAGraph_Finalize frees the cached blocks
+    OK (LAGraph_Finalize (msg)) ;
+    OK (LAGraph_Pool_Stats (&stats, msg)) ;
+    TEST_CHECK (stats.bytes_cached == 0) ;
+}
+
+//------------------------------------------------------------------------------
+// TEST_LIST: the list of tasks for this entire test
+//------------------------------------------------------------------------------
+
+TEST_LIST =
+{
+    {"Pool", test_Pool},
+    {"Pool_Init", test_Pool_Init},
+    {NULL, NULL}
+} ;
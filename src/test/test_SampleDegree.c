@@ -72,16 +72,16 @@ matrix_info ;
 const matrix_info files [ ] =
 {
     { "A.mtx",
-        4.6, 5.0,
-        4.6, 5.0,
+        5.0, 5.0,
+        5.0, 5.0,
         5, 123456 },
      { "LFAT5.mtx",
-        2.2, 2.0,
-        2.2, 2.0,
+        3.2, 3.0,
+        3.2, 3.0,
         5, 123456 },
      { "cover.mtx",
-        1.4, 1.0,
-        2.4, 3.0,
+        2.6, 3.0,
+        1.0, 1.0,
         5, 123456 },
      { "full.mtx",
         3.0, 3.0,
@@ -92,21 +92,21 @@ const matrix_info files [ ] =
         4.0, 4.0,
         5, 123456 },
      { "karate.mtx",
-        3.0, 3.0,
-        3.0, 3.0,
+        4.2, 3.0,
+        4.2, 3.0,
         5, 123456 },
      // Add karate two more times to test seed and nsamples
      { "karate.mtx",
-        3.46666666667, 3.0,
-        3.46666666667, 3.0,
+        4.73333333333, 3.0,
+        4.73333333333, 3.0,
         15, 123456 },
      { "karate.mtx",
-        8.4, 6.0,
-        8.4, 6.0,
+        2.2, 2.0,
+        2.2, 2.0,
         5, 87654432 },
      { "ldbc-cdlp-directed-example.mtx",
+        2.6, 3.0,
         2.2, 2.0,
-        1.8, 2.0,
         5, 123456 },
 //   { "ldbc-directed-example-bool.mtx",
 //      2.5, 3.0,
@@ -172,6 +172,106 @@ void test_sort3 (void)
     OK (LAGraph_Finalize (msg)) ;
 }
 
+//-----------------------------------------------------------------------------
+// test_rsort: compare LG_rsort with LG_qsort_*
+//-----------------------------------------------------------------------------
+
+void test_rsort (void)
+{
+    OK (LAGraph_Init (msg)) ;
+    OK (LAGraph_SetNumThreads (1, 4, msg)) ;
+
+    // sizes of 4*LG_BASECASE or more use 4 threads
+    int64_t sizes [ ] = { 0, 1000, 5000, 21000, 85000, 300000, 1000000, -1 } ;
+    int64_t nmax = 1000000 ;
+    int64_t *A [3], *B [3] ;
+    for (int i = 0 ; i < 3 ; i++)
+    {
+        OK (LAGraph_Malloc ((void **) &A [i], nmax, sizeof (int64_t), msg)) ;
+        OK (LAGraph_Malloc ((void **) &B [i], nmax, sizeof (int64_t), msg)) ;
+    }
+
+    uint64_t seed = 1 ;
+    for (int nkeys = 1 ; nkeys <= 3 ; nkeys++)
+    {
+        for (int isize = 0 ; sizes [isize] >= 0 ; isize++)
+        {
+            int64_t n = sizes [isize] ;
+            for (int range = 0 ; range <= 4 ; range++)
+            {
+                // keys in a tiny, negative, moderate, or full 64-bit range,
+                // or with bits 16 to 31 all zero, so that the passes for
+                // those two digits are skipped
+                for (int i = 0 ; i < nkeys ; i++)
+                {
+                    for (int64_t k = 0 ; k < n ; k++)
+                    {
+                        uint64_t r = LG_Random60 (&seed) ;
+                        int64_t x =
+                            (range == 0) ? ((int64_t) (r % 3)) :
+                            (range == 1) ? (((int64_t) (r % 1000)) - 500) :
+                            (range == 2) ? ((int64_t) (r % n + 1)) :
+                            (range == 3) ? ((int64_t) (r << 4)) :
+                                           ((int64_t) ((r & 0xFFFF) |
+                                               (((r >> 40) & 0xFF) << 32))) ;
+                        A [i][k] = x ;
+                        B [i][k] = x ;
+                    }
+                }
+
+                bool sorted = false ;
+                if (nkeys == 1)
+                {
+                    OK (LG_rsort (A [0], NULL, NULL, n, true, &sorted, msg)) ;
+                    LG_qsort_1a (B [0], n) ;
+                }
+                else if (nkeys == 2)
+                {
+                    OK (LG_rsort (A [0], A [1], NULL, n, true, &sorted, msg)) ;
+                    LG_qsort_2 (B [0], B [1], n) ;
+                }
+                else
+                {
+                    OK (LG_rsort (A [0], A [1], A [2], n, true, &sorted, msg)) ;
+                    LG_qsort_3 (B [0], B [1], B [2], n) ;
+                }
+                TEST_CHECK (sorted) ;
+
+                for (int i = 0 ; i < nkeys ; i++)
+                {
+                    bool ok = true ;
+                    for (int64_t k = 0 ; k < n ; k++)
+                    {
+                        ok = ok && (A [i][k] == B [i][k]) ;
+                    }
+                    TEST_CHECK (ok) ;
+                }
+            }
+        }
+    }
+
+    // rsort declines a problem that is too small, without modifying it
+    A [0][0] = 2 ; A [0][1] = 1 ;
+    bool sorted = true ;
+    OK (LG_rsort (A [0], NULL, NULL, 2, false, &sorted, msg)) ;
+    TEST_CHECK (!sorted) ;
+    TEST_CHECK (A [0][0] == 2 && A [0][1] == 1) ;
+
+    // invalid inputs
+    int result = LG_rsort (NULL, NULL, NULL, 2, true, &sorted, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LG_rsort (A [0], NULL, A [2], 2, true, &sorted, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+
+    for (int i = 0 ; i < 3 ; i++)
+    {
+        LAGraph_Free ((void **) &A [i], NULL) ;
+        LAGraph_Free ((void **) &B [i], NULL) ;
+    }
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
 //-----------------------------------------------------------------------------
 // test_sort1_brutal
 //-----------------------------------------------------------------------------
@@ -341,6 +441,7 @@ TEST_LIST = {
     {"test_sort1", test_sort1},
     {"test_sort2", test_sort2},
     {"test_sort3", test_sort3},
+    {"test_rsort", test_rsort},
     #if LAGRAPH_SUITESPARSE
     {"test_sort1_brutal", test_sort1_brutal},
     {"test_sort2_brutal", test_sort2_brutal},
@@ -204,6 +204,28 @@ void test_SortByDegree (void)
                     last_deg = deg ;
                 }
 
+                // check the degree buckets, and ties broken by node id
+                int64_t *P2 = NULL, *Bucket = NULL, nbuckets = 0 ;
+                OK (LAGr_SortByDegreeBuckets (&P2, &Bucket, &nbuckets, G,
+                    byout, ascending, msg)) ;
+                TEST_CHECK (Bucket [0] == 0 && Bucket [nbuckets] == n) ;
+                for (int b = 0 ; b < nbuckets ; b++)
+                {
+                    int64_t bdeg = ascending ? b : (nbuckets - 1 - b) ;
+                    TEST_CHECK (Bucket [b] <= Bucket [b+1]) ;
+                    for (int64_t k = Bucket [b] ; k < Bucket [b+1] ; k++)
+                    {
+                        TEST_CHECK (P2 [k] == P [k]) ;
+                        TEST_CHECK (k == Bucket [b] || P [k-1] < P [k]) ;
+                        int64_t deg = 0 ;
+                        GrB_Info info = GrB_Vector_extractElement (&deg, d, k) ;
+                        if (info == GrB_NO_VALUE) deg = 0 ;
+                        TEST_CHECK (deg == bdeg) ;
+                    }
+                }
+                OK (LAGraph_Free ((void **) &P2, NULL)) ;
+                OK (LAGraph_Free ((void **) &Bucket, NULL)) ;
+
                 // free workspace and the graph H
                 OK (LAGraph_Free ((void **) &W, NULL)) ;
                 OK (LAGraph_Free ((void **) &P, NULL)) ;
@@ -0,0 +1,279 @@
+//------------------------------------------------------------------------------
+// LAGraph/src/test/test_Stats.c: test per-run algorithm statistics
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2021 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+// See additional acknowledgments in the LICENSE file,
+// or contact permission@sei.cmu.edu for the full terms.
+
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include "LAGraph_test.h"
+#include "LAGraphX.h"
+#include "LG_internal.h"
+
+#define LEN 512
+char msg [LAGRAPH_MSG_LEN] ;
+char filename [LEN+1] ;
+char json [64 * 1024] ;
+LAGraph_Graph G = NULL, G2 = NULL ;
+LAGraph_Workspace W = NULL ;
+LAGraph_Stats S = NULL ;
+GrB_Matrix A = NULL ;
+GrB_Vector u = NULL, v = NULL ;
+GrB_Scalar Delta = NULL ;
+
+// dump: print S as JSON into the json string
+void dump (void)
+{
+    FILE *f = tmpfile ( ) ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_Stats_JSON (f, S, msg)) ;
+    rewind (f) ;
+    size_t len = fread (json, 1, sizeof (json) - 1, f) ;
+    json [len] = '\0' ;
+    fclose (f) ;
+    TEST_CHECK (len > 0 && json [0] == '{') ;
+}
+
+//------------------------------------------------------------------------------
+// test_Stats
+//------------------------------------------------------------------------------
+
+void test_Stats (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "karate.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+    OK (LAGraph_Cached_OutDegree (G, msg)) ;
+    GrB_Index n ;
+    OK (GrB_Matrix_nrows (&n, G->A)) ;
+
+    OK (LAGraph_Stats_New (&S, msg)) ;
+    OK (LAGraph_Workspace_New (&W, n, msg)) ;
+    OK (LAGraph_Workspace_SetStats (W, S, msg)) ;
+
+    // nothing has run yet
+    dump ( ) ;
+    TEST_CHECK (strstr (json, "\"algorithm\": null") != NULL) ;
+    TEST_CHECK (strstr (json, "\"iterations\": []") != NULL) ;
+
+    //--------------------------------------------------------------------------
+    // breadth-first search
+    //--------------------------------------------------------------------------
+
+    OK (LAGr_BreadthFirstSearch_Workspace (&u, NULL, G, 0, W, msg)) ;
+    #if LAGRAPH_SUITESPARSE
+    TEST_CHECK (strcmp (S->algorithm, "LAGr_BreadthFirstSearch") == 0) ;
+    TEST_CHECK (S->niters > 0) ;
+    TEST_CHECK (S->nphases == 2) ;
+    TEST_CHECK (S->time >= 0) ;
+    // the first level expands the source node only, with a push
+    TEST_CHECK (S->iter [0].frontier == 1) ;
+    TEST_CHECK (S->iter [0].direction == LG_STATS_PUSH) ;
+    TEST_CHECK (S->iter [0].edges > 0) ;
+    // all nodes reached are in a frontier, except those in the last level
+    int64_t nfrontier = 0 ;
+    for (int64_t k = 0 ; k < S->niters ; k++)
+    {
+        nfrontier += S->iter [k].frontier ;
+    }
+    GrB_Index nreached ;
+    OK (GrB_Vector_nvals (&nreached, u)) ;
+    TEST_CHECK (nfrontier <= (int64_t) nreached) ;
+    dump ( ) ;
+    printf ("\n%s", json) ;
+    TEST_CHECK (strstr (json, "\"algorithm\": \"LAGr_BreadthFirstSearch\"")
+        != NULL) ;
+    TEST_CHECK (strstr (json, "\"direction\": \"push\"") != NULL) ;
+    TEST_CHECK (strstr (json, "\"setup\"") != NULL) ;
+    TEST_CHECK (strstr (json, "\"bytes_peak\": null") != NULL) ;
+    #endif
+    OK (GrB_free (&u)) ;
+
+    //--------------------------------------------------------------------------
+    // pagerank
+    //--------------------------------------------------------------------------
+
+    int iters = 0 ;
+    OK (LAGr_PageRank_Workspace (&u, &iters, G, 0.85, 1e-4, 100, W, msg)) ;
+    TEST_CHECK (strcmp (S->algorithm, "LAGr_PageRank") == 0) ;
+    TEST_CHECK (S->niters == iters) ;
+    TEST_CHECK (S->iter [iters-1].residual <= 1e-4) ;
+    TEST_CHECK (S->iter [0].residual > S->iter [iters-1].residual) ;
+    dump ( ) ;
+    TEST_CHECK (strstr (json, "\"residual\": null") == NULL) ;
+    OK (GrB_free (&u)) ;
+
+    //--------------------------------------------------------------------------
+    // single-source shortest path
+    //--------------------------------------------------------------------------
+
+    // G2: the same graph with all edge weights equal to 1
+    OK (GrB_Matrix_new (&A, GrB_INT32, n, n)) ;
+    OK (GrB_assign (A, G->A, NULL, (int32_t) 1, GrB_ALL, n, GrB_ALL, n,
+        GrB_DESC_S)) ;
+    OK (LAGraph_New (&G2, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+    OK (GrB_Scalar_new (&Delta, GrB_INT32)) ;
+    OK (GrB_Scalar_setElement (Delta, 2)) ;
+    OK (LAGr_SingleSourceShortestPath_Workspace (&u, G2, 0, Delta, W, msg)) ;
+    TEST_CHECK (strcmp (S->algorithm, "LAGr_SingleSourceShortestPath") == 0) ;
+    TEST_CHECK (S->niters > 0) ;
+    TEST_CHECK (S->iter [0].frontier > 0) ;
+    OK (GrB_free (&u)) ;
+
+    // a run that fails is still finished by the wrapper
+    int result = LAGr_SingleSourceShortestPath_Workspace (&u, G2, n, Delta, W,
+        msg) ;
+    TEST_CHECK (result == GrB_INVALID_INDEX) ;
+    TEST_CHECK (strcmp (S->algorithm, "LAGr_SingleSourceShortestPath") == 0) ;
+    TEST_CHECK (S->niters == 0) ;
+    TEST_CHECK (S->time >= 0) ;
+    OK (GrB_free (&Delta)) ;
+    OK (LAGraph_Delete (&G2, msg)) ;
+
+    // without the stats object, S is left unchanged
+    OK (LAGraph_Workspace_SetStats (W, NULL, msg)) ;
+    OK (LAGr_PageRank_Workspace (&u, &iters, G, 0.85, 1e-4, 100, W, msg)) ;
+    TEST_CHECK (strcmp (S->algorithm, "LAGr_SingleSourceShortestPath") == 0) ;
+    OK (GrB_free (&u)) ;
+
+    OK (LAGraph_Workspace_Free (&W, msg)) ;
+    OK (LAGraph_Stats_Free (&S, msg)) ;
+    TEST_CHECK (S == NULL) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_Stats_current: statistics collected without a workspace
+//------------------------------------------------------------------------------
+
+void test_Stats_current (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "karate.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+    OK (LAGraph_Cached_OutDegree (G, msg)) ;
+    GrB_Index n ;
+    OK (GrB_Matrix_nrows (&n, G->A)) ;
+    OK (LAGraph_Stats_New (&S, msg)) ;
+    OK (LAGraph_Stats_SetCurrent (S, msg)) ;
+
+    // the algorithms without a workspace fill the current stats object
+    int iters = 0 ;
+    OK (LAGr_PageRank (&u, &iters, G, 0.85, 1e-4, 100, msg)) ;
+    TEST_CHECK (strcmp (S->algorithm, "LAGr_PageRank") == 0) ;
+    TEST_CHECK (S->niters == iters) ;
+    TEST_CHECK (S->depth == 0) ;
+    OK (GrB_free (&u)) ;
+
+    OK (LAGr_BreadthFirstSearch (&u, NULL, G, 0, msg)) ;
+    TEST_CHECK (strcmp (S->algorithm, "LAGr_BreadthFirstSearch") == 0) ;
+    #if LAGRAPH_SUITESPARSE
+    TEST_CHECK (S->niters > 0) ;
+    // each push step has a count of its edges, with or without a pull step
+    // before it
+    for (int64_t k = 0 ; k < S->niters ; k++)
+    {
+        TEST_CHECK ((S->iter [k].direction == LG_STATS_PUSH) ==
+            (S->iter [k].edges >= 0)) ;
+    }
+    #endif
+    OK (GrB_free (&u)) ;
+
+    // the local clustering coefficient and label propagation record their
+    // phases, which are also returned in t
+    double t [2] ;
+    #if LAGRAPH_SUITESPARSE
+    OK (LAGraph_lcc (&u, G->A, true, true, t, msg)) ;
+    TEST_CHECK (strcmp (S->algorithm, "LAGraph_lcc") == 0) ;
+    TEST_CHECK (S->nphases == 2) ;
+    TEST_CHECK (strcmp (S->phase_name [0], "sanitize") == 0) ;
+    TEST_CHECK (S->phase_time [0] == t [0]) ;
+    TEST_CHECK (strcmp (S->phase_name [1], "lcc") == 0) ;
+    TEST_CHECK (S->phase_time [1] == t [1]) ;
+    OK (GrB_free (&u)) ;
+    #endif
+
+    OK (LAGraph_cdlp (&u, G->A, true, true, 100, t, msg)) ;
+    TEST_CHECK (strcmp (S->algorithm, "LAGraph_cdlp") == 0) ;
+    TEST_CHECK (S->niters > 0) ;
+    GrB_Index nvals ;
+    OK (GrB_Matrix_nvals (&nvals, G->A)) ;
+    TEST_CHECK (S->iter [0].edges == (int64_t) nvals) ;
+    dump ( ) ;
+    TEST_CHECK (strstr (json, "\"cdlp\"") != NULL) ;
+    OK (GrB_free (&u)) ;
+
+    // a stats object attached to a workspace takes precedence
+    LAGraph_Stats S2 = NULL ;
+    OK (LAGraph_Stats_New (&S2, msg)) ;
+    OK (LAGraph_Workspace_New (&W, n, msg)) ;
+    OK (LAGraph_Workspace_SetStats (W, S2, msg)) ;
+    OK (LAGr_PageRank_Workspace (&u, &iters, G, 0.85, 1e-4, 100, W, msg)) ;
+    TEST_CHECK (strcmp (S2->algorithm, "LAGr_PageRank") == 0) ;
+    TEST_CHECK (strcmp (S->algorithm, "LAGraph_cdlp") == 0) ;
+    OK (GrB_free (&u)) ;
+    OK (LAGraph_Workspace_Free (&W, msg)) ;
+    OK (LAGraph_Stats_Free (&S2, msg)) ;
+
+    // with no current stats object, S is left unchanged
+    OK (LAGraph_Stats_SetCurrent (NULL, msg)) ;
+    OK (LAGr_PageRank (&u, &iters, G, 0.85, 1e-4, 100, msg)) ;
+    TEST_CHECK (strcmp (S->algorithm, "LAGraph_cdlp") == 0) ;
+    OK (GrB_free (&u)) ;
+
+    // freeing the current stats object clears it
+    OK (LAGraph_Stats_SetCurrent (S, msg)) ;
+    OK (LAGraph_Stats_Free (&S, msg)) ;
+    TEST_CHECK (LG_Stats_Get (NULL) == NULL) ;
+    OK (LAGr_PageRank (&u, &iters, G, 0.85, 1e-4, 100, msg)) ;
+    OK (GrB_free (&u)) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_Stats_errors
+//------------------------------------------------------------------------------
+
+void test_Stats_errors (void)
+{
+    OK (LAGraph_Init (msg)) ;
+    int result = LAGraph_Stats_New (NULL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    OK (LAGraph_Stats_Free (NULL, msg)) ;
+    OK (LAGraph_Stats_Free (&S, msg)) ;
+    result = LAGraph_Workspace_SetStats (NULL, NULL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGraph_Stats_JSON (stdout, NULL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// TEST_LIST: the list of tasks for this entire test
+//------------------------------------------------------------------------------
+
+TEST_LIST =
+{
+    {"Stats", test_Stats},
+    {"Stats_current", test_Stats_current},
+    {"Stats_errors", test_Stats_errors},
+    {NULL, NULL}
+} ;
@@ -0,0 +1,211 @@
+//------------------------------------------------------------------------------
+// LAGraph/src/test/test_Trace.c: test tracing of LAGraph and GraphBLAS calls
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2021 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+// See additional acknowledgments in the LICENSE file,
+// or contact permission@sei.cmu.edu for the full terms.
+
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include "LAGraph_test.h"
+#include "LG_internal.h"
+
+#define LEN 512
+char msg [LAGRAPH_MSG_LEN] ;
+char filename [LEN+1] ;
+char trace [8 * 1024 * 1024] ;
+LAGraph_Graph G = NULL ;
+GrB_Matrix A = NULL ;
+GrB_Vector level = NULL ;
+
+// dump: write the trace as CSV (or as Chrome JSON) into the trace string
+void dump (bool json)
+{
+    FILE *f = tmpfile ( ) ;
+    TEST_CHECK (f != NULL) ;
+    if (json)
+    {
+        OK (LAGraph_Trace_ChromeJSON (f, msg)) ;
+    }
+    else
+    {
+        OK (LAGraph_Trace_CSV (f, msg)) ;
+    }
+    rewind (f) ;
+    size_t len = fread (trace, 1, sizeof (trace) - 1, f) ;
+    trace [len] = '\0' ;
+    fclose (f) ;
+    TEST_CHECK (len > 0) ;
+}
+
+//------------------------------------------------------------------------------
+// test_Trace
+//------------------------------------------------------------------------------
+
+void test_Trace (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "karate.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+
+    // nothing is traced by default
+    OK (LAGr_BreadthFirstSearch (&level, NULL, G, 0, msg)) ;
+    OK (GrB_free (&level)) ;
+    dump (false) ;
+    TEST_CHECK (strcmp (trace, "tid,category,name,start_us,duration_us,"
+        "status,nthreads,file,line,call\n") == 0) ;
+
+    // trace a BFS
+    OK (LAGraph_Tracing (true, msg)) ;
+    OK (LAGr_BreadthFirstSearch (&level, NULL, G, 0, msg)) ;
+    OK (GrB_free (&level)) ;
+    OK (LAGraph_Tracing (false, msg)) ;
+
+    dump (false) ;
+    TEST_CHECK (strstr (trace, ",algorithm,LAGr_BreadthFirstSearch,")
+        != NULL) ;
+    TEST_CHECK (strstr (trace, ",GrB,") != NULL) ;
+
+    dump (true) ;
+    TEST_CHECK (strncmp (trace, "{\"displayTimeUnit\"", 18) == 0) ;
+    TEST_CHECK (strstr (trace, "\"name\": \"LAGr_BreadthFirstSearch\", "
+        "\"cat\": \"algorithm\", \"ph\": \"X\"") != NULL) ;
+
+    // calls made with tracing disabled are not recorded
+    int64_t len = strlen (trace) ;
+    OK (LAGr_BreadthFirstSearch (&level, NULL, G, 0, msg)) ;
+    OK (GrB_free (&level)) ;
+    dump (true) ;
+    TEST_CHECK (strlen (trace) == len) ;
+
+    // clear the trace
+    OK (LAGraph_Trace_Clear (msg)) ;
+    dump (true) ;
+    TEST_CHECK (strcmp (trace,
+        "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n]}\n") == 0) ;
+
+    OK (LAGraph_Delete (&G, msg)) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_Trace_threads: trace events from many threads at once
+//------------------------------------------------------------------------------
+
+// count_events: count the events with the given name in the CSV trace, and
+// the # of distinct threads that recorded them
+void count_events (const char *name, int64_t *nevents, int *ntids)
+{
+    bool seen [64] ;
+    memset (seen, 0, sizeof (seen)) ;
+    (*nevents) = 0 ;
+    (*ntids) = 0 ;
+    char *line = strchr (trace, '\n') ;
+    while (line != NULL && line [1] != '\0')
+    {
+        line++ ;
+        int64_t tid = -1 ;
+        char category [64], event [64] ;
+        if (sscanf (line, "%" SCNd64 ",%63[^,],%63[^,],", &tid, category,
+            event) == 3 && strcmp (event, name) == 0)
+        {
+            (*nevents)++ ;
+            TEST_CHECK (tid >= 0 && tid < 64) ;
+            if (tid >= 0 && tid < 64 && !seen [tid])
+            {
+                seen [tid] = true ;
+                (*ntids)++ ;
+            }
+        }
+        line = strchr (line, '\n') ;
+    }
+}
+
+void test_Trace_threads (void)
+{
+    OK (LAGraph_Init (msg)) ;
+    OK (LAGraph_Trace_Clear (msg)) ;
+    OK (LAGraph_Tracing (true, msg)) ;
+
+    // each thread records more events than fit in one chunk of its buffer
+    int nthreads = 0 ;
+    #pragma omp parallel num_threads(4)
+    {
+        #if defined ( _OPENMP )
+        #pragma omp master
+        nthreads = omp_get_num_threads ( ) ;
+        #else
+        nthreads = 1 ;
+        #endif
+        for (int k = 0 ; k < 5000 ; k++)
+        {
+            LG_TRACE_BEGIN (t0) ;
+            LG_TRACE_END (t0, LG_TRACE_LAGRAPH, "test_event", k) ;
+        }
+    }
+    OK (LAGraph_Tracing (false, msg)) ;
+    int64_t nevents ;
+    int ntids ;
+    dump (false) ;
+    count_events ("test_event", &nevents, &ntids) ;
+    printf ("\nthreads: %d, events: %g, tids: %d\n", nthreads,
+        (double) nevents, ntids) ;
+    TEST_CHECK (nevents == 5000 * nthreads) ;
+    TEST_CHECK (ntids == nthreads) ;
+
+    // after LAGraph_Trace_Clear, each thread starts a new buffer
+    OK (LAGraph_Trace_Clear (msg)) ;
+    OK (LAGraph_Tracing (true, msg)) ;
+    #pragma omp parallel num_threads(nthreads)
+    {
+        for (int k = 0 ; k < 10 ; k++)
+        {
+            LG_TRACE_BEGIN (t0) ;
+            LG_TRACE_END (t0, LG_TRACE_LAGRAPH, "test_event2", k) ;
+        }
+    }
+    OK (LAGraph_Tracing (false, msg)) ;
+    dump (false) ;
+    count_events ("test_event", &nevents, &ntids) ;
+    TEST_CHECK (nevents == 0) ;
+    count_events ("test_event2", &nevents, &ntids) ;
+    TEST_CHECK (nevents == 10 * nthreads) ;
+    TEST_CHECK (ntids == nthreads) ;
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_Trace_errors
+//------------------------------------------------------------------------------
+
+void test_Trace_errors (void)
+{
+    OK (LAGraph_Init (msg)) ;
+    int result = LAGraph_Trace_ChromeJSON (NULL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    result = LAGraph_Trace_CSV (NULL, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// TEST_LIST: the list of tasks for this entire test
+//------------------------------------------------------------------------------
+
+TEST_LIST =
+{
+    {"Trace", test_Trace},
+    {"Trace_threads", test_Trace_threads},
+    {"Trace_errors", test_Trace_errors},
+    {NULL, NULL}
+} ;
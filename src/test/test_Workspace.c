@@ -0,0 +1,286 @@
+//------------------------------------------------------------------------------
+// LAGraph/src/test/test_Workspace.c: test algorithms with a reusable workspace
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2021 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+// See additional acknowledgments in the LICENSE file,
+// or contact permission@sei.cmu.edu for the full terms.
+
+//------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <acutest.h>
+#include "LAGraph_test.h"
+#include "LG_internal.h"
+
+#define LEN 512
+char msg [LAGRAPH_MSG_LEN] ;
+char filename [LEN+1] ;
+LAGraph_Graph G = NULL, G2 = NULL ;
+LAGraph_Workspace W = NULL ;
+GrB_Matrix A = NULL ;
+GrB_Vector u = NULL, v = NULL, u2 = NULL, v2 = NULL ;
+GrB_Scalar Delta = NULL ;
+
+//------------------------------------------------------------------------------
+// test_Workspace: compare results with and without a workspace
+//------------------------------------------------------------------------------
+
+const char *files [ ] =
+{
+    "ldbc-directed-example.mtx",
+    "karate.mtx",
+    "west0067.mtx",
+    ""
+} ;
+
+void test_Workspace (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    for (int k = 0 ; ; k++)
+    {
+        const char *aname = files [k] ;
+        if (strlen (aname) == 0) break ;
+        printf ("\n================================== %s:\n", aname) ;
+        TEST_CASE (aname) ;
+        snprintf (filename, LEN, LG_DATA_DIR "%s", aname) ;
+        FILE *f = fopen (filename, "r") ;
+        TEST_CHECK (f != NULL) ;
+        OK (LAGraph_MMRead (&A, f, msg)) ;
+        OK (fclose (f)) ;
+        OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+        OK (LAGraph_Cached_AT (G, msg)) ;
+        OK (LAGraph_Cached_OutDegree (G, msg)) ;
+        GrB_Index n ;
+        OK (GrB_Matrix_nrows (&n, G->A)) ;
+        OK (LAGraph_Workspace_New (&W, n, msg)) ;
+        int nvectors = 0 ;
+
+        // G2: the same graph with all edge weights equal to 1, for SSSP
+        OK (GrB_Matrix_new (&A, GrB_INT32, n, n)) ;
+        OK (GrB_assign (A, G->A, NULL, (int32_t) 1, GrB_ALL, n, GrB_ALL, n,
+            GrB_DESC_S)) ;
+        OK (LAGraph_New (&G2, &A, LAGraph_ADJACENCY_DIRECTED, msg)) ;
+        OK (GrB_Scalar_new (&Delta, GrB_INT32)) ;
+        OK (GrB_Scalar_setElement (Delta, 2)) ;
+
+        for (int trial = 0 ; trial < 3 ; trial++)
+        {
+            for (GrB_Index src = 0 ; src < n ; src += (n / 3) + 1)
+            {
+                // breadth-first search
+                bool ok = false ;
+                OK (LAGr_BreadthFirstSearch (&u, &v, G, src, msg)) ;
+                OK (LAGr_BreadthFirstSearch_Workspace (&u2, &v2, G, src, W,
+                    msg)) ;
+                OK (LAGraph_Vector_IsEqual (&ok, u, u2, msg)) ;
+                TEST_CHECK (ok) ;
+                OK (LG_check_bfs (u2, v2, G, src, msg)) ;
+                OK (GrB_free (&u)) ;
+                OK (GrB_free (&v)) ;
+                OK (GrB_free (&u2)) ;
+                OK (GrB_free (&v2)) ;
+
+                // level only
+                OK (LAGr_BreadthFirstSearch_Workspace (&u2, NULL, G, src, W,
+                    msg)) ;
+                OK (LG_check_bfs (u2, NULL, G, src, msg)) ;
+                OK (GrB_free (&u2)) ;
+
+                // single-source shortest path
+                OK (LAGr_SingleSourceShortestPath (&u, G2, src, Delta, msg)) ;
+                OK (LAGr_SingleSourceShortestPath_Workspace (&u2, G2, src,
+                    Delta, W, msg)) ;
+                OK (LAGraph_Vector_IsEqual (&ok, u, u2, msg)) ;
+                TEST_CHECK (ok) ;
+                OK (GrB_free (&u)) ;
+                OK (GrB_free (&u2)) ;
+            }
+
+            // pagerank
+            int iters = 0, iters2 = 0 ;
+            bool ok = false ;
+            OK (LAGr_PageRank (&u, &iters, G, 0.85, 1e-4, 100, msg)) ;
+            OK (LAGr_PageRank_Workspace (&u2, &iters2, G, 0.85, 1e-4, 100,
+                W, msg)) ;
+            TEST_CHECK (iters == iters2) ;
+            OK (LAGraph_Vector_IsEqual (&ok, u, u2, msg)) ;
+            TEST_CHECK (ok) ;
+            OK (GrB_free (&u)) ;
+            OK (GrB_free (&u2)) ;
+
+            // the vectors in the workspace are reused, not allocated again
+            if (trial == 0)
+            {
+                nvectors = W->nvectors ;
+                TEST_CHECK (nvectors > 0) ;
+            }
+            TEST_CHECK (W->nvectors == nvectors) ;
+            for (int i = 0 ; i < W->nvectors ; i++)
+            {
+                TEST_CHECK (!W->in_use [i]) ;
+            }
+        }
+
+        OK (LAGraph_Workspace_Free (&W, msg)) ;
+        TEST_CHECK (W == NULL) ;
+        OK (GrB_free (&Delta)) ;
+        OK (LAGraph_Delete (&G2, msg)) ;
+        OK (LAGraph_Delete (&G, msg)) ;
+    }
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_Workspace_allocs: measure the allocations a warm workspace saves
+//------------------------------------------------------------------------------
+
+// A dense vector taken from a warm workspace keeps its storage, so getting it
+// again must not allocate memory for its entries.  Sparse work vectors are
+// cleared, which frees their entries, so only the dense vectors are measured
+// here, first directly and then as used by PageRank.
+
+void test_Workspace_allocs (void)
+{
+    LAGraph_MemoryInfo info ;
+    OK (LAGraph_MemoryTracking (true, msg)) ;
+    OK (LAGraph_Init (msg)) ;
+
+    //--------------------------------------------------------------------------
+    // a dense vector from a cold and a warm workspace
+    //--------------------------------------------------------------------------
+
+    GrB_Index n = 10000 ;
+    int64_t entry_bytes = (int64_t) (n * sizeof (float)) ;
+    OK (LAGraph_Workspace_New (&W, n, msg)) ;
+
+    OK (LAGraph_MemoryStats_Reset (msg)) ;
+    OK (LAGraph_MemoryStats (&info, msg)) ;
+    int64_t base = info.bytes_current ;
+    OK (LG_Workspace_Dense (&u, W, GrB_FP32, n, 1, msg)) ;
+    OK (LAGraph_MemoryStats (&info, msg)) ;
+    TEST_CHECK (info.bytes_peak - base >= entry_bytes) ;
+    LG_Workspace_Release (W, &u) ;
+    TEST_CHECK (u == NULL) ;
+
+    OK (LAGraph_MemoryStats_Reset (msg)) ;
+    OK (LAGraph_MemoryStats (&info, msg)) ;
+    base = info.bytes_current ;
+    OK (LG_Workspace_Dense (&u, W, GrB_FP32, n, 2, msg)) ;
+    OK (LAGraph_MemoryStats (&info, msg)) ;
+    printf ("\nwarm dense vector: %g bytes allocated\n",
+        (double) (info.bytes_peak - base)) ;
+    TEST_CHECK (info.bytes_peak - base < entry_bytes) ;
+    TEST_CHECK (info.bytes_current == base) ;
+
+    // all entries of the reused vector are overwritten
+    GrB_Index nvals ;
+    OK (GrB_Vector_nvals (&nvals, u)) ;
+    TEST_CHECK (nvals == n) ;
+    float x = 0 ;
+    OK (GrB_Vector_extractElement (&x, u, 0)) ;
+    TEST_CHECK (x == 2) ;
+    OK (GrB_Vector_extractElement (&x, u, n-1)) ;
+    TEST_CHECK (x == 2) ;
+    LG_Workspace_Release (W, &u) ;
+    OK (LAGraph_Workspace_Free (&W, msg)) ;
+
+    //--------------------------------------------------------------------------
+    // PageRank with and without a warm workspace
+    //--------------------------------------------------------------------------
+
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "karate.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+    OK (LAGraph_Cached_OutDegree (G, msg)) ;
+    OK (GrB_Matrix_nrows (&n, G->A)) ;
+    OK (LAGraph_Workspace_New (&W, n, msg)) ;
+    int iters ;
+
+    // warm up the workspace
+    OK (LAGr_PageRank_Workspace (&u, &iters, G, 0.85, 1e-4, 100, W, msg)) ;
+    OK (GrB_free (&u)) ;
+
+    // without a workspace
+    OK (LAGraph_MemoryStats_Reset (msg)) ;
+    OK (LAGraph_MemoryStats (&info, msg)) ;
+    base = info.bytes_current ;
+    OK (LAGr_PageRank (&u, &iters, G, 0.85, 1e-4, 100, msg)) ;
+    OK (LAGraph_MemoryStats (&info, msg)) ;
+    int64_t bytes_cold = info.bytes_peak - base ;
+    int64_t nallocs_cold = info.nallocs ;
+    OK (GrB_free (&u)) ;
+
+    // with the warm workspace
+    OK (LAGraph_MemoryStats_Reset (msg)) ;
+    OK (LAGraph_MemoryStats (&info, msg)) ;
+    base = info.bytes_current ;
+    OK (LAGr_PageRank_Workspace (&u, &iters, G, 0.85, 1e-4, 100, W, msg)) ;
+    OK (LAGraph_MemoryStats (&info, msg)) ;
+    int64_t bytes_warm = info.bytes_peak - base ;
+    int64_t nallocs_warm = info.nallocs ;
+    OK (GrB_free (&u)) ;
+
+    // the workspace keeps the scores t that are not returned, so the peak of
+    // the warm call is lower by at least their size
+    printf ("PageRank: %g bytes, %g allocations without a workspace; "
+        "%g bytes, %g allocations with one\n", (double) bytes_cold,
+        (double) nallocs_cold, (double) bytes_warm, (double) nallocs_warm) ;
+    TEST_CHECK (bytes_warm + (int64_t) (n * sizeof (float)) <= bytes_cold) ;
+    TEST_CHECK (nallocs_warm < nallocs_cold) ;
+
+    OK (LAGraph_Workspace_Free (&W, msg)) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+    OK (LAGraph_Finalize (msg)) ;
+    OK (LAGraph_MemoryTracking (false, msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// test_Workspace_errors
+//------------------------------------------------------------------------------
+
+void test_Workspace_errors (void)
+{
+    OK (LAGraph_Init (msg)) ;
+
+    int result = LAGraph_Workspace_New (NULL, 10, msg) ;
+    TEST_CHECK (result == GrB_NULL_POINTER) ;
+    OK (LAGraph_Workspace_Free (NULL, msg)) ;
+    OK (LAGraph_Workspace_Free (&W, msg)) ;
+
+    // the workspace must match the size of the graph
+    snprintf (filename, LEN, LG_DATA_DIR "%s", "karate.mtx") ;
+    FILE *f = fopen (filename, "r") ;
+    TEST_CHECK (f != NULL) ;
+    OK (LAGraph_MMRead (&A, f, msg)) ;
+    OK (fclose (f)) ;
+    OK (LAGraph_New (&G, &A, LAGraph_ADJACENCY_UNDIRECTED, msg)) ;
+    OK (LAGraph_Cached_OutDegree (G, msg)) ;
+    OK (LAGraph_Workspace_New (&W, 10, msg)) ;
+    int iters ;
+    result = LAGr_PageRank_Workspace (&u, &iters, G, 0.85, 1e-4, 100, W, msg) ;
+    TEST_CHECK (result == GrB_DIMENSION_MISMATCH) ;
+    TEST_CHECK (u == NULL) ;
+    OK (LAGraph_Workspace_Free (&W, msg)) ;
+    OK (LAGraph_Delete (&G, msg)) ;
+
+    OK (LAGraph_Finalize (msg)) ;
+}
+
+//------------------------------------------------------------------------------
+// TEST_LIST: the list of tasks for this entire test
+//------------------------------------------------------------------------------
+
+TEST_LIST =
+{
+    {"Workspace", test_Workspace},
+    {"Workspace_allocs", test_Workspace_allocs},
+    {"Workspace_errors", test_Workspace_errors},
+    {NULL, NULL}
+} ;
@@ -109,6 +109,10 @@ int LAGr_Init
         "LAGr*_Init can only be called once") ;
     LG_init_has_been_called = true ;
 
+    // use counting functions if LAGraph_MemoryTracking has been enabled
+    LG_Memory_Track (&user_malloc_function, &user_calloc_function,
+        &user_realloc_function, &user_free_function) ;
+
     //--------------------------------------------------------------------------
     // start GraphBLAS
     //--------------------------------------------------------------------------
@@ -33,24 +33,49 @@
 // the permutation (or P [k] = j if column j is the kth column in the
 // permutation, with byout false).
 
-#define LG_FREE_WORK                    \
-{                                       \
-    LAGraph_Free ((void **) &W, NULL) ; \
-    LAGraph_Free ((void **) &D, NULL) ; \
+// LAGr_SortByDegreeBuckets also returns the boundaries of the degree buckets
+// of P, so that degree-bucketed algorithms can use them directly.  Bucket has
+// size nbuckets+1, where nbuckets is one more than the largest degree, and
+// bucket b is P [Bucket [b] ... Bucket [b+1]-1].  If ascending is true, bucket
+// b holds the nodes of degree b.  Otherwise it holds the nodes of degree
+// nbuckets-1-b.  Buckets may be empty.
+
+// Degrees are integers in the range 0 to n, so the nodes are sorted with a
+// parallel counting sort in O(n + nthreads*maxdeg) time: each thread counts
+// the degrees in its slice of the nodes, a cumulative sum of the counts
+// (degree-major, slice-minor) gives the position of each degree in each
+// slice, and each thread then places its nodes in order.  Since the slices
+// are in order of node id, ties are broken by node id.  The number of threads
+// is reduced if needed so that the counts take O(n) space.
+
+#define LG_FREE_WORK                        \
+{                                           \
+    LAGraph_Free ((void **) &W, NULL) ;     \
+    LAGraph_Free ((void **) &D, NULL) ;     \
+    LAGraph_Free ((void **) &Hist, NULL) ;  \
+    LAGraph_Free ((void **) &Slice, NULL) ; \
 }
 
-#define LG_FREE_ALL                     \
-{                                       \
-    LG_FREE_WORK ;                      \
-    LAGraph_Free ((void **) &P, NULL) ; \
+#define LG_FREE_ALL                         \
+{                                           \
+    LG_FREE_WORK ;                          \
+    LAGraph_Free ((void **) &P, NULL) ;     \
+    LAGraph_Free ((void **) &B, NULL) ;     \
 }
 
 #include "LG_internal.h"
 
-int LAGr_SortByDegree
+//------------------------------------------------------------------------------
+// LAGr_SortByDegreeBuckets: sort by degree, and return the degree buckets
+//------------------------------------------------------------------------------
+
+int LAGr_SortByDegreeBuckets
 (
     // output:
     int64_t **P_handle,     // permutation vector of size n
+    int64_t **Bucket_handle,    // bucket boundaries of size nbuckets+1, or
+                            // NULL if not needed
+    int64_t *nbuckets,      // # of buckets (maximum degree + 1), or NULL
     // input:
     const LAGraph_Graph G,  // graph of n nodes
     bool byout,             // if true, sort G->out_degree, else G->in_degree
@@ -65,10 +90,14 @@ int LAGr_SortByDegree
 
     LG_CLEAR_MSG ;
     int64_t *P = NULL ;
+    int64_t *B = NULL ;
     int64_t *W = NULL ;
     int64_t *D = NULL ;
+    int64_t *Hist = NULL ;
+    int64_t *Slice = NULL ;
     LG_ASSERT_MSG (P_handle != NULL, GrB_NULL_POINTER, "&P != NULL") ;
     (*P_handle) = NULL ;
+    if (Bucket_handle != NULL) (*Bucket_handle) = NULL ;
     LG_TRY (LAGraph_CheckGraph (G, msg)) ;
 
     GrB_Vector Degree ;
@@ -111,46 +140,101 @@ int LAGr_SortByDegree
     int64_t *W1 = W + n ;
 
     //--------------------------------------------------------------------------
-    // construct the pair [D,P] to sort
+    // get the degrees, and the maximum degree
     //--------------------------------------------------------------------------
 
+    int64_t k ;
     #pragma omp parallel for num_threads(nthreads) schedule(static)
-    for (int64_t k = 0 ; k < n ; k++)
+    for (k = 0 ; k < n ; k++)
     {
         D [k] = 0 ;
-        P [k] = k ;
     }
 
     // extract the degrees
     GrB_Index nvals = n ;
     GRB_TRY (GrB_Vector_extractTuples ((GrB_Index *) W0, W1, &nvals, Degree)) ;
 
-    if (ascending)
+    int64_t maxdeg = 0 ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(max:maxdeg)
+    for (k = 0 ; k < nvals ; k++)
     {
-        // sort [D,P] in ascending order of degree, tie-breaking on P
+        D [W0 [k]] = W1 [k] ;
+        maxdeg = LAGRAPH_MAX (maxdeg, W1 [k]) ;
+    }
+
+    LG_TRY (LAGraph_Free ((void **) &W, NULL)) ;
+
+    if (!ascending)
+    {
+        // sort by maxdeg - degree, so the largest degree is first
         #pragma omp parallel for num_threads(nthreads) schedule(static)
-        for (int64_t k = 0 ; k < nvals ; k++)
+        for (k = 0 ; k < n ; k++)
         {
-            D [W0 [k]] = W1 [k] ;
+            D [k] = maxdeg - D [k] ;
         }
     }
-    else
+
+    //--------------------------------------------------------------------------
+    // count the degrees in each slice of the nodes
+    //--------------------------------------------------------------------------
+
+    // limit the size of the counts to O(n)
+    int64_t nb = maxdeg + 1 ;
+    nthreads = LAGRAPH_MIN (nthreads, LAGRAPH_MAX (n / nb, 1)) ;
+
+    LG_TRY (LAGraph_Malloc ((void **) &Slice, nthreads + 1, sizeof (int64_t),
+        msg)) ;
+    LG_TRY (LAGraph_Calloc ((void **) &Hist, nthreads * nb, sizeof (int64_t),
+        msg)) ;
+    LG_eslice (Slice, n, nthreads) ;
+
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+    for (tid = 0 ; tid < nthreads ; tid++)
     {
-        // sort [D,P] in descending order of degree, tie-breaking on P
-        #pragma omp parallel for num_threads(nthreads) schedule(static)
-        for (int64_t k = 0 ; k < nvals ; k++)
+        int64_t *H = Hist + tid * nb ;
+        for (int64_t i = Slice [tid] ; i < Slice [tid+1] ; i++)
         {
-            D [W0 [k]] = -W1 [k] ;
+            H [D [i]]++ ;
         }
     }
 
-    LG_TRY (LAGraph_Free ((void **) &W, NULL)) ;
+    //--------------------------------------------------------------------------
+    // cumulative sum of the counts, and the bucket boundaries
+    //--------------------------------------------------------------------------
+
+    if (Bucket_handle != NULL)
+    {
+        LG_TRY (LAGraph_Malloc ((void **) &B, nb + 1, sizeof (int64_t), msg)) ;
+    }
+
+    int64_t s = 0 ;
+    for (int64_t b = 0 ; b < nb ; b++)
+    {
+        if (B != NULL) B [b] = s ;
+        for (tid = 0 ; tid < nthreads ; tid++)
+        {
+            int64_t c = Hist [tid * nb + b] ;
+            Hist [tid * nb + b] = s ;
+            s += c ;
+        }
+    }
+    if (B != NULL) B [nb] = n ;
 
     //--------------------------------------------------------------------------
-    // sort by degrees, with ties by node id
+    // place each node in its bucket, in order of node id
     //--------------------------------------------------------------------------
 
-    LG_TRY (LG_msort2 (D, P, n, msg)) ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+    for (tid = 0 ; tid < nthreads ; tid++)
+    {
+        int64_t *H = Hist + tid * nb ;
+        for (int64_t i = Slice [tid] ; i < Slice [tid+1] ; i++)
+        {
+            P [H [D [i]]++] = i ;
+        }
+    }
 
     //--------------------------------------------------------------------------
     // free workspace and return result
@@ -158,5 +242,26 @@ int LAGr_SortByDegree
 
     LG_FREE_WORK ;
     (*P_handle) = P ;
+    if (Bucket_handle != NULL) (*Bucket_handle) = B ;
+    if (nbuckets != NULL) (*nbuckets) = nb ;
     return (GrB_SUCCESS) ;
 }
+
+//------------------------------------------------------------------------------
+// LAGr_SortByDegree: sort by degree
+//------------------------------------------------------------------------------
+
+int LAGr_SortByDegree
+(
+    // output:
+    int64_t **P_handle,     // permutation vector of size n
+    // input:
+    const LAGraph_Graph G,  // graph of n nodes
+    bool byout,             // if true, sort G->out_degree, else G->in_degree
+    bool ascending,         // sort in ascending or descending order
+    char *msg
+)
+{
+    return (LAGr_SortByDegreeBuckets (P_handle, NULL, NULL, G, byout,
+        ascending, msg)) ;
+}
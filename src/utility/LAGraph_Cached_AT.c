@@ -58,5 +58,6 @@ int LAGraph_Cached_AT
     GRB_TRY (GrB_transpose (AT, NULL, NULL, A, NULL)) ;
     G->AT = AT ;
 
-    return (GrB_SUCCESS) ;
+    // free other cached properties if G exceeds its memory budget
+    return (LG_Graph_Budget (G, LG_KEEP_AT, msg)) ;
 }
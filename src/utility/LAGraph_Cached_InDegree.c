@@ -96,6 +96,7 @@ int LAGraph_Cached_InDegree
 
     G->in_degree = in_degree ;
 
+    // free other cached properties if G exceeds its memory budget
     LG_FREE_WORK ;
-    return (GrB_SUCCESS) ;
+    return (LG_Graph_Budget (G, LG_KEEP_IN_DEGREE, msg)) ;
 }
@@ -73,6 +73,7 @@ int LAGraph_Cached_OutDegree
 
     G->out_degree = out_degree ;
 
+    // free other cached properties if G exceeds its memory budget
     LG_FREE_WORK ;
-    return (GrB_SUCCESS) ;
+    return (LG_Graph_Budget (G, LG_KEEP_OUT_DEGREE, msg)) ;
 }
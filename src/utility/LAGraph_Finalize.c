@@ -76,6 +76,12 @@ int LAGraph_Finalize (char *msg)
     //--------------------------------------------------------------------------
 
     GRB_TRY (GrB_finalize ( )) ;
-    return (GrB_SUCCESS) ;
+
+    // free any blocks cached by the memory pool, if it was used
+    LG_TRY (LAGraph_Pool_Trim (msg)) ;
+
+    // discard all trace events; this is not called with LG_TRY, which would
+    // trace the call itself
+    return (LAGraph_Trace_Clear (msg)) ;
 }
 
@@ -39,3 +39,11 @@ int LG_nthreads_inner ; // # of threads to use at the lower level of a nested
                         // Default: the value obtained by omp_get_max_threads
                         // if OpenMP is in use, or 1 otherwise.
 
+
+//------------------------------------------------------------------------------
+// tracing
+//------------------------------------------------------------------------------
+
+// This is modified by LAGraph_Tracing, and tested by LG_TRY and GRB_TRY.
+
+bool LG_trace_enabled = false ;
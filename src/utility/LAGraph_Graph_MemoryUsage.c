@@ -0,0 +1,184 @@
+//------------------------------------------------------------------------------
+// LAGraph_Graph_MemoryUsage: memory used by a graph and its cached properties
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2021 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+// See additional acknowledgments in the LICENSE file,
+// or contact permission@sei.cmu.edu for the full terms.
+
+//------------------------------------------------------------------------------
+
+// With SuiteSparse:GraphBLAS, the size of each component is given exactly by
+// GxB_*_memoryUsage.  Otherwise, it is estimated from the number of entries
+// and the size of the type, as if each matrix were held in CSR form and each
+// vector in sparse form.
+
+// If G->memory_budget is not LAGRAPH_UNKNOWN, LG_Graph_Budget (called by
+// LAGraph_Cached_AT, LAGraph_Cached_OutDegree, and LAGraph_Cached_InDegree)
+// and LAGraph_Graph_EnforceBudget free cached properties until G fits within
+// its budget.  G->AT is freed first: it is usually as large as G->A and can be
+// recomputed with a single transpose.  G->in_degree and G->out_degree are
+// freed next.  The scalars G->emin and G->emax are never freed, since they
+// take almost no memory.  G->A is never freed, so a graph can still exceed
+// its budget if G->A alone is larger.
+
+#include "LG_internal.h"
+
+//------------------------------------------------------------------------------
+// LG_matrix_bytes, LG_vector_bytes, LG_scalar_bytes: size of an object
+//------------------------------------------------------------------------------
+
+static int LG_matrix_bytes (size_t *bytes, GrB_Matrix A, char *msg)
+{
+    (*bytes) = 0 ;
+    if (A == NULL) return (GrB_SUCCESS) ;
+    #if LAGRAPH_SUITESPARSE
+    GRB_TRY (GxB_Matrix_memoryUsage (bytes, A)) ;
+    #else
+    GrB_Index nrows, nvals ;
+    GrB_Type type ;
+    size_t typesize ;
+    char type_name [LAGRAPH_MAX_NAME_LEN] ;
+    GRB_TRY (GrB_Matrix_nrows (&nrows, A)) ;
+    GRB_TRY (GrB_Matrix_nvals (&nvals, A)) ;
+    LG_TRY (LAGraph_Matrix_TypeName (type_name, A, msg)) ;
+    LG_TRY (LAGraph_TypeFromName (&type, type_name, msg)) ;
+    LG_TRY (LAGraph_SizeOfType (&typesize, type, msg)) ;
+    (*bytes) = (nrows + 1) * sizeof (GrB_Index)
+             + nvals * (sizeof (GrB_Index) + typesize) ;
+    #endif
+    return (GrB_SUCCESS) ;
+}
+
+static int LG_vector_bytes (size_t *bytes, GrB_Vector v, char *msg)
+{
+    (*bytes) = 0 ;
+    if (v == NULL) return (GrB_SUCCESS) ;
+    #if LAGRAPH_SUITESPARSE
+    GRB_TRY (GxB_Vector_memoryUsage (bytes, v)) ;
+    #else
+    GrB_Index nvals ;
+    GrB_Type type ;
+    size_t typesize ;
+    char type_name [LAGRAPH_MAX_NAME_LEN] ;
+    GRB_TRY (GrB_Vector_nvals (&nvals, v)) ;
+    LG_TRY (LAGraph_Vector_TypeName (type_name, v, msg)) ;
+    LG_TRY (LAGraph_TypeFromName (&type, type_name, msg)) ;
+    LG_TRY (LAGraph_SizeOfType (&typesize, type, msg)) ;
+    (*bytes) = nvals * (sizeof (GrB_Index) + typesize) ;
+    #endif
+    return (GrB_SUCCESS) ;
+}
+
+static int LG_scalar_bytes (size_t *bytes, GrB_Scalar s, char *msg)
+{
+    (*bytes) = 0 ;
+    if (s == NULL) return (GrB_SUCCESS) ;
+    #if LAGRAPH_SUITESPARSE
+    GRB_TRY (GxB_Scalar_memoryUsage (bytes, s)) ;
+    #else
+    GrB_Type type ;
+    char type_name [LAGRAPH_MAX_NAME_LEN] ;
+    LG_TRY (LAGraph_Scalar_TypeName (type_name, s, msg)) ;
+    LG_TRY (LAGraph_TypeFromName (&type, type_name, msg)) ;
+    LG_TRY (LAGraph_SizeOfType (bytes, type, msg)) ;
+    #endif
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Graph_MemoryUsage
+//------------------------------------------------------------------------------
+
+int LAGraph_Graph_MemoryUsage
+(
+    // output:
+    LAGraph_GraphMemory *usage, // memory used by each component of G
+    // input:
+    const LAGraph_Graph G,
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    LG_ASSERT (usage != NULL, GrB_NULL_POINTER) ;
+    LG_ASSERT (G != NULL, GrB_NULL_POINTER) ;
+
+    //--------------------------------------------------------------------------
+    // find the size of each component
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LG_matrix_bytes (&(usage->A), G->A, msg)) ;
+    LG_TRY (LG_matrix_bytes (&(usage->AT), G->AT, msg)) ;
+    LG_TRY (LG_vector_bytes (&(usage->out_degree), G->out_degree, msg)) ;
+    LG_TRY (LG_vector_bytes (&(usage->in_degree), G->in_degree, msg)) ;
+    LG_TRY (LG_scalar_bytes (&(usage->emin), G->emin, msg)) ;
+    LG_TRY (LG_scalar_bytes (&(usage->emax), G->emax, msg)) ;
+    usage->total = sizeof (struct LAGraph_Graph_struct)
+        + usage->A + usage->AT + usage->out_degree + usage->in_degree
+        + usage->emin + usage->emax ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_Graph_Budget: free cached properties until G fits within its budget
+//------------------------------------------------------------------------------
+
+int LG_Graph_Budget
+(
+    // input/output:
+    LAGraph_Graph G,
+    // input:
+    int keep,               // cached properties not to free (LG_KEEP_*)
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    LG_ASSERT (G != NULL, GrB_NULL_POINTER) ;
+    if (G->memory_budget < 0)
+    {
+        // no budget
+        return (GrB_SUCCESS) ;
+    }
+
+    LAGraph_GraphMemory usage ;
+    LG_TRY (LAGraph_Graph_MemoryUsage (&usage, G, msg)) ;
+    size_t budget = (size_t) G->memory_budget ;
+
+    if (usage.total > budget && G->AT != NULL && !(keep & LG_KEEP_AT))
+    {
+        GRB_TRY (GrB_free (&(G->AT))) ;
+        usage.total -= usage.AT ;
+    }
+    if (usage.total > budget && G->in_degree != NULL
+        && !(keep & LG_KEEP_IN_DEGREE))
+    {
+        GRB_TRY (GrB_free (&(G->in_degree))) ;
+        usage.total -= usage.in_degree ;
+    }
+    if (usage.total > budget && G->out_degree != NULL
+        && !(keep & LG_KEEP_OUT_DEGREE))
+    {
+        GRB_TRY (GrB_free (&(G->out_degree))) ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Graph_EnforceBudget
+//------------------------------------------------------------------------------
+
+int LAGraph_Graph_EnforceBudget
+(
+    // input/output:
+    LAGraph_Graph G,
+    char *msg
+)
+{
+    return (LG_Graph_Budget (G, 0, msg)) ;
+}
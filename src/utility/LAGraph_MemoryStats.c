@@ -0,0 +1,309 @@
+//------------------------------------------------------------------------------
+// LAGraph_MemoryStats: memory accounting for LAGraph and GraphBLAS
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2021 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+// See additional acknowledgments in the LICENSE file,
+// or contact permission@sei.cmu.edu for the full terms.
+
+//------------------------------------------------------------------------------
+
+// Memory accounting is enabled by calling LAGraph_MemoryTracking (true, msg)
+// before LAGraph_Init or LAGr_Init.  LAGr_Init then passes the LG_mem_*
+// functions below to GraphBLAS and to LAGraph_Malloc, etc, in place of the
+// user's functions.  Each block is allocated by the user's functions with a
+// 16-byte header that holds its size, so that every allocation and free done
+// by LAGraph or GraphBLAS is counted.  The counts are updated in a critical
+// section, so accounting is meant for measuring memory use, not for
+// production runs where allocation speed matters.
+
+// LAGr_* algorithms record their memory high-water mark with LG_Memory_Begin
+// and LG_Memory_End: the max # of bytes allocated during the call, above the
+// # of bytes allocated when it started.  Nested calls are included in the
+// high-water mark of the caller.  If several algorithms run at the same time
+// in different user threads, the memory of each is included in the others.
+
+#include "LG_internal.h"
+
+//------------------------------------------------------------------------------
+// global accounting state
+//------------------------------------------------------------------------------
+
+#define LG_MEM_HEADER 16
+#define LG_MEMORY_NALGORITHMS 64
+
+static bool LG_mem_tracking = false ;
+
+// the user's functions, as given to LAGr_Init
+static void * (* LG_mem_user_malloc  ) (size_t)         = NULL ;
+static void * (* LG_mem_user_calloc  ) (size_t, size_t) = NULL ;
+static void * (* LG_mem_user_realloc ) (void *, size_t) = NULL ;
+static void   (* LG_mem_user_free    ) (void *)         = NULL ;
+
+static LAGraph_MemoryInfo LG_mem ;
+static int64_t LG_mem_region_peak = 0 ;
+
+static struct
+{
+    const char *name ;
+    int64_t peak ;
+    int64_t ncalls ;
+}
+LG_mem_alg [LG_MEMORY_NALGORITHMS] ;
+static int LG_mem_nalg = 0 ;
+
+// LG_mem_count: account for a change of delta bytes
+static void LG_mem_count (int64_t delta, int64_t nallocs, int64_t nfrees,
+    int64_t nreallocs)
+{
+    #pragma omp critical (LG_mem_critical)
+    {
+        LG_mem.bytes_current += delta ;
+        LG_mem.nallocs += nallocs ;
+        LG_mem.nfrees += nfrees ;
+        LG_mem.nreallocs += nreallocs ;
+        LG_mem.bytes_peak = LAGRAPH_MAX (LG_mem.bytes_peak,
+            LG_mem.bytes_current) ;
+        LG_mem_region_peak = LAGRAPH_MAX (LG_mem_region_peak,
+            LG_mem.bytes_current) ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// LG_mem_malloc, LG_mem_calloc, LG_mem_realloc, LG_mem_free
+//------------------------------------------------------------------------------
+
+static void *LG_mem_malloc (size_t size)
+{
+    if (size > SIZE_MAX - LG_MEM_HEADER) return (NULL) ;
+    char *p = LG_mem_user_malloc (size + LG_MEM_HEADER) ;
+    if (p == NULL) return (NULL) ;
+    (*((size_t *) p)) = size ;
+    LG_mem_count ((int64_t) size, 1, 0, 0) ;
+    return ((void *) (p + LG_MEM_HEADER)) ;
+}
+
+static void *LG_mem_calloc (size_t nitems, size_t itemsize)
+{
+    size_t size = nitems * itemsize ;
+    if (itemsize != 0 && size / itemsize != nitems) return (NULL) ;
+    if (size > SIZE_MAX - LG_MEM_HEADER) return (NULL) ;
+    char *p ;
+    if (LG_mem_user_calloc != NULL)
+    {
+        p = LG_mem_user_calloc (size + LG_MEM_HEADER, 1) ;
+    }
+    else
+    {
+        p = LG_mem_user_malloc (size + LG_MEM_HEADER) ;
+        if (p != NULL) memset (p, 0, size + LG_MEM_HEADER) ;
+    }
+    if (p == NULL) return (NULL) ;
+    (*((size_t *) p)) = size ;
+    LG_mem_count ((int64_t) size, 1, 0, 0) ;
+    return ((void *) (p + LG_MEM_HEADER)) ;
+}
+
+static void LG_mem_free (void *p)
+{
+    if (p == NULL) return ;
+    char *h = ((char *) p) - LG_MEM_HEADER ;
+    LG_mem_count (-((int64_t) (*((size_t *) h))), 0, 1, 0) ;
+    LG_mem_user_free (h) ;
+}
+
+static void *LG_mem_realloc (void *p, size_t size)
+{
+    if (p == NULL) return (LG_mem_malloc (size)) ;
+    if (size > SIZE_MAX - LG_MEM_HEADER) return (NULL) ;
+    char *h = ((char *) p) - LG_MEM_HEADER ;
+    size_t oldsize = (*((size_t *) h)) ;
+    char *hnew ;
+    if (LG_mem_user_realloc != NULL)
+    {
+        hnew = LG_mem_user_realloc (h, size + LG_MEM_HEADER) ;
+        if (hnew == NULL) return (NULL) ;
+    }
+    else
+    {
+        hnew = LG_mem_user_malloc (size + LG_MEM_HEADER) ;
+        if (hnew == NULL) return (NULL) ;
+        memcpy (hnew, h, LAGRAPH_MIN (size, oldsize) + LG_MEM_HEADER) ;
+        LG_mem_user_free (h) ;
+    }
+    (*((size_t *) hnew)) = size ;
+    LG_mem_count (((int64_t) size) - ((int64_t) oldsize), 0, 0, 1) ;
+    return ((void *) (hnew + LG_MEM_HEADER)) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_Memory_Track: replace the user's memory functions, if tracking
+//------------------------------------------------------------------------------
+
+// Called by LAGr_Init, before the functions are passed to GraphBLAS.  If
+// memory tracking is enabled, the user's functions are saved and replaced
+// with the LG_mem_* functions.  Otherwise, they are left unchanged.
+
+void LG_Memory_Track
+(
+    // input/output:
+    void * (* (*user_malloc_function ) ) (size_t),
+    void * (* (*user_calloc_function ) ) (size_t, size_t),
+    void * (* (*user_realloc_function) ) (void *, size_t),
+    void   (* (*user_free_function   ) ) (void *)
+)
+{
+    if (!LG_mem_tracking) return ;
+    LG_mem_user_malloc  = (*user_malloc_function ) ;
+    LG_mem_user_calloc  = (*user_calloc_function ) ;
+    LG_mem_user_realloc = (*user_realloc_function) ;
+    LG_mem_user_free    = (*user_free_function   ) ;
+    (*user_malloc_function ) = LG_mem_malloc ;
+    (*user_calloc_function ) = LG_mem_calloc ;
+    (*user_realloc_function) = LG_mem_realloc ;
+    (*user_free_function   ) = LG_mem_free ;
+}
+
+//------------------------------------------------------------------------------
+// LG_Memory_Begin and LG_Memory_End: record the high-water mark of a method
+//------------------------------------------------------------------------------
+
+void LG_Memory_Begin
+(
+    // output:
+    LG_memory_region *region
+)
+{
+    if (!LG_mem_tracking) return ;
+    #pragma omp critical (LG_mem_critical)
+    {
+        region->base = LG_mem.bytes_current ;
+        region->outer_peak = LG_mem_region_peak ;
+        LG_mem_region_peak = LG_mem.bytes_current ;
+    }
+}
+
+int64_t LG_Memory_End
+(
+    // input:
+    const LG_memory_region *region,
+    const char *name            // name of the method; must be a constant.
+                                // If NULL, the peak is not recorded.
+)
+{
+    if (!LG_mem_tracking) return (-1) ;
+    int64_t peak ;
+    #pragma omp critical (LG_mem_critical)
+    {
+        peak = LG_mem_region_peak - region->base ;
+        LG_mem_region_peak = LAGRAPH_MAX (LG_mem_region_peak,
+            region->outer_peak) ;
+        int k = (name == NULL) ? LG_MEMORY_NALGORITHMS : 0 ;
+        while (k < LG_mem_nalg && strcmp (LG_mem_alg [k].name, name) != 0)
+        {
+            k++ ;
+        }
+        if (k == LG_mem_nalg && k < LG_MEMORY_NALGORITHMS)
+        {
+            LG_mem_alg [k].name = name ;
+            LG_mem_alg [k].peak = 0 ;
+            LG_mem_alg [k].ncalls = 0 ;
+            LG_mem_nalg++ ;
+        }
+        if (k < LG_mem_nalg)
+        {
+            LG_mem_alg [k].peak = LAGRAPH_MAX (LG_mem_alg [k].peak, peak) ;
+            LG_mem_alg [k].ncalls++ ;
+        }
+    }
+    return (peak) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_MemoryTracking: enable or disable memory accounting
+//------------------------------------------------------------------------------
+
+int LAGraph_MemoryTracking
+(
+    // input:
+    bool enable,
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    LG_mem_tracking = enable ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_MemoryStats: return the memory counts
+//------------------------------------------------------------------------------
+
+int LAGraph_MemoryStats
+(
+    // output:
+    LAGraph_MemoryInfo *info,
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    LG_ASSERT (info != NULL, GrB_NULL_POINTER) ;
+    #pragma omp critical (LG_mem_critical)
+    {
+        (*info) = LG_mem ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_MemoryStats_Algorithm: return the high-water mark of an algorithm
+//------------------------------------------------------------------------------
+
+int LAGraph_MemoryStats_Algorithm
+(
+    // output:
+    int64_t *peak,          // max # of bytes used by one call
+    int64_t *ncalls,        // # of calls recorded
+    // input:
+    const char *algorithm,  // name of the algorithm, such as "LAGr_PageRank"
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    LG_ASSERT (peak != NULL && ncalls != NULL && algorithm != NULL,
+        GrB_NULL_POINTER) ;
+    (*peak) = 0 ;
+    (*ncalls) = 0 ;
+    #pragma omp critical (LG_mem_critical)
+    {
+        for (int k = 0 ; k < LG_mem_nalg ; k++)
+        {
+            if (strcmp (LG_mem_alg [k].name, algorithm) == 0)
+            {
+                (*peak) = LG_mem_alg [k].peak ;
+                (*ncalls) = LG_mem_alg [k].ncalls ;
+                break ;
+            }
+        }
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_MemoryStats_Reset: reset the peak and the per-algorithm records
+//------------------------------------------------------------------------------
+
+int LAGraph_MemoryStats_Reset (char *msg)
+{
+    LG_CLEAR_MSG ;
+    #pragma omp critical (LG_mem_critical)
+    {
+        LG_mem.bytes_peak = LG_mem.bytes_current ;
+        LG_mem.nallocs = 0 ;
+        LG_mem.nfrees = 0 ;
+        LG_mem.nreallocs = 0 ;
+        LG_mem_nalg = 0 ;
+    }
+    return (GrB_SUCCESS) ;
+}
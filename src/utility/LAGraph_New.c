@@ -64,6 +64,7 @@ int LAGraph_New
     (*G)->emin_state = LAGRAPH_UNKNOWN ;
     (*G)->emax = NULL ;
     (*G)->emax_state = LAGRAPH_UNKNOWN ;
+    (*G)->memory_budget = LAGRAPH_UNKNOWN ;
 
     //--------------------------------------------------------------------------
     // assign its primary components
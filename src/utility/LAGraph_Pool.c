@@ -0,0 +1,437 @@
+//------------------------------------------------------------------------------
+// LAGraph_Pool: a thread-caching size-class memory pool
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2021 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+// See additional acknowledgments in the LICENSE file,
+// or contact permission@sei.cmu.edu for the full terms.
+
+//------------------------------------------------------------------------------
+
+// To use the pool for all memory allocated by LAGraph and GraphBLAS, these
+// four functions must be passed to LAGr_Init:
+
+//      LAGr_Init (GrB_NONBLOCKING, LAGraph_Pool_malloc, LAGraph_Pool_calloc,
+//          LAGraph_Pool_realloc, LAGraph_Pool_free, msg) ;
+
+// Each block starts with a 16-byte header that holds its kind and the size
+// requested by the user.  Requests of up to 1MB are rounded up to one of
+// LAGRAPH_POOL_NCLASSES size classes, of 32 bytes, 64 bytes, ... 1MB.  When a
+// block of a size class is freed, it is kept in a free list of the calling
+// thread, and the next request of the same class by that thread reuses it
+// without calling malloc.  Algorithms that allocate and free vectors of the
+// same size many times (one per BFS level, for example) thus reuse the same
+// few blocks, rather than fragmenting the heap.  Each thread keeps at most
+// LG_POOL_CACHE_BYTES bytes of free blocks of each class, and the caches of
+// all threads together hold at most LAGRAPH_POOL_MAX_CACHED bytes; any more
+// are returned to free.  A block may be freed by a thread other than the one
+// that allocated it; it then moves to the cache of the thread that frees it.
+
+// Larger blocks are not cached.  On Linux, blocks of 2MB or more are mapped
+// with mmap and marked with madvise (..., MADV_HUGEPAGE), so that they can be
+// backed by transparent huge pages, and they are returned to the operating
+// system as soon as they are freed.  If mmap fails, the block is allocated
+// with malloc instead.  Smaller large blocks use malloc.
+
+// LAGraph_Pool_Stats returns the # of bytes in use, the peak, the # of bytes
+// held in the caches, and the # of allocations of each size class.
+// LAGraph_Pool_Trim frees all cached blocks and the caches of all threads; it
+// is called by LAGraph_Finalize.
+
+#include "LG_internal.h"
+
+#if defined ( __linux__ )
+#include <sys/mman.h>
+#define LG_POOL_MMAP 1
+#else
+#define LG_POOL_MMAP 0
+#endif
+
+#define LG_POOL_MIN_SHIFT 5             // the smallest class is 32 bytes
+#define LG_POOL_HEADER 16               // size of the block header
+#define LG_POOL_CACHE_BYTES (4 << 20)   // max cached bytes, per class/thread
+#define LG_POOL_HUGE (2 << 20)          // blocks this large use mmap
+#define LG_POOL_PAGE 4096
+
+// kinds of blocks: 0 to LAGRAPH_POOL_NCLASSES-1 are the size classes
+#define LG_POOL_LARGE (LAGRAPH_POOL_NCLASSES)
+#define LG_POOL_HUGEPAGE (LAGRAPH_POOL_NCLASSES+1)
+
+typedef struct
+{
+    uint64_t kind ;     // size class, LG_POOL_LARGE, or LG_POOL_HUGEPAGE
+    uint64_t size ;     // # of bytes requested by the user
+}
+LG_pool_header ;
+
+//------------------------------------------------------------------------------
+// thread caches
+//------------------------------------------------------------------------------
+
+// Each thread that frees a block of a size class creates its own cache.  The
+// next pointer of each free block is held in the block itself, just after its
+// header.  The caches of all threads are kept in a list so that
+// LAGraph_Pool_Trim can free their blocks.  Trim also frees the caches
+// themselves, including those of threads that have exited, and increments
+// the generation, so that each thread then creates a new cache when it next
+// frees a block.
+
+typedef struct LG_pool_cache_struct
+{
+    void *head [LAGRAPH_POOL_NCLASSES] ;    // free list of each class
+    int64_t count [LAGRAPH_POOL_NCLASSES] ; // # of blocks in each list
+    struct LG_pool_cache_struct *next ;     // next cache in the global list
+}
+LG_pool_cache ;
+
+static int64_t LG_pool_generation = 1 ;
+static LG_THREAD_LOCAL LG_pool_cache *LG_pool_my_cache = NULL ;
+static LG_THREAD_LOCAL int64_t LG_pool_my_generation = 0 ;
+static LG_pool_cache *LG_pool_caches = NULL ;
+
+// LG_pool_my: return the cache of this thread, or NULL if it has none or if
+// it has been freed by LAGraph_Pool_Trim
+static inline LG_pool_cache *LG_pool_my (void)
+{
+    int64_t generation ;
+    #pragma omp atomic read
+    generation = LG_pool_generation ;
+    return ((LG_pool_my_generation == generation) ? LG_pool_my_cache : NULL) ;
+}
+
+static LG_pool_cache *LG_pool_get_cache (void)
+{
+    LG_pool_cache *c = LG_pool_my ( ) ;
+    if (c == NULL)
+    {
+        c = calloc (1, sizeof (LG_pool_cache)) ;
+        if (c == NULL) return (NULL) ;
+        int64_t generation ;
+        #pragma omp atomic read
+        generation = LG_pool_generation ;
+        #pragma omp critical (LG_pool_critical)
+        {
+            c->next = LG_pool_caches ;
+            LG_pool_caches = c ;
+        }
+        LG_pool_my_cache = c ;
+        LG_pool_my_generation = generation ;
+    }
+    return (c) ;
+}
+
+//------------------------------------------------------------------------------
+// statistics
+//------------------------------------------------------------------------------
+
+static int64_t LG_pool_live = 0 ;
+static int64_t LG_pool_peak = 0 ;
+static int64_t LG_pool_cached = 0 ;
+static int64_t LG_pool_nallocs [LAGRAPH_POOL_NCLASSES+2] ;
+
+static void LG_pool_count (int64_t delta)
+{
+    int64_t live, peak ;
+    #pragma omp atomic capture
+    { LG_pool_live += delta ; live = LG_pool_live ; }
+    #pragma omp atomic read
+    peak = LG_pool_peak ;
+    if (live > peak)
+    {
+        #pragma omp critical (LG_pool_peak_critical)
+        {
+            if (live > LG_pool_peak) LG_pool_peak = live ;
+        }
+    }
+}
+
+static void LG_pool_cached_count (int64_t delta)
+{
+    #pragma omp atomic
+    LG_pool_cached += delta ;
+}
+
+// LG_pool_cache_reserve: reserve room for b more bytes in the caches, or
+// return false if that would exceed LAGRAPH_POOL_MAX_CACHED
+static bool LG_pool_cache_reserve (int64_t b)
+{
+    int64_t cached ;
+    #pragma omp atomic capture
+    { LG_pool_cached += b ; cached = LG_pool_cached ; }
+    if (cached <= LAGRAPH_POOL_MAX_CACHED) return (true) ;
+    LG_pool_cached_count (-b) ;
+    return (false) ;
+}
+
+//------------------------------------------------------------------------------
+// size classes
+//------------------------------------------------------------------------------
+
+// LG_pool_class: return the smallest class that holds size bytes, or
+// LG_POOL_LARGE if size is larger than the largest class.
+
+static inline int LG_pool_class (size_t size)
+{
+    int k = 0 ;
+    size_t b = ((size_t) 1) << LG_POOL_MIN_SHIFT ;
+    while (b < size && k < LAGRAPH_POOL_NCLASSES)
+    {
+        b <<= 1 ;
+        k++ ;
+    }
+    return (k) ;
+}
+
+static inline size_t LG_pool_class_size (int k)
+{
+    return (((size_t) 1) << (k + LG_POOL_MIN_SHIFT)) ;
+}
+
+// LG_pool_maplen: # of bytes mapped for a block of size bytes
+static inline size_t LG_pool_maplen (size_t size)
+{
+    size_t len = size + LG_POOL_HEADER ;
+    return (((len + LG_POOL_PAGE - 1) / LG_POOL_PAGE) * LG_POOL_PAGE) ;
+}
+
+// LG_pool_capacity: the # of bytes a block can hold
+static inline size_t LG_pool_capacity (const LG_pool_header *h)
+{
+    if (h->kind < LG_POOL_LARGE)
+    {
+        return (LG_pool_class_size ((int) h->kind)) ;
+    }
+    else if (h->kind == LG_POOL_HUGEPAGE)
+    {
+        return (LG_pool_maplen (h->size) - LG_POOL_HEADER) ;
+    }
+    return (h->size) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Pool_malloc
+//------------------------------------------------------------------------------
+
+LAGRAPH_PUBLIC
+void *LAGraph_Pool_malloc       // return pointer to allocated block of memory
+(
+    size_t size                 // # of bytes to allocate
+)
+{
+    size = LAGRAPH_MAX (size, 1) ;
+    // the header and the rounding to whole pages must not overflow
+    if (size > SIZE_MAX - LG_POOL_PAGE - LG_POOL_HEADER) return (NULL) ;
+    int k = LG_pool_class (size) ;
+    LG_pool_header *h = NULL ;
+
+    if (k < LG_POOL_LARGE)
+    {
+        // reuse a block from the cache of this thread, or malloc a new one
+        LG_pool_cache *c = LG_pool_my ( ) ;
+        if (c != NULL && c->head [k] != NULL)
+        {
+            h = (LG_pool_header *) c->head [k] ;
+            c->head [k] = *((void **) (h + 1)) ;
+            c->count [k]-- ;
+            LG_pool_cached_count (-((int64_t) LG_pool_class_size (k))) ;
+        }
+        else
+        {
+            h = malloc (LG_POOL_HEADER + LG_pool_class_size (k)) ;
+        }
+    }
+    #if LG_POOL_MMAP
+    else if (size >= LG_POOL_HUGE)
+    {
+        // map a large block, backed by huge pages if possible
+        size_t len = LG_pool_maplen (size) ;
+        void *p = mmap (NULL, len, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0) ;
+        if (p != MAP_FAILED)
+        {
+            #ifdef MADV_HUGEPAGE
+            madvise (p, len, MADV_HUGEPAGE) ;
+            #endif
+            h = (LG_pool_header *) p ;
+            k = LG_POOL_HUGEPAGE ;
+        }
+        else
+        {
+            // mmap failed; try malloc before reporting out of memory
+            h = malloc (LG_POOL_HEADER + size) ;
+        }
+    }
+    #endif
+    else
+    {
+        h = malloc (LG_POOL_HEADER + size) ;
+    }
+
+    if (h == NULL) return (NULL) ;
+    h->kind = k ;
+    h->size = size ;
+    #pragma omp atomic
+    LG_pool_nallocs [k]++ ;
+    LG_pool_count ((int64_t) size) ;
+    return ((void *) (h + 1)) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Pool_calloc
+//------------------------------------------------------------------------------
+
+LAGRAPH_PUBLIC
+void *LAGraph_Pool_calloc       // return pointer to allocated block of memory
+(
+    size_t nitems,              // # of items to allocate
+    size_t itemsize             // # of bytes per item
+)
+{
+    size_t size = nitems * itemsize ;
+    if (itemsize != 0 && size / itemsize != nitems) return (NULL) ;
+    void *p = LAGraph_Pool_malloc (size) ;
+    if (p != NULL)
+    {
+        // blocks mapped by mmap are already zero
+        LG_pool_header *h = ((LG_pool_header *) p) - 1 ;
+        if (h->kind != LG_POOL_HUGEPAGE) memset (p, 0, size) ;
+    }
+    return (p) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Pool_free
+//------------------------------------------------------------------------------
+
+LAGRAPH_PUBLIC
+void LAGraph_Pool_free
+(
+    void *p                     // block to free
+)
+{
+    if (p == NULL) return ;
+    LG_pool_header *h = ((LG_pool_header *) p) - 1 ;
+    LG_pool_count (-((int64_t) h->size)) ;
+    int k = (int) h->kind ;
+
+    if (k < LG_POOL_LARGE)
+    {
+        // keep the block in the cache of this thread, if there is room
+        size_t b = LG_pool_class_size (k) ;
+        LG_pool_cache *c = LG_pool_get_cache ( ) ;
+        if (c != NULL && (c->count [k] + 1) * b <= LG_POOL_CACHE_BYTES
+            && LG_pool_cache_reserve ((int64_t) b))
+        {
+            *((void **) p) = c->head [k] ;
+            c->head [k] = (void *) h ;
+            c->count [k]++ ;
+            return ;
+        }
+    }
+    #if LG_POOL_MMAP
+    else if (k == LG_POOL_HUGEPAGE)
+    {
+        munmap ((void *) h, LG_pool_maplen (h->size)) ;
+        return ;
+    }
+    #endif
+    free ((void *) h) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Pool_realloc
+//------------------------------------------------------------------------------
+
+LAGRAPH_PUBLIC
+void *LAGraph_Pool_realloc      // return pointer to reallocated memory
+(
+    void *p,                    // block to realloc
+    size_t size                 // new size of the block
+)
+{
+    if (p == NULL) return (LAGraph_Pool_malloc (size)) ;
+    size = LAGRAPH_MAX (size, 1) ;
+    LG_pool_header *h = ((LG_pool_header *) p) - 1 ;
+
+    // keep the block if it is large enough, and not much too large
+    size_t capacity = LG_pool_capacity (h) ;
+    if (size <= capacity && (h->kind < LG_POOL_LARGE || 2 * size >= capacity))
+    {
+        LG_pool_count (((int64_t) size) - ((int64_t) h->size)) ;
+        h->size = size ;
+        return (p) ;
+    }
+
+    // move the block; p is left unchanged if this fails
+    void *pnew = LAGraph_Pool_malloc (size) ;
+    if (pnew == NULL) return (NULL) ;
+    memcpy (pnew, p, LAGRAPH_MIN (size, h->size)) ;
+    LAGraph_Pool_free (p) ;
+    return (pnew) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Pool_Stats: return statistics of the pool
+//------------------------------------------------------------------------------
+
+int LAGraph_Pool_Stats
+(
+    // output:
+    LAGraph_PoolStats *stats,
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    LG_ASSERT (stats != NULL, GrB_NULL_POINTER) ;
+    #pragma omp atomic read
+    stats->bytes_live = LG_pool_live ;
+    #pragma omp atomic read
+    stats->bytes_peak = LG_pool_peak ;
+    #pragma omp atomic read
+    stats->bytes_cached = LG_pool_cached ;
+    for (int k = 0 ; k < LAGRAPH_POOL_NCLASSES + 2 ; k++)
+    {
+        #pragma omp atomic read
+        stats->nallocs [k] = LG_pool_nallocs [k] ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Pool_Trim: free all blocks held in the thread caches, and the caches
+//------------------------------------------------------------------------------
+
+// LAGraph_Pool_Trim must not be called while other threads are using the
+// pool.  The pool can still be used afterwards.
+
+int LAGraph_Pool_Trim (char *msg)
+{
+    LG_CLEAR_MSG ;
+    #pragma omp critical (LG_pool_critical)
+    {
+        LG_pool_cache *c = LG_pool_caches ;
+        while (c != NULL)
+        {
+            for (int k = 0 ; k < LAGRAPH_POOL_NCLASSES ; k++)
+            {
+                void *h = c->head [k] ;
+                while (h != NULL)
+                {
+                    void *next = *((void **) (((LG_pool_header *) h) + 1)) ;
+                    free (h) ;
+                    h = next ;
+                }
+            }
+            LG_pool_cache *cnext = c->next ;
+            free (c) ;
+            c = cnext ;
+        }
+        LG_pool_caches = NULL ;
+        #pragma omp atomic
+        LG_pool_generation++ ;
+    }
+    #pragma omp atomic write
+    LG_pool_cached = 0 ;
+    return (GrB_SUCCESS) ;
+}
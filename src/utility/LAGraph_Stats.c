@@ -0,0 +1,288 @@
+//------------------------------------------------------------------------------
+// LAGraph_Stats: statistics of one run of an algorithm
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2021 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+// See additional acknowledgments in the LICENSE file,
+// or contact permission@sei.cmu.edu for the full terms.
+
+//------------------------------------------------------------------------------
+
+// An LAGraph_Stats object is attached to a workspace with
+// LAGraph_Workspace_SetStats, or made the current stats object of the calling
+// thread with LAGraph_Stats_SetCurrent.  Each algorithm that collects
+// statistics then fills it with the statistics of its run: the total time,
+// the time of each phase, the memory high-water mark (if
+// LAGraph_MemoryTracking is enabled), and one record per iteration (or BFS
+// level) with its time, frontier size, # of edges examined, push/pull
+// direction, and convergence residual.  Each run replaces the statistics of
+// the previous one.  LAGraph_Stats_JSON prints them as a JSON object.
+
+// The LG_Stats_* functions do nothing if S is NULL, so an algorithm computes
+// statistics only when asked to.  The public wrapper of the algorithm gets S
+// with LG_Stats_Get, and starts and finishes the run with LG_Stats_Begin and
+// LG_Stats_End, around the call to the algorithm, so that the memory region
+// opened by LG_Stats_Begin is closed even if the algorithm returns an error.
+// The algorithm itself records its phases and iterations.  If an algorithm
+// that collects statistics calls another one, the run of the inner algorithm
+// is part of the outer run, and its phases and iterations are added to it.
+
+#include "LG_internal.h"
+
+// the current stats object of each user thread
+static LG_THREAD_LOCAL LAGraph_Stats LG_stats_current = NULL ;
+
+//------------------------------------------------------------------------------
+// LAGraph_Stats_New: create a stats object
+//------------------------------------------------------------------------------
+
+int LAGraph_Stats_New
+(
+    // output:
+    LAGraph_Stats *S,
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    LG_ASSERT (S != NULL, GrB_NULL_POINTER) ;
+    LG_TRY (LAGraph_Calloc ((void **) S, 1,
+        sizeof (struct LAGraph_Stats_struct), msg)) ;
+    (*S)->bytes_peak = -1 ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Stats_Free: free a stats object
+//------------------------------------------------------------------------------
+
+int LAGraph_Stats_Free
+(
+    // input/output:
+    LAGraph_Stats *S,
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    if (S == NULL || (*S) == NULL)
+    {
+        // success: nothing to do
+        return (GrB_SUCCESS) ;
+    }
+    if (LG_stats_current == (*S))
+    {
+        LG_stats_current = NULL ;
+    }
+    LAGraph_Free ((void **) &((*S)->iter), NULL) ;
+    LAGraph_Free ((void **) S, NULL) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Workspace_SetStats: attach a stats object to a workspace
+//------------------------------------------------------------------------------
+
+int LAGraph_Workspace_SetStats
+(
+    // input/output:
+    LAGraph_Workspace W,
+    // input:
+    LAGraph_Stats S,        // may be NULL, to stop collecting statistics
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    LG_ASSERT (W != NULL, GrB_NULL_POINTER) ;
+    W->stats = S ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Stats_SetCurrent: set the stats object of the calling thread
+//------------------------------------------------------------------------------
+
+int LAGraph_Stats_SetCurrent
+(
+    // input:
+    LAGraph_Stats S,        // may be NULL, to stop collecting statistics
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    LG_stats_current = S ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_Stats_Get: get the stats object for a run
+//------------------------------------------------------------------------------
+
+LAGraph_Stats LG_Stats_Get (LAGraph_Workspace W)
+{
+    if (W != NULL && W->stats != NULL) return (W->stats) ;
+    return (LG_stats_current) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Stats_JSON: print the statistics as a JSON object
+//------------------------------------------------------------------------------
+
+// Unknown values are printed as null.
+
+int LAGraph_Stats_JSON
+(
+    // input:
+    FILE *f,                // file to write to, already open
+    const LAGraph_Stats S,
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    LG_ASSERT (f != NULL && S != NULL, GrB_NULL_POINTER) ;
+
+    FPRINTF (f, "{\n") ;
+    if (S->algorithm == NULL)
+    {
+        FPRINTF (f, "  \"algorithm\": null,\n") ;
+    }
+    else
+    {
+        FPRINTF (f, "  \"algorithm\": \"%s\",\n", S->algorithm) ;
+    }
+    FPRINTF (f, "  \"time\": %.9g,\n", S->time) ;
+    if (S->bytes_peak < 0)
+    {
+        FPRINTF (f, "  \"bytes_peak\": null,\n") ;
+    }
+    else
+    {
+        FPRINTF (f, "  \"bytes_peak\": %" PRId64 ",\n", S->bytes_peak) ;
+    }
+
+    // phases
+    FPRINTF (f, "  \"phases\": {") ;
+    for (int k = 0 ; k < S->nphases ; k++)
+    {
+        FPRINTF (f, "%s\n    \"%s\": %.9g", (k == 0) ? "" : ",",
+            S->phase_name [k], S->phase_time [k]) ;
+    }
+    FPRINTF (f, "%s},\n", (S->nphases == 0) ? "" : "\n  ") ;
+
+    // iterations
+    FPRINTF (f, "  \"iterations\": [") ;
+    for (int64_t k = 0 ; k < S->niters ; k++)
+    {
+        const LG_stats_iteration *it = &(S->iter [k]) ;
+        FPRINTF (f, "%s\n    {\"time\": %.9g", (k == 0) ? "" : ",",
+            it->time) ;
+        if (it->frontier < 0)
+        {
+            FPRINTF (f, ", \"frontier\": null") ;
+        }
+        else
+        {
+            FPRINTF (f, ", \"frontier\": %" PRId64, it->frontier) ;
+        }
+        if (it->edges < 0)
+        {
+            FPRINTF (f, ", \"edges\": null") ;
+        }
+        else
+        {
+            FPRINTF (f, ", \"edges\": %" PRId64, it->edges) ;
+        }
+        FPRINTF (f, ", \"direction\": %s",
+            (it->direction == LG_STATS_PUSH) ? "\"push\"" :
+            (it->direction == LG_STATS_PULL) ? "\"pull\"" : "null") ;
+        if (it->residual < 0)
+        {
+            FPRINTF (f, ", \"residual\": null}") ;
+        }
+        else
+        {
+            FPRINTF (f, ", \"residual\": %.9g}", it->residual) ;
+        }
+    }
+    FPRINTF (f, "%s]\n", (S->niters == 0) ? "" : "\n  ") ;
+    FPRINTF (f, "}\n") ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_Stats_Begin: clear S and start timing a run
+//------------------------------------------------------------------------------
+
+void LG_Stats_Begin (LAGraph_Stats S, const char *algorithm)
+{
+    if (S == NULL || (S->depth)++ > 0) return ;
+    S->algorithm = algorithm ;
+    S->time = 0 ;
+    S->bytes_peak = -1 ;
+    S->nphases = 0 ;
+    S->niters = 0 ;
+    LG_Memory_Begin (&(S->region)) ;
+    S->t_start = LAGraph_WallClockTime ( ) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_Stats_Phase: add time to a phase
+//------------------------------------------------------------------------------
+
+void LG_Stats_Phase (LAGraph_Stats S, const char *phase, double time)
+{
+    if (S == NULL) return ;
+    int k = 0 ;
+    while (k < S->nphases && strcmp (S->phase_name [k], phase) != 0) k++ ;
+    if (k == S->nphases)
+    {
+        if (k == LG_STATS_MAX_PHASES) return ;
+        S->phase_name [k] = phase ;
+        S->phase_time [k] = 0 ;
+        S->nphases++ ;
+    }
+    S->phase_time [k] += time ;
+}
+
+//------------------------------------------------------------------------------
+// LG_Stats_Iteration: record one iteration
+//------------------------------------------------------------------------------
+
+int LG_Stats_Iteration
+(
+    LAGraph_Stats S,
+    double time,            // time of the iteration, in seconds
+    int64_t frontier,       // # of nodes in the frontier, or -1
+    int64_t edges,          // # of edges examined, or -1
+    int direction,          // LG_STATS_PUSH, LG_STATS_PULL, or -1
+    double residual,        // convergence residual, or -1
+    char *msg
+)
+{
+    if (S == NULL) return (GrB_SUCCESS) ;
+    if (S->niters == S->iters_size)
+    {
+        // double the size of the iteration array
+        int64_t newsize = LAGRAPH_MAX (64, 2 * S->iters_size) ;
+        LG_TRY (LAGraph_Realloc ((void **) &(S->iter), newsize,
+            S->iters_size, sizeof (LG_stats_iteration), msg)) ;
+        S->iters_size = newsize ;
+    }
+    LG_stats_iteration *it = &(S->iter [S->niters++]) ;
+    it->time = time ;
+    it->frontier = frontier ;
+    it->edges = edges ;
+    it->direction = direction ;
+    it->residual = residual ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_Stats_End: finish a run
+//------------------------------------------------------------------------------
+
+void LG_Stats_End (LAGraph_Stats S)
+{
+    if (S == NULL || S->depth == 0 || --(S->depth) > 0) return ;
+    S->time = LAGraph_WallClockTime ( ) - S->t_start ;
+    S->bytes_peak = LG_Memory_End (&(S->region), NULL) ;
+}
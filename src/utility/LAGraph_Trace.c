@@ -0,0 +1,378 @@
+//------------------------------------------------------------------------------
+// LAGraph_Trace: a timeline of the LAGraph and GraphBLAS calls made
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2021 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+// See additional acknowledgments in the LICENSE file,
+// or contact permission@sei.cmu.edu for the full terms.
+
+//------------------------------------------------------------------------------
+
+// Tracing is enabled with LAGraph_Tracing (true, msg).  Each GraphBLAS call
+// made by LAGraph through GRB_TRY, each LAGraph call made through LG_TRY, and
+// each call to an LAGr_* algorithm is then recorded as an event: the text of
+// the call, its file and line, the calling thread, its start time and
+// duration, the status it returned, and the # of threads LAGraph and
+// GraphBLAS were set to use.  LAGraph_Trace_ChromeJSON writes the events in
+// the Chrome trace event format, for chrome://tracing or ui.perfetto.dev,
+// where nested calls appear as nested spans on the timeline of each thread.
+// LAGraph_Trace_CSV writes them as a flat table.
+
+// Each thread records its events in its own buffer, a list of chunks of
+// LG_TRACE_CHUNK events, so recording an event takes no lock.  A thread adds
+// its buffer to the global list with an atomic compare-and-swap the first
+// time it records an event.  LAGraph_Trace_ChromeJSON, LAGraph_Trace_CSV,
+// and LAGraph_Trace_Clear must not be called while other threads are making
+// traced calls.  LAGraph_Trace_Clear is called by LAGraph_Finalize.
+
+// When tracing is disabled, LG_TRY and GRB_TRY only test the global flag
+// LG_trace_enabled before and after each call.
+
+#include "LG_internal.h"
+
+#define LG_TRACE_CHUNK 4096
+
+// LG_TRACE_TRY: the same as LG_TRY, but not traced, so that exporting the
+// events does not add more of them
+#define LG_TRACE_TRY(method)                    \
+{                                               \
+    int LAGraph_status = method ;               \
+    if (LAGraph_status < 0)                     \
+    {                                           \
+        return (LAGraph_status) ;               \
+    }                                           \
+}
+
+typedef struct
+{
+    const char *call ;      // text of the call, or name of the algorithm
+    const char *file ;      // source file of the call
+    int line ;              // line of the call
+    int kind ;              // LG_TRACE_GRB, LG_TRACE_LAGRAPH, ...
+    int status ;            // status returned by the call
+    int nthreads ;          // LG_nthreads_inner at the time of the call
+    double t0 ;             // start time
+    double t1 ;             // end time
+}
+LG_trace_event ;
+
+typedef struct LG_trace_chunk_struct
+{
+    LG_trace_event event [LG_TRACE_CHUNK] ;
+    int64_t n ;                             // # of events in this chunk
+    struct LG_trace_chunk_struct *next ;    // next chunk of this thread
+}
+LG_trace_chunk ;
+
+typedef struct LG_trace_buffer_struct
+{
+    int64_t tid ;                           // thread id, for the export
+    LG_trace_chunk *first ;                 // first chunk of this thread
+    LG_trace_chunk *last ;                  // chunk being filled
+    struct LG_trace_buffer_struct *next ;   // next buffer in the global list
+}
+LG_trace_buffer ;
+
+// the buffers of all threads, and the # of buffers created
+static LG_trace_buffer *LG_trace_buffers = NULL ;
+static int64_t LG_trace_nbuffers = 0 ;
+
+// LAGraph_Trace_Clear frees all buffers and increments the generation, so
+// that each thread then creates a new one
+static int64_t LG_trace_generation = 1 ;
+static LG_THREAD_LOCAL LG_trace_buffer *LG_trace_my_buffer = NULL ;
+static LG_THREAD_LOCAL int64_t LG_trace_my_generation = 0 ;
+
+// time at which tracing was first enabled, or 0
+static double LG_trace_epoch = 0 ;
+
+//------------------------------------------------------------------------------
+// LG_trace_get_buffer: get the buffer of this thread
+//------------------------------------------------------------------------------
+
+static LG_trace_buffer *LG_trace_get_buffer (void)
+{
+    int64_t generation = (int64_t)
+        LG_ATOMIC_READ_UINT64 (&LG_trace_generation) ;
+    if (LG_trace_my_buffer != NULL && LG_trace_my_generation == generation)
+    {
+        return (LG_trace_my_buffer) ;
+    }
+    LG_trace_buffer *b = calloc (1, sizeof (LG_trace_buffer)) ;
+    if (b == NULL) return (NULL) ;
+    b->tid = LG_ATOMIC_FETCH_ADD_INT64 (&LG_trace_nbuffers, 1) ;
+    // add b to the global list
+    LG_trace_buffer *head ;
+    do
+    {
+        head = (LG_trace_buffer *)
+            (uintptr_t) LG_ATOMIC_READ_UINT64 (&LG_trace_buffers) ;
+        b->next = head ;
+    }
+    while (!LG_ATOMIC_CAS_UINT64 (&LG_trace_buffers, (uintptr_t) head,
+        (uintptr_t) b)) ;
+    LG_trace_my_buffer = b ;
+    LG_trace_my_generation = generation ;
+    return (b) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_Trace_Event: record an event that started at time t0
+//------------------------------------------------------------------------------
+
+// If out of memory, the event is silently dropped.
+
+void LG_Trace_Event
+(
+    int kind,
+    const char *call,
+    const char *file,
+    int line,
+    double t0,
+    int status
+)
+{
+    double t1 = LAGraph_WallClockTime ( ) ;
+    // t0 is zero if tracing was enabled during the call
+    if (t0 <= 0) return ;
+    LG_trace_buffer *b = LG_trace_get_buffer ( ) ;
+    if (b == NULL) return ;
+    LG_trace_chunk *c = b->last ;
+    if (c == NULL || c->n == LG_TRACE_CHUNK)
+    {
+        // start a new chunk
+        LG_trace_chunk *cnew = malloc (sizeof (LG_trace_chunk)) ;
+        if (cnew == NULL) return ;
+        cnew->n = 0 ;
+        cnew->next = NULL ;
+        if (c == NULL)
+        {
+            b->first = cnew ;
+        }
+        else
+        {
+            c->next = cnew ;
+        }
+        b->last = cnew ;
+        c = cnew ;
+    }
+    LG_trace_event *e = &(c->event [c->n++]) ;
+    e->call = call ;
+    e->file = file ;
+    e->line = line ;
+    e->kind = kind ;
+    e->status = status ;
+    e->nthreads = LG_nthreads_inner ;
+    e->t0 = t0 ;
+    e->t1 = t1 ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Tracing: enable or disable tracing
+//------------------------------------------------------------------------------
+
+int LAGraph_Tracing
+(
+    // input:
+    bool enable,
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    if (enable && LG_trace_epoch == 0)
+    {
+        LG_trace_epoch = LAGraph_WallClockTime ( ) ;
+    }
+    LG_trace_enabled = enable ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Trace_Clear: discard all events
+//------------------------------------------------------------------------------
+
+int LAGraph_Trace_Clear (char *msg)
+{
+    LG_CLEAR_MSG ;
+    LG_trace_buffer *b = LG_trace_buffers ;
+    while (b != NULL)
+    {
+        LG_trace_chunk *c = b->first ;
+        while (c != NULL)
+        {
+            LG_trace_chunk *cnext = c->next ;
+            free (c) ;
+            c = cnext ;
+        }
+        LG_trace_buffer *bnext = b->next ;
+        free (b) ;
+        b = bnext ;
+    }
+    LG_trace_buffers = NULL ;
+    LG_trace_nbuffers = 0 ;
+    LG_ATOMIC_FETCH_ADD_INT64 (&LG_trace_generation, 1) ;
+    LG_trace_epoch = (LG_trace_enabled) ? LAGraph_WallClockTime ( ) : 0 ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// helper functions for the export
+//------------------------------------------------------------------------------
+
+static const char *LG_trace_category [3] = { "GrB", "LAGraph", "algorithm" } ;
+
+// LG_trace_name_length: length of the name of the function called, which is
+// the text of the call up to the first '(' or ' '
+static int LG_trace_name_length (const char *call)
+{
+    int len = 0 ;
+    while (call [len] != '\0' && call [len] != '(' && call [len] != ' ')
+    {
+        len++ ;
+    }
+    return (len) ;
+}
+
+// LG_trace_basename: the file name without its directory
+static const char *LG_trace_basename (const char *file)
+{
+    const char *base = file ;
+    for (const char *p = file ; *p != '\0' ; p++)
+    {
+        if (*p == '/' || *p == '\\') base = p + 1 ;
+    }
+    return (base) ;
+}
+
+// LG_trace_json_string: print s as a JSON string
+static int LG_trace_json_string (FILE *f, const char *s, char *msg)
+{
+    FPRINTF (f, "\"") ;
+    for ( ; *s != '\0' ; s++)
+    {
+        if (*s == '"' || *s == '\\')
+        {
+            FPRINTF (f, "\\%c", *s) ;
+        }
+        else if ((unsigned char) (*s) < 0x20)
+        {
+            FPRINTF (f, "\\u%04x", (unsigned int) (*s)) ;
+        }
+        else
+        {
+            FPRINTF (f, "%c", *s) ;
+        }
+    }
+    FPRINTF (f, "\"") ;
+    return (GrB_SUCCESS) ;
+}
+
+// LG_trace_csv_string: print s as a quoted CSV field
+static int LG_trace_csv_string (FILE *f, const char *s, char *msg)
+{
+    FPRINTF (f, "\"") ;
+    for ( ; *s != '\0' ; s++)
+    {
+        if (*s == '"')
+        {
+            FPRINTF (f, "\"\"") ;
+        }
+        else
+        {
+            FPRINTF (f, "%c", *s) ;
+        }
+    }
+    FPRINTF (f, "\"") ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Trace_ChromeJSON: write the events in the Chrome trace format
+//------------------------------------------------------------------------------
+
+// Each event is a complete ("X") event, with its start time and duration in
+// microseconds since tracing was enabled.
+
+int LAGraph_Trace_ChromeJSON
+(
+    // input:
+    FILE *f,                // file to write to, already open
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    LG_ASSERT (f != NULL, GrB_NULL_POINTER) ;
+
+    FPRINTF (f, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [") ;
+    bool first = true ;
+    for (LG_trace_buffer *b = LG_trace_buffers ; b != NULL ; b = b->next)
+    {
+        for (LG_trace_chunk *c = b->first ; c != NULL ; c = c->next)
+        {
+            for (int64_t k = 0 ; k < c->n ; k++)
+            {
+                const LG_trace_event *e = &(c->event [k]) ;
+                FPRINTF (f, "%s\n{\"name\": \"%.*s\", \"cat\": \"%s\", "
+                    "\"ph\": \"X\", \"pid\": 0, \"tid\": %" PRId64 ", "
+                    "\"ts\": %.3f, \"dur\": %.3f, \"args\": {\"call\": ",
+                    first ? "" : ",",
+                    LG_trace_name_length (e->call), e->call,
+                    LG_trace_category [e->kind], b->tid,
+                    1e6 * (e->t0 - LG_trace_epoch),
+                    1e6 * (e->t1 - e->t0)) ;
+                LG_TRACE_TRY (LG_trace_json_string (f, e->call, msg)) ;
+                FPRINTF (f, ", \"file\": ") ;
+                LG_TRACE_TRY (LG_trace_json_string (f,
+                    LG_trace_basename (e->file), msg)) ;
+                FPRINTF (f, ", \"line\": %d, \"status\": %d, "
+                    "\"nthreads\": %d}}", e->line, e->status, e->nthreads) ;
+                first = false ;
+            }
+        }
+    }
+    FPRINTF (f, "\n]}\n") ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Trace_CSV: write the events as a CSV table
+//------------------------------------------------------------------------------
+
+// The first line is a header.  Times are in microseconds since tracing was
+// enabled.
+
+int LAGraph_Trace_CSV
+(
+    // input:
+    FILE *f,                // file to write to, already open
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    LG_ASSERT (f != NULL, GrB_NULL_POINTER) ;
+
+    FPRINTF (f, "tid,category,name,start_us,duration_us,status,nthreads,"
+        "file,line,call\n") ;
+    for (LG_trace_buffer *b = LG_trace_buffers ; b != NULL ; b = b->next)
+    {
+        for (LG_trace_chunk *c = b->first ; c != NULL ; c = c->next)
+        {
+            for (int64_t k = 0 ; k < c->n ; k++)
+            {
+                const LG_trace_event *e = &(c->event [k]) ;
+                FPRINTF (f, "%" PRId64 ",%s,%.*s,%.3f,%.3f,%d,%d,",
+                    b->tid, LG_trace_category [e->kind],
+                    LG_trace_name_length (e->call), e->call,
+                    1e6 * (e->t0 - LG_trace_epoch),
+                    1e6 * (e->t1 - e->t0), e->status, e->nthreads) ;
+                LG_TRACE_TRY (LG_trace_csv_string (f,
+                    LG_trace_basename (e->file), msg)) ;
+                FPRINTF (f, ",%d,", e->line) ;
+                LG_TRACE_TRY (LG_trace_csv_string (f, e->call, msg)) ;
+                FPRINTF (f, "\n") ;
+            }
+        }
+    }
+    return (GrB_SUCCESS) ;
+}
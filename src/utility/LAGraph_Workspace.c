@@ -0,0 +1,348 @@
+//------------------------------------------------------------------------------
+// LAGraph_Workspace: reusable workspace for LAGraph algorithms
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2021 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+// See additional acknowledgments in the LICENSE file,
+// or contact permission@sei.cmu.edu for the full terms.
+
+//------------------------------------------------------------------------------
+
+// A workspace holds a pool of GrB_Vector objects of length n, so that an
+// algorithm called many times on graphs with n nodes does not allocate and
+// free its work vectors on each call.  An algorithm gets a vector from the
+// pool with LG_Workspace_Vector or LG_Workspace_Dense, and returns it with
+// LG_Workspace_Release.  A vector that becomes a result owned by the caller is
+// removed from the pool with LG_Workspace_Detach.  Vectors held by the pool
+// are only freed by LAGraph_Workspace_Free.
+
+// LG_Workspace_Vector returns an empty vector, emptied with GrB_Vector_clear.
+// In SuiteSparse:GraphBLAS this frees the entries of the vector, so for these
+// vectors the workspace saves only the creation of the vector objects.  The
+// sparsity control of a reused vector is reset to GxB_AUTO_SPARSITY, since
+// the algorithm that last used it may have changed it.
+
+// LG_Workspace_Dense returns a full vector with all entries equal to a given
+// value.  In SuiteSparse:GraphBLAS, the values of a reused full vector are
+// unpacked, overwritten in place, and packed back, so a warm workspace
+// allocates no memory for the entries of its dense vectors.  test_Workspace
+// measures this with LAGraph_MemoryStats.
+
+// If the workspace is NULL, the vectors are created on each call and
+// LG_Workspace_Release frees them, so an algorithm can be written the same way
+// whether or not a workspace is given.  A workspace may not be used by two
+// algorithms at the same time.
+
+#include "LG_internal.h"
+
+//------------------------------------------------------------------------------
+// LAGraph_Workspace_New: create a workspace for graphs with n nodes
+//------------------------------------------------------------------------------
+
+int LAGraph_Workspace_New
+(
+    // output:
+    LAGraph_Workspace *W,   // the new workspace
+    // input:
+    GrB_Index n,            // # of nodes of the graphs it is used with
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    LG_ASSERT (W != NULL, GrB_NULL_POINTER) ;
+    LG_TRY (LAGraph_Calloc ((void **) W, 1,
+        sizeof (struct LAGraph_Workspace_struct), msg)) ;
+    (*W)->n = n ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LAGraph_Workspace_Free: free a workspace and all its vectors
+//------------------------------------------------------------------------------
+
+int LAGraph_Workspace_Free
+(
+    // input/output:
+    LAGraph_Workspace *W,   // the workspace to free; NULL on output
+    char *msg
+)
+{
+    LG_CLEAR_MSG ;
+    if (W == NULL || (*W) == NULL)
+    {
+        // success: nothing to do
+        return (GrB_SUCCESS) ;
+    }
+    for (int k = 0 ; k < (*W)->nvectors ; k++)
+    {
+        GRB_TRY (GrB_free (&((*W)->V [k]))) ;
+    }
+    LAGraph_Free ((void **) W, NULL) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_Workspace_get: get an unused vector of the given type, or a new one
+//------------------------------------------------------------------------------
+
+// On output, (*reused) is true if the vector was already in the pool, and
+// holds whatever content it had when it was released.
+
+static int LG_Workspace_get
+(
+    // output:
+    GrB_Vector *v,
+    bool *reused,
+    // input:
+    LAGraph_Workspace W,
+    GrB_Type type,
+    GrB_Index n,
+    char *msg
+)
+{
+    LG_ASSERT (v != NULL, GrB_NULL_POINTER) ;
+    (*v) = NULL ;
+    (*reused) = false ;
+    if (W == NULL)
+    {
+        GRB_TRY (GrB_Vector_new (v, type, n)) ;
+        return (GrB_SUCCESS) ;
+    }
+    LG_ASSERT_MSG (W->n == n, GrB_DIMENSION_MISMATCH,
+        "workspace size does not match the graph") ;
+
+    // find an unused vector of the same type
+    for (int k = 0 ; k < W->nvectors ; k++)
+    {
+        if (!W->in_use [k] && W->type [k] == type)
+        {
+            W->in_use [k] = true ;
+            (*v) = W->V [k] ;
+            (*reused) = true ;
+            return (GrB_SUCCESS) ;
+        }
+    }
+
+    // create a new vector, and add it to the pool if there is room
+    GRB_TRY (GrB_Vector_new (v, type, n)) ;
+    if (W->nvectors < LG_WORKSPACE_MAX)
+    {
+        int k = W->nvectors++ ;
+        W->V [k] = (*v) ;
+        W->type [k] = type ;
+        W->in_use [k] = true ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_Workspace_Vector: get an empty vector from the workspace
+//------------------------------------------------------------------------------
+
+int LG_Workspace_Vector
+(
+    // output:
+    GrB_Vector *v,          // an empty vector of the given type and size n
+    // input:
+    LAGraph_Workspace W,    // workspace; may be NULL
+    GrB_Type type,
+    GrB_Index n,
+    char *msg
+)
+{
+    bool reused ;
+    LG_TRY (LG_Workspace_get (v, &reused, W, type, n, msg)) ;
+    if (reused)
+    {
+        GRB_TRY (GrB_Vector_clear (*v)) ;
+        #if LAGRAPH_SUITESPARSE
+        GRB_TRY (GxB_set (*v, GxB_SPARSITY_CONTROL, GxB_AUTO_SPARSITY)) ;
+        #endif
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_Workspace_Dense: get a full vector from the workspace
+//------------------------------------------------------------------------------
+
+int LG_Workspace_Dense
+(
+    // output:
+    GrB_Vector *v,          // a full vector of the given type and size n
+    // input:
+    LAGraph_Workspace W,    // workspace; may be NULL
+    GrB_Type type,
+    GrB_Index n,
+    double value,           // value of all entries of v
+    char *msg
+)
+{
+    bool reused ;
+    LG_TRY (LG_Workspace_get (v, &reused, W, type, n, msg)) ;
+    #if LAGRAPH_SUITESPARSE
+    if (reused)
+    {
+        GRB_TRY (GxB_set (*v, GxB_SPARSITY_CONTROL, GxB_AUTO_SPARSITY)) ;
+    }
+    #endif
+    LG_TRY (LG_Vector_Fill (*v, type, n, value, msg)) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_Vector_Fill: set all entries of a vector to a value
+//------------------------------------------------------------------------------
+
+// v(:) = value, where v has the given type and size n.  With SuiteSparse, if
+// v is already full and not iso-valued, its values are overwritten in place,
+// and otherwise v is given a new non-iso array of values, so that a later
+// fill of the same vector does not allocate memory.  Other GraphBLAS
+// libraries, and types other than those listed below, use GrB_assign.
+
+#undef  LG_FREE_ALL
+#define LG_FREE_ALL LAGraph_Free ((void **) &x, NULL) ;
+
+int LG_Vector_Fill
+(
+    // input/output:
+    GrB_Vector v,
+    // input:
+    GrB_Type type,
+    GrB_Index n,
+    double value,
+    char *msg
+)
+{
+    void *x = NULL ;
+
+    #if LAGRAPH_SUITESPARSE
+    size_t tsize = 0 ;
+    if      (type == GrB_BOOL ) tsize = sizeof (bool) ;
+    else if (type == GrB_INT32) tsize = sizeof (int32_t) ;
+    else if (type == GrB_INT64) tsize = sizeof (int64_t) ;
+    else if (type == GrB_FP32 ) tsize = sizeof (float) ;
+    else if (type == GrB_FP64 ) tsize = sizeof (double) ;
+    if (tsize > 0 && n > 0)
+    {
+        // get the values of v, if it is already full and not iso
+        GrB_Index nvals, x_size = 0 ;
+        bool iso = false ;
+        GRB_TRY (GrB_Vector_nvals (&nvals, v)) ;
+        if (nvals == n)
+        {
+            // this takes O(1) time and space
+            GRB_TRY (GxB_Vector_unpack_Full (v, &x, &x_size, &iso, NULL)) ;
+        }
+        if (x == NULL || iso || x_size < n * tsize)
+        {
+            LAGraph_Free ((void **) &x, NULL) ;
+            LG_TRY (LAGraph_Malloc (&x, n, tsize, msg)) ;
+            x_size = n * tsize ;
+        }
+
+        // x (:) = value
+        int nthreads = LG_nthreads_outer * LG_nthreads_inner ;
+        nthreads = (int) LAGRAPH_MIN (nthreads, 1 + n / 65536) ;
+        int64_t i, nx = (int64_t) n ;
+        if (type == GrB_BOOL)
+        {
+            bool *X = x, a = (bool) value ;
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (i = 0 ; i < nx ; i++) X [i] = a ;
+        }
+        else if (type == GrB_INT32)
+        {
+            int32_t *X = x, a = (int32_t) value ;
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (i = 0 ; i < nx ; i++) X [i] = a ;
+        }
+        else if (type == GrB_INT64)
+        {
+            int64_t *X = x, a = (int64_t) value ;
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (i = 0 ; i < nx ; i++) X [i] = a ;
+        }
+        else if (type == GrB_FP32)
+        {
+            float *X = x, a = (float) value ;
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (i = 0 ; i < nx ; i++) X [i] = a ;
+        }
+        else
+        {
+            double *X = x, a = value ;
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (i = 0 ; i < nx ; i++) X [i] = a ;
+        }
+
+        // this takes O(1) time and space, and x is owned by v again
+        GRB_TRY (GxB_Vector_pack_Full (v, &x, x_size, false, NULL)) ;
+        return (GrB_SUCCESS) ;
+    }
+    #endif
+
+    GRB_TRY (GrB_Vector_assign_FP64 (v, NULL, NULL, value, GrB_ALL, n, NULL)) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_Workspace_Release: return a vector to the workspace
+//------------------------------------------------------------------------------
+
+// If v came from the workspace, it is marked as unused and kept; otherwise it
+// is freed.  Either way, v is NULL on output.  v may already be NULL.
+
+void LG_Workspace_Release
+(
+    // input/output:
+    LAGraph_Workspace W,    // workspace; may be NULL
+    GrB_Vector *v
+)
+{
+    if (v == NULL || (*v) == NULL) return ;
+    if (W != NULL)
+    {
+        for (int k = 0 ; k < W->nvectors ; k++)
+        {
+            if (W->V [k] == (*v))
+            {
+                W->in_use [k] = false ;
+                (*v) = NULL ;
+                return ;
+            }
+        }
+    }
+    GrB_free (v) ;
+}
+
+//------------------------------------------------------------------------------
+// LG_Workspace_Detach: remove a vector from the workspace
+//------------------------------------------------------------------------------
+
+// If v came from the workspace, it is removed from the pool, so that it can be
+// returned to the caller of an algorithm as a result.  The pool creates a new
+// vector in its place when one is next needed.
+
+void LG_Workspace_Detach
+(
+    // input:
+    LAGraph_Workspace W,    // workspace; may be NULL
+    GrB_Vector v
+)
+{
+    if (W == NULL || v == NULL) return ;
+    for (int k = 0 ; k < W->nvectors ; k++)
+    {
+        if (W->V [k] == v)
+        {
+            int last = --(W->nvectors) ;
+            W->V      [k] = W->V      [last] ;
+            W->type   [k] = W->type   [last] ;
+            W->in_use [k] = W->in_use [last] ;
+            W->V [last] = NULL ;
+            return ;
+        }
+    }
+}
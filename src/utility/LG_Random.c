@@ -11,24 +11,21 @@
 
 //------------------------------------------------------------------------------
 
+// The seed is the state of a SplitMix64 generator: it is advanced by a
+// constant, and the result is the mix of the new state (see LG_internal.h).
+
 #include "LG_internal.h"
 
 // return a random number between 0 and LG_RANDOM15_MAX
 GrB_Index LG_Random15 (uint64_t *seed)
 {
-   (*seed) = (*seed) * 1103515245 + 12345 ;
-   return (((*seed) / 65536) % (LG_RANDOM15_MAX + 1)) ;
+    (*seed) += LG_RANDOM_GAMMA ;
+    return (LG_rand_mix (*seed) >> 49) ;
 }
 
 // return a random uint64_t, in range 0 to LG_RANDOM60_MAX
 GrB_Index LG_Random60 (uint64_t *seed)
 {
-    GrB_Index i ;
-    i = LG_Random15 (seed) ;
-    i = LG_Random15 (seed) + LG_RANDOM15_MAX * i ;
-    i = LG_Random15 (seed) + LG_RANDOM15_MAX * i ;
-    i = LG_Random15 (seed) + LG_RANDOM15_MAX * i ;
-    i = i % (LG_RANDOM60_MAX + 1) ;
-    return (i) ;
+    (*seed) += LG_RANDOM_GAMMA ;
+    return (LG_rand_mix (*seed) >> 4) ;
 }
-
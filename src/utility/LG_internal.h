@@ -189,6 +189,55 @@ typedef unsigned char LG_void ;
     }                                                                       \
 }
 
+//------------------------------------------------------------------------------
+// tracing: see LAGraph_Trace.c
+//------------------------------------------------------------------------------
+
+// When tracing is enabled with LAGraph_Tracing, each call made through LG_TRY
+// or GRB_TRY, and each call to an LAGr_* algorithm, is recorded as an event
+// with its start and end time.  When tracing is disabled, the only cost is a
+// test of LG_trace_enabled before and after each call.
+
+LAGRAPH_PUBLIC
+bool LG_trace_enabled ;     // true if tracing is enabled.  Default: false.
+
+// kinds of events
+#define LG_TRACE_GRB       0    // a GraphBLAS call made by GRB_TRY
+#define LG_TRACE_LAGRAPH   1    // an LAGraph call made by LG_TRY
+#define LG_TRACE_ALGORITHM 2    // an LAGr_* algorithm
+
+// record an event that started at time t0 and ends now
+void LG_Trace_Event
+(
+    int kind,               // LG_TRACE_GRB, LG_TRACE_LAGRAPH, ...
+    const char *call,       // text of the call, or name of the algorithm;
+                            // must be a constant
+    const char *file,       // __FILE__ of the call
+    int line,               // __LINE__ of the call
+    double t0,              // start time, from LAGraph_WallClockTime
+    int status              // status returned by the call
+) ;
+
+// LG_TRACE_BEGIN declares t0 and sets it to the current time, if tracing
+#define LG_TRACE_BEGIN(t0)                                                  \
+    double t0 = (LG_trace_enabled) ? LAGraph_WallClockTime ( ) : 0
+
+// LG_TRACE_END records an event that started at t0, if tracing
+#define LG_TRACE_END(t0,kind,call,status)                                   \
+{                                                                           \
+    if (LG_trace_enabled)                                                   \
+    {                                                                       \
+        LG_Trace_Event (kind, call, __FILE__, __LINE__, t0, status) ;       \
+    }                                                                       \
+}
+
+// thread-local storage
+#if defined ( _MSC_VER )
+#define LG_THREAD_LOCAL __declspec(thread)
+#else
+#define LG_THREAD_LOCAL _Thread_local
+#endif
+
 //------------------------------------------------------------------------------
 // LG_TRY: check a condition and return on error
 //------------------------------------------------------------------------------
@@ -196,14 +245,36 @@ typedef unsigned char LG_void ;
 // The msg is not modified.  This should be used when an LAGraph method calls
 // another one.
 
-#define LG_TRY(LAGraph_method)                  \
-{                                               \
-    int LAGraph_status = LAGraph_method ;       \
-    if (LAGraph_status < 0)                     \
-    {                                           \
-        LG_FREE_ALL ;                           \
-        return (LAGraph_status) ;               \
-    }                                           \
+#define LG_TRY(LAGraph_method)                                              \
+{                                                                           \
+    LG_TRACE_BEGIN (LG_trace_t0) ;                                          \
+    int LAGraph_status = LAGraph_method ;                                   \
+    LG_TRACE_END (LG_trace_t0, LG_TRACE_LAGRAPH, #LAGraph_method,           \
+        LAGraph_status) ;                                                   \
+    if (LAGraph_status < 0)                                                 \
+    {                                                                       \
+        LG_FREE_ALL ;                                                       \
+        return (LAGraph_status) ;                                           \
+    }                                                                       \
+}
+
+//------------------------------------------------------------------------------
+// GRB_TRY: try a GraphBLAS method and check for errors
+//------------------------------------------------------------------------------
+
+// Within LAGraph, GRB_TRY is the same as the GRB_TRY in LAGraph.h, except
+// that the call is traced.
+
+#undef  GRB_TRY
+#define GRB_TRY(GrB_method)                                                 \
+{                                                                           \
+    LG_TRACE_BEGIN (LG_trace_t0) ;                                          \
+    GrB_Info LG_GrB_Info = GrB_method ;                                     \
+    LG_TRACE_END (LG_trace_t0, LG_TRACE_GRB, #GrB_method, LG_GrB_Info) ;    \
+    if (LG_GrB_Info < GrB_SUCCESS)                                          \
+    {                                                                       \
+        GRB_CATCH (LG_GrB_Info) ;                                           \
+    }                                                                       \
 }
 
 //------------------------------------------------------------------------------
@@ -388,6 +459,49 @@ static inline void LG_eslice
     Slice [ntasks] = e ;
 }
 
+//------------------------------------------------------------------------------
+// atomic operations
+//------------------------------------------------------------------------------
+
+// LG_ATOMIC_READ_UINT64 (target): returns the value of (*target), where
+// target is a pointer to a uint64_t that may be modified by other threads.
+
+// LG_ATOMIC_CAS_UINT64 (target, expected, desired): if (*target) is equal to
+// expected, it is atomically replaced with desired and true is returned.
+// Otherwise, (*target) is unchanged and false is returned.
+
+// LG_ATOMIC_FETCH_ADD_INT64 (target, delta): atomically adds delta to
+// (*target), a pointer to an int64_t, and returns its prior value.
+
+#if defined ( _MSC_VER ) && !defined ( __INTEL_COMPILER )
+
+    // Microsoft Visual Studio
+    #include <intrin.h>
+    #define LG_ATOMIC_READ_UINT64(target)                                   \
+        (*((volatile uint64_t *) (target)))
+    #define LG_ATOMIC_CAS_UINT64(target,expected,desired)                   \
+        (_InterlockedCompareExchange64 ((volatile __int64 *) (target),      \
+            (__int64) (desired), (__int64) (expected))                      \
+            == (__int64) (expected))
+    #define LG_ATOMIC_FETCH_ADD_INT64(target,delta)                         \
+        ((int64_t) _InterlockedExchangeAdd64 ((volatile __int64 *) (target),\
+            (__int64) (delta)))
+
+#else
+
+    // gcc, clang, icx, and other compilers that support the __atomic and
+    // __sync builtins
+    #define LG_ATOMIC_READ_UINT64(target)                                   \
+        __atomic_load_n ((uint64_t *) (target), __ATOMIC_RELAXED)
+    #define LG_ATOMIC_CAS_UINT64(target,expected,desired)                   \
+        __sync_bool_compare_and_swap ((uint64_t *) (target),                \
+            (uint64_t) (expected), (uint64_t) (desired))
+    #define LG_ATOMIC_FETCH_ADD_INT64(target,delta)                         \
+        __atomic_fetch_add ((int64_t *) (target), (int64_t) (delta),       \
+            __ATOMIC_RELAXED)
+
+#endif
+
 //------------------------------------------------------------------------------
 // definitions for sorting functions
 //------------------------------------------------------------------------------
@@ -400,6 +514,9 @@ static inline void LG_eslice
 
 #define LG_BASECASE (64 * 1024)
 
+// # of bits in each digit of the LG_rsort radix sort
+#define LG_RADIX_BITS 8
+
 //------------------------------------------------------------------------------
 // LG_msort1: sort array of size n
 //------------------------------------------------------------------------------
@@ -455,6 +572,31 @@ int LG_msort3
     char *msg
 ) ;
 
+//------------------------------------------------------------------------------
+// LG_rsort: radix sort of 1, 2, or 3 arrays of size n
+//------------------------------------------------------------------------------
+
+// LG_rsort sorts one, two, or three int64_t arrays of size n in ascending
+// order, with the same result as LG_msort1, LG_msort2, or LG_msort3 (A_1
+// and/or A_2 are NULL for fewer keys).  It is a parallel LSD radix sort whose
+// number of passes depends on the range of each key.  If force is false, A is
+// sorted only if the radix sort is expected to be faster than LG_msort*, and
+// sorted is returned as false otherwise.  LG_msort* call LG_rsort this way.
+
+int LG_rsort
+(
+    // input/output:
+    int64_t *A_0,       // size n array
+    int64_t *A_1,       // size n array, or NULL if only one key
+    int64_t *A_2,       // size n array, or NULL if only one or two keys
+    // input:
+    const int64_t n,
+    bool force,         // if true, always sort A
+    // output:
+    bool *sorted,       // true if A has been sorted
+    char *msg
+) ;
+
 void LG_qsort_1a    // sort array A of size 1-by-n
 (
     int64_t *LG_RESTRICT A_0,       // size n array
@@ -584,6 +726,53 @@ int LG_nself_edges
 // simple and portable random number generator (internal use only)
 //------------------------------------------------------------------------------
 
+// The generators are based on SplitMix64 (Steele, Lea, and Flood, "Fast
+// splittable pseudorandom number generators", OOPSLA 2014).  LG_rand_mix is
+// its output function, a bijection on uint64_t that has no state, so
+// LG_Random64 computes the random value for any (seed, index, counter) triple
+// directly, in any order and in parallel, with no per-entry state.  Since
+// LG_rand_mix is a bijection, LG_rand_unmix recovers its input, and
+// LG_Random64 (seed, index, counter+1) can be computed from
+// LG_Random64 (seed, index, counter) alone with LG_Random64_Next.
+
+#define LG_RANDOM_GAMMA 0x9E3779B97F4A7C15ULL
+
+static inline uint64_t LG_rand_mix (uint64_t z)
+{
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL ;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL ;
+    return (z ^ (z >> 31)) ;
+}
+
+// the inverse of LG_rand_mix: LG_rand_unmix (LG_rand_mix (z)) == z
+static inline uint64_t LG_rand_unmix (uint64_t z)
+{
+    z = (z ^ (z >> 31) ^ (z >> 62)) * 0x319642B2D24D8EC3ULL ;
+    z = (z ^ (z >> 27) ^ (z >> 54)) * 0x96DE1B173F119089ULL ;
+    return (z ^ (z >> 30) ^ (z >> 60)) ;
+}
+
+// return the random value for entry index of round counter; this is the value
+// of Seed (index) after LAGraph_Random_Seed (Seed, seed) and counter calls to
+// LAGraph_Random_Next (Seed)
+static inline uint64_t LG_Random64
+(
+    uint64_t seed,
+    uint64_t index,
+    uint64_t counter
+)
+{
+    uint64_t key = LG_rand_mix (seed + (index + 1) * LG_RANDOM_GAMMA) ;
+    return (LG_rand_mix (key + counter * LG_RANDOM_GAMMA)) ;
+}
+
+// given x = LG_Random64 (seed, index, counter), return
+// LG_Random64 (seed, index, counter+1)
+static inline uint64_t LG_Random64_Next (uint64_t x)
+{
+    return (LG_rand_mix (LG_rand_unmix (x) + LG_RANDOM_GAMMA)) ;
+}
+
 #define LG_RANDOM15_MAX 32767
 #define LG_RANDOM60_MAX ((1ULL << 60) -1)
 
@@ -593,6 +782,208 @@ GrB_Index LG_Random15 (uint64_t *seed) ;
 // return a random uint64_t, in range 0 to LG_RANDOM60_MAX
 GrB_Index LG_Random60 (uint64_t *seed) ;
 
+//------------------------------------------------------------------------------
+// LAGraph_Workspace: a pool of work vectors, reused across algorithm calls
+//------------------------------------------------------------------------------
+
+#define LG_WORKSPACE_MAX 16
+
+struct LAGraph_Workspace_struct
+{
+    GrB_Index n ;                           // size of all vectors in the pool
+    int nvectors ;                          // # of vectors in the pool
+    GrB_Vector V [LG_WORKSPACE_MAX] ;       // the vectors
+    GrB_Type type [LG_WORKSPACE_MAX] ;      // type of each vector
+    bool in_use [LG_WORKSPACE_MAX] ;        // true if held by an algorithm
+    LAGraph_Stats stats ;                   // statistics to fill, or NULL
+} ;
+
+// get an empty vector of the given type and size; a new vector if W is NULL
+int LG_Workspace_Vector
+(
+    // output:
+    GrB_Vector *v,
+    // input:
+    LAGraph_Workspace W,
+    GrB_Type type,
+    GrB_Index n,
+    char *msg
+) ;
+
+// return v to the workspace, or free it if it is not from the workspace
+void LG_Workspace_Release
+(
+    // input/output:
+    LAGraph_Workspace W,
+    GrB_Vector *v
+) ;
+
+// get a full vector with all entries equal to value; its storage is reused
+int LG_Workspace_Dense
+(
+    // output:
+    GrB_Vector *v,
+    // input:
+    LAGraph_Workspace W,
+    GrB_Type type,
+    GrB_Index n,
+    double value,
+    char *msg
+) ;
+
+// remove v from the workspace, so that it can be returned as a result
+void LG_Workspace_Detach
+(
+    // input:
+    LAGraph_Workspace W,
+    GrB_Vector v
+) ;
+
+// v(:) = value, overwriting the values of v in place if it is already full
+int LG_Vector_Fill
+(
+    // input/output:
+    GrB_Vector v,
+    // input:
+    GrB_Type type,
+    GrB_Index n,
+    double value,
+    char *msg
+) ;
+
+//------------------------------------------------------------------------------
+// memory accounting: see LAGraph_MemoryStats.c
+//------------------------------------------------------------------------------
+
+// replace the user's memory functions with counting ones, if tracking
+void LG_Memory_Track
+(
+    // input/output:
+    void * (* (*user_malloc_function ) ) (size_t),
+    void * (* (*user_calloc_function ) ) (size_t, size_t),
+    void * (* (*user_realloc_function) ) (void *, size_t),
+    void   (* (*user_free_function   ) ) (void *)
+) ;
+
+typedef struct
+{
+    int64_t base ;          // bytes allocated when the method started
+    int64_t outer_peak ;    // high-water mark of the calling method, if any
+}
+LG_memory_region ;
+
+// LG_Memory_Begin and LG_Memory_End bracket a call to an LAGr_* algorithm,
+// to record its memory high-water mark under the given name:
+//
+//      LG_memory_region region ;
+//      LG_Memory_Begin (&region) ;
+//      int status = method (...) ;
+//      LG_Memory_End (&region, "LAGr_Method") ;
+//      return (status) ;
+//
+// LG_Memory_End returns the high-water mark of the region, or -1 if memory
+// tracking is disabled.  If name is NULL, it is not recorded.
+
+void LG_Memory_Begin
+(
+    // output:
+    LG_memory_region *region
+) ;
+
+int64_t LG_Memory_End
+(
+    // input:
+    const LG_memory_region *region,
+    const char *name
+) ;
+
+//------------------------------------------------------------------------------
+// LAGraph_Stats: statistics of one run of an algorithm
+//------------------------------------------------------------------------------
+
+#define LG_STATS_MAX_PHASES 8
+#define LG_STATS_PUSH 0
+#define LG_STATS_PULL 1
+
+// Any field of an iteration may be negative, which means it is not known
+typedef struct
+{
+    double time ;           // time taken by the iteration, in seconds
+    int64_t frontier ;      // # of nodes in the frontier
+    int64_t edges ;         // # of edges examined
+    int direction ;         // LG_STATS_PUSH or LG_STATS_PULL
+    double residual ;       // convergence residual
+}
+LG_stats_iteration ;
+
+struct LAGraph_Stats_struct
+{
+    const char *algorithm ;             // name of the algorithm
+    double time ;                       // total time, in seconds
+    int64_t bytes_peak ;                // memory high-water mark, or -1
+    int nphases ;                       // # of phases
+    const char *phase_name [LG_STATS_MAX_PHASES] ;
+    double phase_time [LG_STATS_MAX_PHASES] ;
+    int64_t niters ;                    // # of iterations
+    int64_t iters_size ;                // size of the iter array
+    LG_stats_iteration *iter ;          // array of size iters_size
+    double t_start ;                    // time when the run started
+    LG_memory_region region ;           // to find bytes_peak
+    int depth ;                         // # of runs in progress
+} ;
+
+// The LG_Stats_* functions do nothing if S is NULL.  The names given must be
+// string constants.
+
+// get the stats object to fill: the one attached to W, if any, or else the
+// one set for the calling thread by LAGraph_Stats_SetCurrent (or NULL)
+LAGraph_Stats LG_Stats_Get (LAGraph_Workspace W) ;
+
+// clear S and start timing a run of an algorithm.  LG_Stats_Begin and
+// LG_Stats_End are called by the public wrapper, around the call to the
+// algorithm, so that both are called even if the algorithm fails.  A run
+// started while another is in progress on S is part of the outer run.
+void LG_Stats_Begin (LAGraph_Stats S, const char *algorithm) ;
+
+// add time to a phase of the algorithm
+void LG_Stats_Phase (LAGraph_Stats S, const char *phase, double time) ;
+
+// record one iteration
+int LG_Stats_Iteration
+(
+    LAGraph_Stats S,
+    double time,
+    int64_t frontier,
+    int64_t edges,
+    int direction,
+    double residual,
+    char *msg
+) ;
+
+// finish the run
+void LG_Stats_End (LAGraph_Stats S) ;
+
+//------------------------------------------------------------------------------
+// LG_Graph_Budget: keep a graph within its memory budget
+//------------------------------------------------------------------------------
+
+// If G->memory_budget is exceeded, cached properties are freed in the order
+// G->AT, G->in_degree, G->out_degree, except for those given by keep, until
+// G fits within the budget or nothing else can be freed.
+
+#define LG_KEEP_AT          1
+#define LG_KEEP_OUT_DEGREE  2
+#define LG_KEEP_IN_DEGREE   4
+
+int LG_Graph_Budget
+(
+    // input/output:
+    LAGraph_Graph G,
+    // input:
+    int keep,               // cached properties not to free (LG_KEEP_*)
+    char *msg
+) ;
+
 //------------------------------------------------------------------------------
 // LG_KindName: return the name of a kind
 //------------------------------------------------------------------------------
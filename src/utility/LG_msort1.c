@@ -330,6 +330,14 @@ int LG_msort1
     int64_t *LG_RESTRICT W = NULL ;
     LG_ASSERT (A_0 != NULL, GrB_NULL_POINTER) ;
 
+    //--------------------------------------------------------------------------
+    // use a radix sort if the keys have a small range
+    //--------------------------------------------------------------------------
+
+    bool sorted = false ;
+    LG_TRY (LG_rsort (A_0, NULL, NULL, n, false, &sorted, msg)) ;
+    if (sorted) return (GrB_SUCCESS) ;
+
     //--------------------------------------------------------------------------
     // handle small problems with a single thread
     //--------------------------------------------------------------------------
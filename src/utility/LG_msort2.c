@@ -346,6 +346,14 @@ int LG_msort2
     LG_ASSERT (A_0 != NULL, GrB_NULL_POINTER) ;
     LG_ASSERT (A_1 != NULL, GrB_NULL_POINTER) ;
 
+    //--------------------------------------------------------------------------
+    // use a radix sort if the keys have a small range
+    //--------------------------------------------------------------------------
+
+    bool sorted = false ;
+    LG_TRY (LG_rsort (A_0, A_1, NULL, n, false, &sorted, msg)) ;
+    if (sorted) return (GrB_SUCCESS) ;
+
     //--------------------------------------------------------------------------
     // handle small problems with a single thread
     //--------------------------------------------------------------------------
@@ -0,0 +1,251 @@
+//------------------------------------------------------------------------------
+// LG_rsort: parallel LSD radix sort of a 1-, 2-, or 3-by-n list of integers
+//------------------------------------------------------------------------------
+
+// LAGraph, (c) 2021 by The LAGraph Contributors, All Rights Reserved.
+// SPDX-License-Identifier: BSD-2-Clause
+// See additional acknowledgments in the LICENSE file,
+// or contact permission@sei.cmu.edu for the full terms.
+
+//------------------------------------------------------------------------------
+
+// LG_rsort sorts the tuples (A_0 [k], A_1 [k], A_2 [k]) for k = 0:n-1 in
+// ascending order, with the same result as LG_msort1, LG_msort2, or LG_msort3.
+// A_2 is NULL for 2 keys, and A_1 and A_2 are NULL for a single key.
+
+// The sort is a least-significant-digit radix sort.  The range of each key
+// [kmin, kmax] is found first, and only the digits of (A_i [k] - kmin) that
+// can be nonzero are sorted, so the number of passes depends on the range of
+// the keys, not on their type.  Degrees and node ids of a graph with n nodes
+// take about log2(n)/LG_RADIX_BITS passes each.  The keys are sorted from the
+// last one (A_2) to the first (A_0), and each pass is a stable counting sort
+// on one digit of one key:
+
+//  (1) the list is split into nthreads slices, and each thread computes the
+//      histogram of the digit in its slice;
+//  (2) a cumulative sum of the histograms, in digit-major, slice-minor order,
+//      gives each thread the position in the output of each digit;
+//  (3) each thread scatters its slice to the output, in order.
+
+// A pass is skipped if all tuples have the same digit.  The tuples move back
+// and forth between A and a workspace of the same size, and are copied back
+// to A at the end if needed.
+
+// If force is false, LG_rsort sorts A only if the radix sort is expected to be
+// faster than the mergesort: if the number of passes is small compared with
+// log2(n).  Otherwise, A is not modified, and sorted is returned as false.
+// LG_msort1, LG_msort2, and LG_msort3 call LG_rsort this way, so their callers
+// use the radix sort automatically when the keys have a small range.
+
+#define LG_FREE_ALL                         \
+{                                           \
+    LAGraph_Free ((void **) &W, NULL) ;     \
+    LAGraph_Free ((void **) &Hist, NULL) ;  \
+}
+
+#include "LG_internal.h"
+
+#define LG_RADIX (1 << LG_RADIX_BITS)
+
+int LG_rsort
+(
+    // input/output:
+    int64_t *A_0,       // size n array
+    int64_t *A_1,       // size n array, or NULL if only one key
+    int64_t *A_2,       // size n array, or NULL if only one or two keys
+    // input:
+    const int64_t n,
+    bool force,         // if true, always sort A
+    // output:
+    bool *sorted,       // true if A has been sorted
+    char *msg
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    LG_CLEAR_MSG ;
+    int64_t *W = NULL, *Hist = NULL ;
+    LG_ASSERT (A_0 != NULL && sorted != NULL, GrB_NULL_POINTER) ;
+    LG_ASSERT (A_1 != NULL || A_2 == NULL, GrB_NULL_POINTER) ;
+    (*sorted) = false ;
+
+    int nkeys = (A_1 == NULL) ? 1 : ((A_2 == NULL) ? 2 : 3) ;
+    int64_t *A [3] = { A_0, A_1, A_2 } ;
+
+    if (n <= 1)
+    {
+        (*sorted) = true ;
+        return (GrB_SUCCESS) ;
+    }
+
+    if (!force && n <= LG_BASECASE)
+    {
+        // leave small problems to LG_msort*
+        return (GrB_SUCCESS) ;
+    }
+
+    int nthreads = LG_nthreads_outer * LG_nthreads_inner ;
+    nthreads = LAGRAPH_MIN (nthreads, n / LG_BASECASE) ;
+    nthreads = LAGRAPH_MIN (nthreads, LG_RADIX) ;
+    nthreads = LAGRAPH_MAX (nthreads, 1) ;
+
+    //--------------------------------------------------------------------------
+    // find the range of each key, and the number of passes
+    //--------------------------------------------------------------------------
+
+    int64_t kmin [3], nbits [3] ;
+    int npasses = 0 ;
+    for (int key = 0 ; key < nkeys ; key++)
+    {
+        const int64_t *LG_RESTRICT Ak = A [key] ;
+        int64_t amin = Ak [0], amax = Ak [0] ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+            reduction(min:amin) reduction(max:amax)
+        for (int64_t k = 0 ; k < n ; k++)
+        {
+            amin = LAGRAPH_MIN (amin, Ak [k]) ;
+            amax = LAGRAPH_MAX (amax, Ak [k]) ;
+        }
+        uint64_t range = ((uint64_t) amax) - ((uint64_t) amin) ;
+        int bits = 0 ;
+        while (bits < 64 && (range >> bits) != 0) bits++ ;
+        kmin [key] = amin ;
+        nbits [key] = bits ;
+        npasses += (bits + LG_RADIX_BITS - 1) / LG_RADIX_BITS ;
+    }
+
+    if (!force && 2 * npasses > log2 ((double) n))
+    {
+        // too many passes; leave the sort to LG_msort*
+        return (GrB_SUCCESS) ;
+    }
+
+    if (npasses == 0)
+    {
+        // all tuples are identical
+        (*sorted) = true ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate workspace
+    //--------------------------------------------------------------------------
+
+    LG_TRY (LAGraph_Malloc ((void **) &W, nkeys * n, sizeof (int64_t), msg)) ;
+    LG_TRY (LAGraph_Malloc ((void **) &Hist, nthreads * LG_RADIX,
+        sizeof (int64_t), msg)) ;
+
+    int64_t *Src [3], *Dst [3] ;
+    for (int key = 0 ; key < nkeys ; key++)
+    {
+        Src [key] = A [key] ;
+        Dst [key] = W + key * n ;
+    }
+
+    int64_t Slice [LG_RADIX + 1] ;
+    LG_eslice (Slice, n, nthreads) ;
+
+    //--------------------------------------------------------------------------
+    // sort each digit of each key, from least significant to most
+    //--------------------------------------------------------------------------
+
+    for (int key = nkeys - 1 ; key >= 0 ; key--)
+    {
+        const uint64_t amin = (uint64_t) kmin [key] ;
+        for (int shift = 0 ; shift < nbits [key] ; shift += LG_RADIX_BITS)
+        {
+
+            //------------------------------------------------------------------
+            // (1) histogram of each slice
+            //------------------------------------------------------------------
+
+            const int64_t *LG_RESTRICT Sk = Src [key] ;
+            int tid ;
+            #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+            for (tid = 0 ; tid < nthreads ; tid++)
+            {
+                int64_t *LG_RESTRICT H = Hist + tid * LG_RADIX ;
+                memset (H, 0, LG_RADIX * sizeof (int64_t)) ;
+                for (int64_t k = Slice [tid] ; k < Slice [tid+1] ; k++)
+                {
+                    H [(((uint64_t) Sk [k] - amin) >> shift) & (LG_RADIX-1)]++ ;
+                }
+            }
+
+            //------------------------------------------------------------------
+            // (2) cumulative sum, skipping the pass if only one digit appears
+            //------------------------------------------------------------------
+
+            int64_t s = 0 ;
+            bool skip = false ;
+            for (int d = 0 ; d < LG_RADIX && !skip ; d++)
+            {
+                int64_t count = 0 ;
+                for (tid = 0 ; tid < nthreads ; tid++)
+                {
+                    int64_t c = Hist [tid * LG_RADIX + d] ;
+                    Hist [tid * LG_RADIX + d] = s ;
+                    s += c ;
+                    count += c ;
+                }
+                skip = (count == n) ;
+            }
+            if (skip) continue ;
+
+            //------------------------------------------------------------------
+            // (3) scatter each slice, in order
+            //------------------------------------------------------------------
+
+            #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+            for (tid = 0 ; tid < nthreads ; tid++)
+            {
+                int64_t *LG_RESTRICT H = Hist + tid * LG_RADIX ;
+                for (int64_t k = Slice [tid] ; k < Slice [tid+1] ; k++)
+                {
+                    int d = (((uint64_t) Sk [k] - amin) >> shift) & (LG_RADIX-1);
+                    int64_t p = H [d]++ ;
+                    for (int i = 0 ; i < nkeys ; i++)
+                    {
+                        Dst [i][p] = Src [i][k] ;
+                    }
+                }
+            }
+
+            for (int i = 0 ; i < nkeys ; i++)
+            {
+                int64_t *T = Src [i] ; Src [i] = Dst [i] ; Dst [i] = T ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // copy the result back into A, if needed
+    //--------------------------------------------------------------------------
+
+    if (Src [0] != A_0)
+    {
+        int tid ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+        for (tid = 0 ; tid < nthreads ; tid++)
+        {
+            int64_t pstart = Slice [tid] ;
+            int64_t len = Slice [tid+1] - pstart ;
+            for (int i = 0 ; i < nkeys ; i++)
+            {
+                memcpy (A [i] + pstart, Src [i] + pstart,
+                    len * sizeof (int64_t)) ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    LG_FREE_ALL ;
+    (*sorted) = true ;
+    return (GrB_SUCCESS) ;
+}